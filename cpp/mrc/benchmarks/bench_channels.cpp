@@ -0,0 +1,138 @@
+/**
+ * SPDX-FileCopyrightText: Copyright (c) 2023, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "mrc/channel/buffered_channel.hpp"
+#include "mrc/channel/channel.hpp"
+#include "mrc/channel/mpmc_channel.hpp"
+#include "mrc/channel/spsc_channel.hpp"
+
+#include <benchmark/benchmark.h>
+
+#include <cstddef>
+#include <memory>
+#include <numeric>
+#include <thread>
+#include <vector>
+
+using namespace mrc;
+
+/**
+ * Single producer thread writing into a channel drained by the benchmark thread. Compares the boost backed
+ * BufferedChannel against the lock-free rings selected for 1:1 segment edges.
+ */
+template <typename ChannelT>
+static void channel_thread_handoff(benchmark::State& state)
+{
+    const std::size_t count = state.range(0);
+
+    for (auto _ : state)
+    {
+        auto channel = std::make_unique<ChannelT>(128);
+
+        std::thread producer([&channel, count] {
+            for (std::size_t i = 0; i < count; ++i)
+            {
+                channel->await_write(std::size_t(i));
+            }
+            channel->close_channel();
+        });
+
+        std::size_t value;
+        std::size_t sum = 0;
+        while (channel->await_read(value) == channel::Status::success)
+        {
+            sum += value;
+        }
+        benchmark::DoNotOptimize(sum);
+
+        producer.join();
+    }
+
+    state.SetItemsProcessed(state.iterations() * count);
+}
+
+/**
+ * Same handoff as above using the batched write/read operations with a batch size of state.range(1).
+ */
+template <typename ChannelT>
+static void channel_thread_handoff_batched(benchmark::State& state)
+{
+    const std::size_t count      = state.range(0);
+    const std::size_t batch_size = state.range(1);
+
+    for (auto _ : state)
+    {
+        auto channel = std::make_unique<ChannelT>(128);
+
+        std::thread producer([&channel, count, batch_size] {
+            std::vector<std::size_t> batch(batch_size);
+            for (std::size_t i = 0; i < count; i += batch_size)
+            {
+                std::iota(batch.begin(), batch.end(), i);
+                channel->await_write_batch(batch);
+            }
+            channel->close_channel();
+        });
+
+        std::vector<std::size_t> batch(batch_size);
+        std::size_t read = 0;
+        std::size_t sum  = 0;
+        while (channel->await_read_up_to(batch, read) == channel::Status::success)
+        {
+            for (std::size_t i = 0; i < read; ++i)
+            {
+                sum += batch[i];
+            }
+        }
+        benchmark::DoNotOptimize(sum);
+
+        producer.join();
+    }
+
+    state.SetItemsProcessed(state.iterations() * count);
+}
+
+template <typename ChannelT>
+static void channel_write_read_same_thread(benchmark::State& state)
+{
+    auto channel = std::make_unique<ChannelT>(128);
+
+    std::size_t value = 0;
+    for (auto _ : state)
+    {
+        channel->await_write(std::size_t(value));
+        channel->await_read(value);
+        benchmark::DoNotOptimize(value);
+    }
+
+    channel->close_channel();
+}
+
+BENCHMARK_TEMPLATE(channel_thread_handoff, channel::BufferedChannel<std::size_t>)->Arg(1 << 16)->UseRealTime();
+BENCHMARK_TEMPLATE(channel_thread_handoff, channel::SpscChannel<std::size_t>)->Arg(1 << 16)->UseRealTime();
+BENCHMARK_TEMPLATE(channel_thread_handoff, channel::MpmcChannel<std::size_t>)->Arg(1 << 16)->UseRealTime();
+
+BENCHMARK_TEMPLATE(channel_thread_handoff_batched, channel::BufferedChannel<std::size_t>)
+    ->Args({1 << 16, 32})
+    ->UseRealTime();
+BENCHMARK_TEMPLATE(channel_thread_handoff_batched, channel::SpscChannel<std::size_t>)
+    ->Args({1 << 16, 32})
+    ->UseRealTime();
+
+BENCHMARK_TEMPLATE(channel_write_read_same_thread, channel::BufferedChannel<std::size_t>);
+BENCHMARK_TEMPLATE(channel_write_read_same_thread, channel::SpscChannel<std::size_t>);
+BENCHMARK_TEMPLATE(channel_write_read_same_thread, channel::MpmcChannel<std::size_t>);
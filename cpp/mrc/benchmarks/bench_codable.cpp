@@ -0,0 +1,143 @@
+/**
+ * SPDX-FileCopyrightText: Copyright (c) 2022-2023, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "internal/codable/codable_storage.hpp"
+#include "internal/codable/flat_storage.hpp"
+#include "internal/resources/manager.hpp"
+#include "internal/runtime/partition.hpp"
+#include "internal/runtime/runtime.hpp"
+#include "internal/system/system.hpp"
+#include "internal/system/system_provider.hpp"
+
+#include "mrc/codable/decode.hpp"
+#include "mrc/codable/encode.hpp"
+#include "mrc/codable/fundamental_types.hpp"  // IWYU pragma: keep
+#include "mrc/memory/buffer_view.hpp"
+#include "mrc/memory/memory_kind.hpp"
+#include "mrc/options/options.hpp"
+#include "mrc/options/placement.hpp"
+#include "mrc/protos/codable.pb.h"
+
+#include <benchmark/benchmark.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+using namespace mrc;
+
+/**
+ * Round trip of a small message (two scalars and a short string, all eager) through each ICodableStorage: encode,
+ * produce the bytes which would be sent, then decode every object on the "remote" side from a copy of those bytes.
+ *
+ * The protobuf storage serializes and re-parses the protos::EncodedObject; the flat storage writes its tables once and
+ * the receiver reads them in place.
+ */
+class CodableStorageRoundTrip : public benchmark::Fixture
+{
+  public:
+    void SetUp(const benchmark::State& state) override
+    {
+        auto options = std::make_shared<Options>();
+        options->enable_server(true);
+        options->architect_url("localhost:13337");
+        options->placement().resources_strategy(PlacementResources::Dedicated);
+
+        auto resources = std::make_unique<internal::resources::Manager>(
+            internal::system::SystemProvider(internal::system::make_system(std::move(options))));
+        m_runtime = std::make_unique<internal::runtime::Runtime>(std::move(resources));
+    }
+
+    void TearDown(const benchmark::State& state) override
+    {
+        m_runtime.reset();
+    }
+
+  protected:
+    internal::resources::PartitionResources& resources()
+    {
+        return m_runtime->partition(0).resources();
+    }
+
+    template <typename StorageT>
+    void encode_message(StorageT& storage)
+    {
+        codable::encode(m_id, storage);
+        codable::encode(m_value, storage);
+        codable::encode(m_name, storage);
+    }
+
+    template <typename StorageT>
+    void decode_message(const StorageT& storage)
+    {
+        auto id    = codable::decode<std::uint64_t>(storage, 0);
+        auto value = codable::decode<double>(storage, 1);
+        auto name  = codable::decode<std::string>(storage, 2);
+        benchmark::DoNotOptimize(id);
+        benchmark::DoNotOptimize(value);
+        benchmark::DoNotOptimize(name);
+    }
+
+    std::unique_ptr<internal::runtime::Runtime> m_runtime;
+
+    std::uint64_t m_id{42};
+    double m_value{3.14159};
+    std::string m_name{"a short payload which is always sent as an eager descriptor"};
+};
+
+BENCHMARK_F(CodableStorageRoundTrip, protobuf)(benchmark::State& state)
+{
+    std::string wire;
+
+    for (auto _ : state)
+    {
+        internal::codable::CodableStorage encoder(resources());
+        encode_message(encoder);
+        encoder.proto().SerializeToString(&wire);
+
+        codable::protos::EncodedObject proto;
+        proto.ParseFromString(wire);
+        internal::codable::CodableStorage decoder(std::move(proto), resources());
+        decode_message(decoder.decodable());
+    }
+
+    state.counters["encoded_bytes"] = wire.size();
+}
+
+BENCHMARK_F(CodableStorageRoundTrip, flat)(benchmark::State& state)
+{
+    std::vector<std::byte> wire;
+
+    for (auto _ : state)
+    {
+        internal::codable::FlatCodableStorage encoder(resources());
+        encode_message(encoder);
+        auto encoded = encoder.finalize();
+
+        wire.resize(encoded.bytes());
+        std::memcpy(wire.data(), encoded.data(), encoded.bytes());
+        internal::codable::FlatDecodableStorage decoder({wire.data(), wire.size(), memory::memory_kind::host},
+                                                        resources());
+        decode_message(decoder);
+    }
+
+    state.counters["encoded_bytes"] = wire.size();
+}
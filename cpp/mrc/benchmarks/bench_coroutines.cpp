@@ -18,14 +18,19 @@
 #include "mrc/coroutines/concepts/awaitable.hpp"
 #include "mrc/coroutines/sync_wait.hpp"
 #include "mrc/coroutines/task.hpp"
+#include "mrc/coroutines/thread_pool.hpp"
 #include "mrc/coroutines/when_all.hpp"
 
 #include <benchmark/benchmark.h>
 
+#include <algorithm>
 #include <coroutine>
 #include <cstddef>
+#include <cstdint>
+#include <thread>
 #include <tuple>
 #include <type_traits>
+#include <vector>
 
 using namespace mrc;
 
@@ -141,9 +146,53 @@ static void mrc_coro_await_incrementing_awaitable_baseline(benchmark::State& sta
     coroutines::sync_wait(task());
 }
 
+// throughput of a ThreadPool with state.range(0) threads; each task is scheduled from the calling thread and then
+// yields back to the pool from an executor thread, so both the shared and the per-thread queues are exercised
+static void mrc_coro_thread_pool_scaling(benchmark::State& state)
+{
+    constexpr std::size_t TaskCount  = 1024;
+    constexpr std::size_t YieldCount = 64;
+
+    coroutines::ThreadPool tp{{.thread_count = static_cast<std::uint32_t>(state.range(0))}};
+
+    auto task = [&]() -> coroutines::Task<void> {
+        co_await tp.schedule();
+        for (std::size_t i = 0; i < YieldCount; ++i)
+        {
+            co_await tp.yield();
+        }
+        co_return;
+    };
+
+    for (auto _ : state)
+    {
+        std::vector<coroutines::Task<void>> tasks;
+        tasks.reserve(TaskCount);
+        for (std::size_t i = 0; i < TaskCount; ++i)
+        {
+            tasks.emplace_back(task());
+        }
+        coroutines::sync_wait(coroutines::when_all(std::move(tasks)));
+    }
+
+    state.SetItemsProcessed(state.iterations() * TaskCount * (YieldCount + 1));
+}
+
+// 1, 2, 4, ... threads up to the number of hardware threads
+static void thread_pool_scaling_args(benchmark::internal::Benchmark* b)
+{
+    const auto max_threads = std::max(1U, std::thread::hardware_concurrency());
+    for (std::uint32_t threads = 1; threads < max_threads; threads *= 2)
+    {
+        b->Arg(threads);
+    }
+    b->Arg(max_threads);
+}
+
 BENCHMARK(mrc_coro_create_single_task_and_sync);
 BENCHMARK(mrc_coro_create_single_task_and_sync_on_when_all);
 BENCHMARK(mrc_coro_create_two_tasks_and_sync_on_when_all);
 BENCHMARK(mrc_coro_await_suspend_never);
 BENCHMARK(mrc_coro_await_incrementing_awaitable_baseline);
 BENCHMARK(mrc_coro_await_incrementing_awaitable);
+BENCHMARK(mrc_coro_thread_pool_scaling)->Apply(thread_pool_scaling_args)->UseRealTime();
@@ -0,0 +1,183 @@
+/**
+ * SPDX-FileCopyrightText: Copyright (c) 2022-2023, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "internal/memory/numa_memory_resource.hpp"
+#include "internal/system/topology.hpp"
+
+#include "mrc/core/bitmap.hpp"
+#include "mrc/memory/buffer.hpp"
+#include "mrc/memory/literals.hpp"
+#include "mrc/memory/resources/arena_resource.hpp"
+#include "mrc/memory/resources/host/huge_page_memory_resource.hpp"
+#include "mrc/memory/resources/host/malloc_memory_resource.hpp"
+#include "mrc/memory/resources/memory_resource.hpp"
+
+#include <benchmark/benchmark.h>
+#include <hwloc.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <array>
+#include <cstring>
+#include <memory>
+
+using namespace mrc;
+using namespace mrc::memory::literals;
+
+/**
+ * Streams through a buffer bound by NumaMemoryResource to either the NUMA node the benchmark thread runs on (local) or
+ * the last NUMA node of the machine (remote). Each iteration writes then reads the whole buffer; the reported bytes per
+ * second is the host memory bandwidth seen across (or not across) the socket interconnect.
+ */
+class NumaBandwidth : public benchmark::Fixture
+{
+  public:
+    void SetUp(const benchmark::State& state) override
+    {
+        m_topology = internal::system::Topology::Create();
+        CHECK_HWLOC(hwloc_get_cpubind(m_topology->handle(), &m_previous.bitmap(), HWLOC_CPUBIND_THREAD));
+
+        // run on the first numa node
+        CHECK_HWLOC(
+            hwloc_set_cpubind(m_topology->handle(), &m_topology->numa_cpuset(0).bitmap(), HWLOC_CPUBIND_THREAD));
+    }
+
+    void TearDown(const benchmark::State& state) override
+    {
+        CHECK_HWLOC(hwloc_set_cpubind(m_topology->handle(), &m_previous.bitmap(), HWLOC_CPUBIND_THREAD));
+        m_topology.reset();
+    }
+
+  protected:
+    void run(benchmark::State& state, std::uint32_t numa_id)
+    {
+        auto numa_set = m_topology->numaset_for_cpuset(m_topology->numa_cpuset(numa_id));
+        auto mr       = std::make_shared<internal::memory::NumaMemoryResource>(*m_topology, numa_set);
+        auto buffer   = memory::buffer(state.range(0), mr);
+
+        auto* words       = static_cast<std::uint64_t*>(buffer.data());
+        const auto nwords = buffer.bytes() / sizeof(std::uint64_t);
+        std::uint64_t sum = 0;
+
+        for (auto _ : state)
+        {
+            std::memset(buffer.data(), static_cast<int>(sum & 0xff), buffer.bytes());
+            for (std::size_t i = 0; i < nwords; ++i)
+            {
+                sum += words[i];
+            }
+            benchmark::DoNotOptimize(sum);
+        }
+
+        state.SetBytesProcessed(2 * state.iterations() * buffer.bytes());
+    }
+
+    std::shared_ptr<internal::system::Topology> m_topology;
+    CpuSet m_previous;
+};
+
+BENCHMARK_DEFINE_F(NumaBandwidth, local)(benchmark::State& state)
+{
+    run(state, 0);
+}
+
+BENCHMARK_DEFINE_F(NumaBandwidth, remote)(benchmark::State& state)
+{
+    if (m_topology->numa_count() < 2)
+    {
+        state.SkipWithError("remote bandwidth requires at least two numa nodes");
+        return;
+    }
+
+    run(state, m_topology->numa_count() - 1);
+}
+
+BENCHMARK_REGISTER_F(NumaBandwidth, local)->Arg(64_MiB)->Unit(benchmark::kMillisecond)->UseRealTime();
+BENCHMARK_REGISTER_F(NumaBandwidth, remote)->Arg(64_MiB)->Unit(benchmark::kMillisecond)->UseRealTime();
+
+/**
+ * Allocates a block the size of a host memory pool superblock from the resource the pool would draw from, touches
+ * every byte, then frees it: the cost the first use of a freshly grown pool pays. Arg 0 selects malloc, arg 1
+ * transparent huge pages and arg 2 explicit 2 MiB pages (which fall back to transparent huge pages without a
+ * hugetlbfs reservation).
+ */
+static void host_pool_superblock_allocate_touch(benchmark::State& state)
+{
+    std::shared_ptr<memory::memory_resource> mr;
+    switch (state.range(0))
+    {
+    case 0:
+        mr = std::make_shared<memory::malloc_memory_resource>();
+        break;
+    case 1:
+        mr = std::make_shared<memory::huge_page_memory_resource>(memory::huge_page_memory_resource::huge_page_2mib,
+                                                                 false);
+        break;
+    default:
+        mr = std::make_shared<memory::huge_page_memory_resource>(memory::huge_page_memory_resource::huge_page_2mib,
+                                                                 true);
+        break;
+    }
+
+    const std::size_t bytes = state.range(1);
+
+    for (auto _ : state)
+    {
+        auto block = memory::buffer(bytes, mr);
+        std::memset(block.data(), 1, block.bytes());
+        benchmark::ClobberMemory();
+    }
+
+    state.SetBytesProcessed(state.iterations() * bytes);
+}
+
+BENCHMARK(host_pool_superblock_allocate_touch)
+    ->ArgsProduct({{0, 1, 2}, {static_cast<std::int64_t>(128_MiB)}})
+    ->Unit(benchmark::kMillisecond)
+    ->UseRealTime();
+
+/**
+ * Allocates and frees a handful of small transient blocks from a host memory pool shared by all benchmark threads, the
+ * pattern of fiber threads passing short-lived buffers around. Blocks recycle through the per-thread caches of the pool,
+ * so the throughput should scale with the number of threads rather than serialize on the pool locks.
+ */
+static void host_pool_transient_allocations(benchmark::State& state)
+{
+    // shared by the threads of every run; the initialization of a local static is thread-safe
+    static auto pool = memory::make_shared_resource<memory::arena_resource>(
+        std::make_shared<memory::malloc_memory_resource>(), 64_MiB, 1_GiB);
+
+    const std::size_t bytes = state.range(0);
+    std::array<void*, 8> blocks{};
+
+    for (auto _ : state)
+    {
+        for (auto& block : blocks)
+        {
+            block = pool->allocate(bytes);
+        }
+        benchmark::DoNotOptimize(blocks.data());
+        for (auto* block : blocks)
+        {
+            pool->deallocate(block, bytes);
+        }
+    }
+
+    state.SetItemsProcessed(state.iterations() * blocks.size());
+}
+
+BENCHMARK(host_pool_transient_allocations)->Arg(256)->Arg(4_KiB)->Arg(64_KiB)->ThreadRange(1, 32)->UseRealTime();
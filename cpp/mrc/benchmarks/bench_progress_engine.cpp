@@ -0,0 +1,173 @@
+/**
+ * SPDX-FileCopyrightText: Copyright (c) 2022-2023, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "internal/ucx/adaptive_progress.hpp"
+#include "internal/ucx/context.hpp"
+#include "internal/ucx/endpoint.hpp"
+#include "internal/ucx/worker.hpp"
+
+#include "mrc/options/progress_engine.hpp"
+
+#include <benchmark/benchmark.h>
+#include <glog/logging.h>
+#include <ucp/api/ucp.h>
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <cstdlib>
+#include <ctime>
+#include <limits>
+#include <memory>
+#include <thread>
+
+using namespace mrc;
+
+namespace {
+
+// force the completion callback to be used
+constexpr std::uint32_t RecvAttrMask =
+    UCP_OP_ATTR_FIELD_CALLBACK | UCP_OP_ATTR_FIELD_USER_DATA | UCP_OP_ATTR_FLAG_NO_IMM_CMPL;
+
+double thread_cpu_seconds()
+{
+    timespec ts;
+    clock_gettime(CLOCK_THREAD_CPUTIME_ID, &ts);
+    return static_cast<double>(ts.tv_sec) + static_cast<double>(ts.tv_nsec) * 1e-9;
+}
+
+void recv_callback(void* request, ucs_status_t status, const ucp_tag_recv_info_t* info, void* user_data)
+{
+    CHECK_EQ(status, UCS_OK);
+    static_cast<std::atomic_bool*>(user_data)->store(true);
+    ucp_request_free(request);
+}
+
+}  // namespace
+
+/**
+ * Loopback pair of workers: the receiving worker is progressed by a dedicated thread using the AdaptiveProgress
+ * strategy, the sending worker by the benchmark thread. Each iteration sends one eager message and then leaves the
+ * receiver idle for range(1) microseconds, the way a lightly loaded data plane sees traffic.
+ *
+ * range(0) == 0 polls without ever backing off or parking, i.e. the previous behavior of the data plane progress
+ * engine; range(0) == 1 uses the default ProgressEngineOptions, which back off but do not park; range(0) == 2 also
+ * parks after 2ms of idling. The progress_cpu counter is the fraction of a core
+ * consumed by the progress thread over the whole run, including the idle gaps which are excluded from the timing.
+ */
+static void ucx_progress_engine_cpu_time(benchmark::State& state)
+{
+    // host-only loopback transports; an explicit UCX_TLS in the environment takes precedence
+    setenv("UCX_TLS", "tcp,sm,self", 0);  // NOLINT
+
+    ProgressEngineOptions options;
+    if (state.range(0) == 0)
+    {
+        options.spin_count(std::numeric_limits<std::size_t>::max());
+    }
+    if (state.range(0) == 2)
+    {
+        options.park_threshold(std::chrono::microseconds(2000));
+    }
+    const auto idle = std::chrono::microseconds(state.range(1));
+
+    auto context  = std::make_shared<internal::ucx::Context>();
+    auto receiver = std::make_shared<internal::ucx::Worker>(context);
+    auto sender   = std::make_shared<internal::ucx::Worker>(context);
+    auto endpoint = std::make_shared<internal::ucx::Endpoint>(sender, receiver->address());
+
+    std::atomic_bool running{true};
+    double progress_cpu        = 0;
+    std::size_t progress_parks = 0;
+
+    std::thread progress_thread([&] {
+        internal::ucx::AdaptiveProgress progress(*receiver, options);
+        const auto start = thread_cpu_seconds();
+        while (running)
+        {
+            bool active = false;
+            while (receiver->progress() != 0U)
+            {
+                active = true;
+            }
+            progress.wait(active);
+        }
+        progress_cpu   = thread_cpu_seconds() - start;
+        progress_parks = progress.park_count();
+    });
+
+    const ucp_tag_t tag      = 42;
+    const ucp_tag_t tag_mask = ~ucp_tag_t{0};
+    std::uint64_t value      = 0;
+    std::uint64_t result     = 0;
+
+    const auto wall_start = std::chrono::steady_clock::now();
+
+    for (auto _ : state)
+    {
+        std::atomic_bool received{false};
+
+        ucp_request_param_t recv_params;
+        recv_params.op_attr_mask = RecvAttrMask;
+        recv_params.cb.recv      = recv_callback;
+        recv_params.user_data    = &received;
+
+        auto* recv_request =
+            ucp_tag_recv_nbx(receiver->handle(), &result, sizeof(result), tag, tag_mask, &recv_params);
+        CHECK(!UCS_PTR_IS_ERR(recv_request));
+        receiver->wake();
+
+        ucp_request_param_t send_params;
+        send_params.op_attr_mask = 0;
+
+        value++;
+        auto* send_request = ucp_tag_send_nbx(endpoint->handle(), &value, sizeof(value), tag, &send_params);
+        CHECK(!UCS_PTR_IS_ERR(send_request));
+        while (send_request != nullptr && ucp_request_check_status(send_request) == UCS_INPROGRESS)
+        {
+            sender->progress();
+        }
+        if (send_request != nullptr)
+        {
+            ucp_request_free(send_request);
+        }
+
+        while (!received)
+        {
+            sender->progress();
+        }
+        CHECK_EQ(result, value);
+
+        state.PauseTiming();
+        std::this_thread::sleep_for(idle);
+        state.ResumeTiming();
+    }
+
+    const std::chrono::duration<double> wall = std::chrono::steady_clock::now() - wall_start;
+
+    running = false;
+    receiver->wake();
+    progress_thread.join();
+
+    state.counters["progress_cpu"]   = progress_cpu / wall.count();
+    state.counters["progress_parks"] = static_cast<double>(progress_parks);
+}
+
+BENCHMARK(ucx_progress_engine_cpu_time)
+    ->ArgsProduct({{0, 1, 2}, {0, 100, 1000, 10000}})
+    ->UseRealTime()
+    ->Unit(benchmark::kMicrosecond);
@@ -18,6 +18,7 @@
 #include "mrc/benchmarking/segment_watcher.hpp"
 #include "mrc/benchmarking/tracer.hpp"
 #include "mrc/benchmarking/util.hpp"
+#include "mrc/channel/channel.hpp"
 #include "mrc/core/executor.hpp"
 #include "mrc/engine/pipeline/ipipeline.hpp"
 #include "mrc/node/rx_node.hpp"
@@ -321,6 +322,30 @@ class SegmentRawThroughput : public SimpleEmitReceiveFixture<throughput_tracer_t
 class SegmentThroughput : public SimpleEmitReceiveFixture<throughput_tracer_t, false>
 {};
 
+/**
+ * Same segment as SegmentRawThroughput, but with the lock-free 1:1 edge channels disabled so every edge uses the
+ * default BufferedChannel.
+ */
+class SegmentRawThroughputBufferedEdges : public SimpleEmitReceiveFixture<throughput_tracer_t, true>
+{
+  public:
+    void SetUp(const ::benchmark::State& state) override
+    {
+        m_lock_free_edges = channel::lock_free_edge_channels();
+        channel::set_lock_free_edge_channels(false);
+        SimpleEmitReceiveFixture<throughput_tracer_t, true>::SetUp(state);
+    }
+
+    void TearDown(const ::benchmark::State& state) override
+    {
+        SimpleEmitReceiveFixture<throughput_tracer_t, true>::TearDown(state);
+        channel::set_lock_free_edge_channels(m_lock_free_edges);
+    }
+
+  private:
+    bool m_lock_free_edges{true};
+};
+
 using latency_tracer_2_t = TracerEnsemble<std::size_t, LatencyTracer>;
 class SegmentLongComponentRawLatency : public LongEmitReceiveFixture<latency_tracer_2_t, true, InternalNodeCount>
 {};
@@ -379,6 +404,18 @@ BENCHMARK_F(SegmentRawThroughput, component_throughput_raw)(benchmark::State& st
     add_state_counters(m_watcher->aggregate_tracers(), state);
 }
 
+// NOLINTNEXTLINE
+BENCHMARK_F(SegmentRawThroughputBufferedEdges, component_throughput_raw_buffered_edges)(benchmark::State& state)
+{
+    m_watcher->tracer_count(1e4);
+    for (auto _ : state)
+    {
+        m_watcher->reset();
+        m_watcher->trace_until_notified();
+    }
+    add_state_counters(m_watcher->aggregate_tracers(), state);
+}
+
 // NOLINTNEXTLINE
 BENCHMARK_F(SegmentThroughput, component_throughput)(benchmark::State& state)
 {
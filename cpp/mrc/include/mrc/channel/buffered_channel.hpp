@@ -22,6 +22,9 @@
 #include <boost/fiber/buffered_channel.hpp>
 #include <boost/fiber/channel_op_status.hpp>
 
+#include <atomic>
+#include <cstddef>
+
 namespace mrc::channel {
 
 template <typename T>
@@ -36,22 +39,22 @@ class BufferedChannel final : public Channel<T>
   private:
     inline Status do_await_write(T&& val) final
     {
-        return status(m_channel.push(std::move(val)));
+        return count_write(status(m_channel.push(std::move(val))));
     }
 
     inline Status do_await_read(T& val) final
     {
-        return status(m_channel.pop(std::ref(val)));
+        return count_read(status(m_channel.pop(std::ref(val))));
     }
 
     Status do_try_read(T& val) final
     {
-        return status(m_channel.try_pop(std::ref(val)));
+        return count_read(status(m_channel.try_pop(std::ref(val))));
     }
 
     Status do_await_read_until(T& val, const time_point_t& deadline) final
     {
-        return status(m_channel.pop_wait_until(std::ref(val), deadline));
+        return count_read(status(m_channel.pop_wait_until(std::ref(val), deadline)));
     }
 
     void do_close_channel() final
@@ -64,6 +67,33 @@ class BufferedChannel final : public Channel<T>
         return m_channel.is_closed();
     }
 
+    std::size_t do_size() const final
+    {
+        // reads may be counted before the matching write, so the difference can briefly go negative
+        auto size = m_size.load(std::memory_order_relaxed);
+        return size > 0 ? static_cast<std::size_t>(size) : 0;
+    }
+
+    // boost::fibers::buffered_channel does not expose its occupancy; it already serializes every operation on a
+    // spinlock, so one more relaxed counter update on success is a small price
+    Status count_write(Status rc)
+    {
+        if (rc == Status::success)
+        {
+            m_size.fetch_add(1, std::memory_order_relaxed);
+        }
+        return rc;
+    }
+
+    Status count_read(Status rc)
+    {
+        if (rc == Status::success)
+        {
+            m_size.fetch_sub(1, std::memory_order_relaxed);
+        }
+        return rc;
+    }
+
     Status status(const status_t rc)
     {
         switch (rc)
@@ -83,6 +113,7 @@ class BufferedChannel final : public Channel<T>
     }
 
     boost::fibers::buffered_channel<T> m_channel;
+    std::atomic<std::ptrdiff_t> m_size{0};
 };
 
 }  // namespace mrc::channel
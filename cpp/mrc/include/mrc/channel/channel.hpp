@@ -24,12 +24,29 @@
 #include "mrc/core/watcher.hpp"
 
 #include <cstddef>
+#include <span>
+#include <utility>
 
 namespace mrc::channel {
 
 std::size_t default_channel_size();
 void set_default_channel_size(std::size_t default_size);
 
+/**
+ * @brief Capacity of the channels of segment edges whose writer and reader are launched on different partitions. The
+ * deeper buffer absorbs the higher latency of handing values across NUMA nodes. Defaults to four times
+ * default_channel_size(); setting it to 0 restores that default.
+ */
+std::size_t cross_partition_channel_size();
+void set_cross_partition_channel_size(std::size_t size);
+
+/**
+ * @brief Whether segment edges between single-engine runnables are backed by a lock-free SpscChannel rather than the
+ * default BufferedChannel. Enabled by default.
+ */
+bool lock_free_edge_channels();
+void set_lock_free_edge_channels(bool enabled);
+
 struct ChannelBase
 {
     virtual ~ChannelBase() = 0;
@@ -71,9 +88,33 @@ class Channel : public Ingress<T>, public Egress<T>, public Watchable, public Ch
     Status await_read_until(T& t, const time_point_t& tp) final;
     Status try_read(T& t) final;
 
+    /**
+     * @brief Writes each element of items, in order, with a single watcher event for the whole batch. Elements are
+     * moved from as they are written. If a non-success status is returned, only a prefix of items was written.
+     */
+    inline Status await_write_batch(std::span<T> items);
+
+    /**
+     * @brief Blocks until at least one element is available, then reads up to items.size() elements without blocking
+     * further. On success, count holds the number of elements read (at least one for a non-empty span).
+     */
+    inline Status await_read_up_to(std::span<T> items, std::size_t& count);
+
+    /**
+     * @brief Same as await_read_up_to, but returns Status::timeout if no element becomes available before the deadline.
+     */
+    Status await_read_up_to(std::span<T> items, std::size_t& count, const time_point_t& tp);
+
     void close_channel();
     bool is_channel_closed() const;
 
+    /**
+     * @brief Approximate number of elements currently buffered in the channel. Intended for load balancing and
+     * monitoring decisions; the value may be stale by the time it is used. Channels which cannot report their
+     * occupancy return 0.
+     */
+    std::size_t size() const;
+
   private:
     virtual Status do_await_write(T&&) = 0;
 
@@ -81,8 +122,19 @@ class Channel : public Ingress<T>, public Egress<T>, public Watchable, public Ch
     virtual Status do_await_read_until(T&, const time_point_t&) = 0;
     virtual Status do_try_read(T&)                              = 0;
 
+    // Batched operations default to looping over the single element operations. Implementations which can move
+    // several elements under one synchronization point should override these.
+    virtual Status do_await_write_batch(std::span<T> items);
+    virtual Status do_await_read_up_to(std::span<T> items, std::size_t& count);
+    virtual Status do_await_read_up_to_until(std::span<T> items, std::size_t& count, const time_point_t& tp);
+
     virtual void do_close_channel()           = 0;
     virtual bool do_is_channel_closed() const = 0;
+
+    virtual std::size_t do_size() const
+    {
+        return 0;
+    }
 };
 
 template <typename T>
@@ -121,6 +173,93 @@ inline Status Channel<T>::try_read(T& t)
     return rc;
 }
 
+template <typename T>
+inline Status Channel<T>::await_write_batch(std::span<T> items)
+{
+    WATCHER_PROLOGUE(WatchableEvent::channel_write);
+    auto rc = do_await_write_batch(items);
+    WATCHER_EPILOGUE(WatchableEvent::channel_write, rc == Status::success);
+    return rc;
+}
+
+template <typename T>
+inline Status Channel<T>::await_read_up_to(std::span<T> items, std::size_t& count)
+{
+    WATCHER_PROLOGUE(WatchableEvent::channel_read);
+    auto rc = do_await_read_up_to(items, count);
+    WATCHER_EPILOGUE(WatchableEvent::channel_read, rc == Status::success);
+    return rc;
+}
+
+template <typename T>
+inline Status Channel<T>::await_read_up_to(std::span<T> items, std::size_t& count, const time_point_t& tp)
+{
+    WATCHER_PROLOGUE(WatchableEvent::channel_read);
+    auto rc = do_await_read_up_to_until(items, count, tp);
+    WATCHER_EPILOGUE(WatchableEvent::channel_read, rc == Status::success);
+    return rc;
+}
+
+template <typename T>
+Status Channel<T>::do_await_write_batch(std::span<T> items)
+{
+    for (auto& item : items)
+    {
+        auto rc = do_await_write(std::move(item));
+        if (rc != Status::success)
+        {
+            return rc;
+        }
+    }
+    return Status::success;
+}
+
+template <typename T>
+Status Channel<T>::do_await_read_up_to(std::span<T> items, std::size_t& count)
+{
+    count = 0;
+    if (items.empty())
+    {
+        return Status::success;
+    }
+
+    auto rc = do_await_read(items[0]);
+    if (rc != Status::success)
+    {
+        return rc;
+    }
+
+    count = 1;
+    while (count < items.size() && do_try_read(items[count]) == Status::success)
+    {
+        ++count;
+    }
+    return Status::success;
+}
+
+template <typename T>
+Status Channel<T>::do_await_read_up_to_until(std::span<T> items, std::size_t& count, const time_point_t& tp)
+{
+    count = 0;
+    if (items.empty())
+    {
+        return Status::success;
+    }
+
+    auto rc = do_await_read_until(items[0], tp);
+    if (rc != Status::success)
+    {
+        return rc;
+    }
+
+    count = 1;
+    while (count < items.size() && do_try_read(items[count]) == Status::success)
+    {
+        ++count;
+    }
+    return Status::success;
+}
+
 template <typename T>
 inline void Channel<T>::close_channel()
 {
@@ -133,6 +272,12 @@ inline bool Channel<T>::is_channel_closed() const
     return do_is_channel_closed();
 }
 
+template <typename T>
+inline std::size_t Channel<T>::size() const
+{
+    return do_size();
+}
+
 }  // namespace mrc::channel
 
 namespace mrc {
@@ -0,0 +1,155 @@
+/**
+ * SPDX-FileCopyrightText: Copyright (c) 2023, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include "mrc/channel/detail/ring_waiter.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <utility>
+
+namespace mrc::channel::detail {
+
+/**
+ * @brief Bounded, lock-free multi-producer/multi-consumer ring of T with a power of two capacity.
+ *
+ * Each slot of the ring carries a sequence number which producers and consumers claim with a single compare-exchange
+ * on the shared enqueue or dequeue position (D. Vyukov's bounded MPMC queue). All slots are allocated up front, so
+ * pushing and popping never allocate.
+ */
+template <typename T>
+class MpmcRing
+{
+  public:
+    MpmcRing(std::size_t buffer_size) :
+      m_capacity(next_power_of_two(buffer_size)),
+      m_mask(m_capacity - 1),
+      m_cells(std::make_unique<Cell[]>(m_capacity))
+    {
+        for (std::size_t i = 0; i < m_capacity; ++i)
+        {
+            m_cells[i].sequence.store(i, std::memory_order_relaxed);
+        }
+    }
+
+    std::size_t capacity() const
+    {
+        return m_capacity;
+    }
+
+    // val is only moved from on success
+    bool try_push(T& val)
+    {
+        Cell* cell;
+        auto pos = m_enqueue_pos.load(std::memory_order_relaxed);
+        while (true)
+        {
+            cell          = &m_cells[pos & m_mask];
+            auto sequence = cell->sequence.load(std::memory_order_acquire);
+            auto diff     = static_cast<std::intptr_t>(sequence) - static_cast<std::intptr_t>(pos);
+            if (diff == 0)
+            {
+                if (m_enqueue_pos.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed))
+                {
+                    break;
+                }
+            }
+            else if (diff < 0)
+            {
+                return false;
+            }
+            else
+            {
+                pos = m_enqueue_pos.load(std::memory_order_relaxed);
+            }
+        }
+        cell->value = std::move(val);
+        cell->sequence.store(pos + 1, std::memory_order_release);
+        return true;
+    }
+
+    bool try_pop(T& val)
+    {
+        Cell* cell;
+        auto pos = m_dequeue_pos.load(std::memory_order_relaxed);
+        while (true)
+        {
+            cell          = &m_cells[pos & m_mask];
+            auto sequence = cell->sequence.load(std::memory_order_acquire);
+            auto diff     = static_cast<std::intptr_t>(sequence) - static_cast<std::intptr_t>(pos + 1);
+            if (diff == 0)
+            {
+                if (m_dequeue_pos.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed))
+                {
+                    break;
+                }
+            }
+            else if (diff < 0)
+            {
+                return false;
+            }
+            else
+            {
+                pos = m_dequeue_pos.load(std::memory_order_relaxed);
+            }
+        }
+        val = std::move(cell->value);
+        cell->sequence.store(pos + m_mask + 1, std::memory_order_release);
+        return true;
+    }
+
+    std::size_t size() const
+    {
+        // positions are claimed before the cell is filled or drained, so this counts in-flight operations as well
+        const auto dequeue = m_dequeue_pos.load(std::memory_order_acquire);
+        const auto enqueue = m_enqueue_pos.load(std::memory_order_acquire);
+        return enqueue > dequeue ? std::min(enqueue - dequeue, m_capacity) : 0;
+    }
+
+    // approximate; only used as a wake-up predicate, the push/pop loops are authoritative
+    bool is_full() const
+    {
+        auto pos = m_enqueue_pos.load(std::memory_order_acquire);
+        return m_cells[pos & m_mask].sequence.load(std::memory_order_acquire) != pos;
+    }
+
+    bool is_empty() const
+    {
+        auto pos = m_dequeue_pos.load(std::memory_order_acquire);
+        return m_cells[pos & m_mask].sequence.load(std::memory_order_acquire) != pos + 1;
+    }
+
+  private:
+    struct Cell
+    {
+        std::atomic<std::size_t> sequence;
+        T value;
+    };
+
+    const std::size_t m_capacity;
+    const std::size_t m_mask;
+    std::unique_ptr<Cell[]> m_cells;
+
+    alignas(CacheLineSize) std::atomic<std::size_t> m_enqueue_pos{0};
+    alignas(CacheLineSize) std::atomic<std::size_t> m_dequeue_pos{0};
+};
+
+}  // namespace mrc::channel::detail
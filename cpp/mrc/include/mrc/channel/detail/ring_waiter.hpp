@@ -0,0 +1,104 @@
+/**
+ * SPDX-FileCopyrightText: Copyright (c) 2023, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include "mrc/channel/types.hpp"
+
+#include <boost/fiber/condition_variable.hpp>
+
+#include <atomic>
+#include <cstddef>
+#include <mutex>
+
+namespace mrc::channel::detail {
+
+// Size used to pad the producer and consumer sides of a ring onto separate cache lines
+static constexpr std::size_t CacheLineSize = 64;
+
+inline std::size_t next_power_of_two(std::size_t value)
+{
+    std::size_t power = 1;
+    while (power < value)
+    {
+        power <<= 1;
+    }
+    return power;
+}
+
+/**
+ * @brief Parks the readers or writers of a lock-free ring while the ring is empty or full.
+ *
+ * The uncontended path of a ring channel never touches the mutex; a notifier only acquires the mutex when the waiter
+ * count indicates that a fiber may be parked. The waiter count and the ring indices are ordered with sequential
+ * consistency so a waiter cannot miss a notification issued between its predicate check and its suspension.
+ *
+ * The mutex only guards the short park/notify handshake and is never held while a fiber is suspended, so a std::mutex
+ * paired with a fiber condition_variable_any is used rather than a fiber mutex, which is considerably more expensive to
+ * hand off between threads.
+ */
+class RingWaiter
+{
+  public:
+    template <typename PredicateT>
+    void wait(PredicateT&& ready)
+    {
+        std::unique_lock<std::mutex> lock(m_mutex);
+        m_waiters.fetch_add(1, std::memory_order_relaxed);
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        m_cv.wait(lock, ready);
+        m_waiters.fetch_sub(1, std::memory_order_relaxed);
+    }
+
+    template <typename PredicateT>
+    bool wait_until(PredicateT&& ready, const time_point_t& deadline)
+    {
+        std::unique_lock<std::mutex> lock(m_mutex);
+        m_waiters.fetch_add(1, std::memory_order_relaxed);
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        auto rc = m_cv.wait_until(lock, deadline, ready);
+        m_waiters.fetch_sub(1, std::memory_order_relaxed);
+        return rc;
+    }
+
+    void notify_one()
+    {
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        if (m_waiters.load(std::memory_order_relaxed) > 0)
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            m_cv.notify_one();
+        }
+    }
+
+    void notify_all()
+    {
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        if (m_waiters.load(std::memory_order_relaxed) > 0)
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            m_cv.notify_all();
+        }
+    }
+
+  private:
+    std::atomic<std::size_t> m_waiters{0};
+    std::mutex m_mutex;
+    boost::fibers::condition_variable_any m_cv;
+};
+
+}  // namespace mrc::channel::detail
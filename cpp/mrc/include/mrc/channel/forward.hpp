@@ -35,10 +35,19 @@ class Channel;
 template <typename T>
 class BufferedChannel;
 
+template <typename T>
+class SpscChannel;
+
+template <typename T>
+class MpmcChannel;
+
 template <typename T>
 class RecentChannel;
 
 template <typename T>
 class NullChannel;
 
+template <typename T>
+class InlineChannel;
+
 }  // namespace mrc::channel
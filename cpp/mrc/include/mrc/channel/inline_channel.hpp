@@ -0,0 +1,93 @@
+/**
+ * SPDX-FileCopyrightText: Copyright (c) 2023, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include "mrc/channel/channel.hpp"
+
+#include <atomic>
+#include <functional>
+#include <utility>
+
+namespace mrc::channel {
+
+/**
+ * @brief Channel without a buffer which hands each written value to a callback on the writer's thread/fiber.
+ *
+ * Used when a downstream stage is fused into the runnable of its upstream: the upstream writes to the usual edge, but
+ * the value is consumed before await_write returns. The channel has no readers; closing it invokes the close callback
+ * exactly once. Only a single writer is supported.
+ */
+template <typename T>
+class InlineChannel : public Channel<T>
+{
+  public:
+    using on_write_fn_t = std::function<void(T&&)>;
+    using on_close_fn_t = std::function<void()>;
+
+    InlineChannel(on_write_fn_t on_write, on_close_fn_t on_close) :
+      m_on_write(std::move(on_write)),
+      m_on_close(std::move(on_close))
+    {}
+
+    ~InlineChannel() override = default;
+
+  private:
+    Status do_await_write(T&& t) override
+    {
+        if (m_is_closed.load(std::memory_order_acquire))
+        {
+            return Status::closed;
+        }
+        m_on_write(std::move(t));
+        return Status::success;
+    }
+
+    Status do_await_read(T& t) override
+    {
+        return Status::error;
+    }
+
+    Status do_await_read_until(T& t, const time_point_t& deadline) override
+    {
+        return Status::error;
+    }
+
+    Status do_try_read(T& t) override
+    {
+        return Status::error;
+    }
+
+    void do_close_channel() override
+    {
+        if (!m_is_closed.exchange(true, std::memory_order_acq_rel))
+        {
+            m_on_close();
+        }
+    }
+
+    bool do_is_channel_closed() const override
+    {
+        return m_is_closed.load(std::memory_order_acquire);
+    }
+
+    on_write_fn_t m_on_write;
+    on_close_fn_t m_on_close;
+    std::atomic<bool> m_is_closed{false};
+};
+
+}  // namespace mrc::channel
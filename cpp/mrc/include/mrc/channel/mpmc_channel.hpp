@@ -0,0 +1,201 @@
+/**
+ * SPDX-FileCopyrightText: Copyright (c) 2023, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include "mrc/channel/channel.hpp"
+#include "mrc/channel/detail/mpmc_ring.hpp"
+#include "mrc/channel/detail/ring_waiter.hpp"
+
+#include <boost/fiber/operations.hpp>
+
+#include <atomic>
+#include <cstddef>
+
+namespace mrc::channel {
+
+/**
+ * @brief Bounded, lock-free multi-producer/multi-consumer Channel.
+ *
+ * Values are stored in a detail::MpmcRing (D. Vyukov's bounded MPMC queue). As with SpscChannel, the std::mutex of the
+ * detail::RingWaiter is only acquired to park a writer on a full ring or a reader on an empty ring.
+ *
+ * @tparam T
+ */
+template <typename T>
+class MpmcChannel final : public Channel<T>
+{
+  public:
+    MpmcChannel(std::size_t buffer_size = default_channel_size()) : m_ring(buffer_size) {}
+    ~MpmcChannel() final = default;
+
+    std::size_t capacity() const
+    {
+        return m_ring.capacity();
+    }
+
+  private:
+    Status do_await_write(T&& val) final
+    {
+        while (true)
+        {
+            if (m_is_closed.load(std::memory_order_acquire))
+            {
+                return Status::closed;
+            }
+            if (try_push(val))
+            {
+                m_readers.notify_one();
+                return Status::success;
+            }
+
+            boost::this_fiber::yield();
+            if (try_push(val))
+            {
+                m_readers.notify_one();
+                return Status::success;
+            }
+
+            m_writers.wait([this] {
+                return m_is_closed.load(std::memory_order_acquire) || !is_full();
+            });
+        }
+    }
+
+    Status do_await_read(T& val) final
+    {
+        while (true)
+        {
+            if (try_pop(val))
+            {
+                m_writers.notify_one();
+                return Status::success;
+            }
+            if (m_is_closed.load(std::memory_order_acquire))
+            {
+                return drain_after_close(val);
+            }
+
+            m_readers.wait([this] {
+                return m_is_closed.load(std::memory_order_acquire) || !is_empty();
+            });
+        }
+    }
+
+    Status do_try_read(T& val) final
+    {
+        if (try_pop(val))
+        {
+            m_writers.notify_one();
+            return Status::success;
+        }
+        if (m_is_closed.load(std::memory_order_acquire))
+        {
+            return drain_after_close(val);
+        }
+        return Status::empty;
+    }
+
+    Status do_await_read_until(T& val, const time_point_t& deadline) final
+    {
+        while (true)
+        {
+            if (try_pop(val))
+            {
+                m_writers.notify_one();
+                return Status::success;
+            }
+            if (m_is_closed.load(std::memory_order_acquire))
+            {
+                return drain_after_close(val);
+            }
+
+            auto ready = m_readers.wait_until(
+                [this] {
+                    return m_is_closed.load(std::memory_order_acquire) || !is_empty();
+                },
+                deadline);
+
+            if (!ready)
+            {
+                return Status::timeout;
+            }
+        }
+    }
+
+    void do_close_channel() final
+    {
+        m_is_closed.store(true, std::memory_order_release);
+        m_readers.notify_all();
+        m_writers.notify_all();
+    }
+
+    bool do_is_channel_closed() const final
+    {
+        return m_is_closed.load(std::memory_order_acquire);
+    }
+
+    Status drain_after_close(T& val)
+    {
+        if (try_pop(val))
+        {
+            m_writers.notify_one();
+            return Status::success;
+        }
+        return Status::closed;
+    }
+
+    bool try_push(T& val)
+    {
+        return m_ring.try_push(val);
+    }
+
+    bool try_pop(T& val)
+    {
+        return m_ring.try_pop(val);
+    }
+
+    std::size_t do_size() const final
+    {
+        return m_ring.size();
+    }
+
+    bool is_full() const
+    {
+        return m_ring.is_full();
+    }
+
+    bool is_empty() const
+    {
+        return m_ring.is_empty();
+    }
+
+    detail::MpmcRing<T> m_ring;
+
+    alignas(detail::CacheLineSize) std::atomic<bool> m_is_closed{false};
+    detail::RingWaiter m_readers;
+    detail::RingWaiter m_writers;
+};
+
+}  // namespace mrc::channel
+
+namespace mrc {
+
+template <typename T>
+using MpmcChannel = channel::MpmcChannel<T>;  // NOLINT
+
+}  // namespace mrc
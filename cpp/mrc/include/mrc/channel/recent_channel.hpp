@@ -18,116 +18,166 @@
 #pragma once
 
 #include "mrc/channel/channel.hpp"
-#include "mrc/types.hpp"  // for CondV & Mutex
-
-#include <boost/fiber/mutex.hpp>
+#include "mrc/channel/detail/mpmc_ring.hpp"
+#include "mrc/channel/detail/ring_waiter.hpp"
 
+#include <algorithm>
+#include <atomic>
 #include <cstddef>  // for size_t
-#include <deque>
-#include <mutex>
-#include <thread>  // for lock_guard & unique_lock
+#include <cstdint>
 
 namespace mrc::channel {
 
+/**
+ * @brief Channel which only keeps the most recent values; writes never block and overwrite the oldest value instead.
+ *
+ * Values live in a fixed-capacity, allocation-free detail::MpmcRing. A writer which finds the channel holding max_size
+ * values pops and discards the oldest one before pushing its own, so neither writers nor readers take a lock; the
+ * fiber mutex is only acquired to park a reader on an empty channel. Values which are overwritten are counted by
+ * dropped_count(). After the channel is closed, readers drain the remaining values before observing Status::closed.
+ *
+ * @tparam T
+ */
 template <typename T>
 class RecentChannel : public Channel<T>
 {
   public:
-    RecentChannel(std::size_t count = default_channel_size()) : m_max_size(count) {}
+    RecentChannel(std::size_t count = default_channel_size()) :
+      m_max_size(std::max<std::size_t>(count, 1)),
+      m_ring(m_max_size)
+    {}
     ~RecentChannel() override = default;
 
+    /**
+     * @brief Maximum number of values held by the channel
+     */
+    std::size_t max_size() const
+    {
+        return m_max_size;
+    }
+
+    /**
+     * @brief Number of values which were overwritten before any reader consumed them
+     */
+    std::uint64_t dropped_count() const
+    {
+        return m_dropped.load(std::memory_order_relaxed);
+    }
+
   private:
     Status do_await_write(T&& data) override
     {
-        std::lock_guard<Mutex> lock(m_mutex);
-        if (m_is_shutdown)
+        if (m_is_closed.load(std::memory_order_acquire))
         {
             return Status::closed;
         }
-        if (m_deque.size() >= m_max_size)
+
+        // the ring is rounded up to a power of two, so the bound of max_size values is enforced here; with concurrent
+        // writers it is approximate, but the ring capacity is never exceeded
+        while (m_ring.size() >= m_max_size || !m_ring.try_push(data))
         {
-            m_deque.pop_front();
+            drop_oldest();
         }
-        m_deque.push_back(std::move(data));
-        m_cv.notify_one();
+
+        m_readers.notify_one();
         return Status::success;
     }
 
     Status do_await_read(T& data) override
     {
-        std::unique_lock<Mutex> lock(m_mutex);
-        while (m_deque.empty() && !m_is_shutdown)
+        while (true)
         {
-            m_cv.wait(lock, [this] {
-                return m_is_shutdown || !m_deque.empty();
+            if (m_ring.try_pop(data))
+            {
+                return Status::success;
+            }
+            if (m_is_closed.load(std::memory_order_acquire))
+            {
+                return drain_after_close(data);
+            }
+
+            m_readers.wait([this] {
+                return m_is_closed.load(std::memory_order_acquire) || !m_ring.is_empty();
             });
         }
-        if (m_is_shutdown)
-        {
-            return Status::closed;
-        }
-        data = std::move(m_deque.front());
-        m_deque.pop_front();
-        return Status::success;
     }
 
     Status do_try_read(T& data) override
     {
-        std::unique_lock<Mutex> lock(m_mutex);
-        if (m_is_shutdown)
+        if (m_ring.try_pop(data))
         {
-            return Status::closed;
+            return Status::success;
         }
-        if (m_deque.empty())
+        if (m_is_closed.load(std::memory_order_acquire))
         {
-            return Status::empty;
+            return drain_after_close(data);
         }
-        data = std::move(m_deque.front());
-        m_deque.pop_front();
-        return Status::success;
+        return Status::empty;
     }
 
     Status do_await_read_until(T& data, const time_point_t& deadline) override
     {
-        std::unique_lock<Mutex> lock(m_mutex);
-
-        while (m_deque.empty() && !m_is_shutdown && deadline < clock_t::now())
+        while (true)
         {
-            m_cv.wait_until(lock, deadline, [this] {
-                return m_is_shutdown || !m_deque.empty();
-            });
-        }
-        if (m_is_shutdown)
-        {
-            return Status::closed;
-        }
-        if (m_deque.empty())
-        {
-            return Status::timeout;
+            if (m_ring.try_pop(data))
+            {
+                return Status::success;
+            }
+            if (m_is_closed.load(std::memory_order_acquire))
+            {
+                return drain_after_close(data);
+            }
+
+            auto ready = m_readers.wait_until(
+                [this] {
+                    return m_is_closed.load(std::memory_order_acquire) || !m_ring.is_empty();
+                },
+                deadline);
+
+            if (!ready)
+            {
+                return Status::timeout;
+            }
         }
-        data = std::move(m_deque.front());
-        m_deque.pop_front();
-        return Status::success;
     }
 
     void do_close_channel() override
     {
-        std::lock_guard<Mutex> lock(m_mutex);
-        m_is_shutdown = true;
-        m_cv.notify_all();
+        m_is_closed.store(true, std::memory_order_release);
+        m_readers.notify_all();
     }
 
     bool do_is_channel_closed() const override
     {
-        std::lock_guard<Mutex> lock(m_mutex);
-        return m_is_shutdown;
+        return m_is_closed.load(std::memory_order_acquire);
+    }
+
+    std::size_t do_size() const override
+    {
+        return std::min(m_ring.size(), m_max_size);
     }
 
-    mutable Mutex m_mutex;
-    CondV m_cv;
-    bool m_is_shutdown{false};
-    std::size_t m_max_size;
-    std::deque<T> m_deque;
+    Status drain_after_close(T& data)
+    {
+        return m_ring.try_pop(data) ? Status::success : Status::closed;
+    }
+
+    void drop_oldest()
+    {
+        // a reader or another writer may take the oldest value first, in which case nothing was dropped
+        T dropped;
+        if (m_ring.try_pop(dropped))
+        {
+            m_dropped.fetch_add(1, std::memory_order_relaxed);
+        }
+    }
+
+    const std::size_t m_max_size;
+    detail::MpmcRing<T> m_ring;
+
+    alignas(detail::CacheLineSize) std::atomic<bool> m_is_closed{false};
+    std::atomic<std::uint64_t> m_dropped{0};
+    detail::RingWaiter m_readers;
 };
 
 }  // namespace mrc::channel
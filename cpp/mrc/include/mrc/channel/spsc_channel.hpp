@@ -0,0 +1,390 @@
+/**
+ * SPDX-FileCopyrightText: Copyright (c) 2023, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include "mrc/channel/channel.hpp"
+#include "mrc/channel/detail/ring_waiter.hpp"
+
+#include <boost/fiber/operations.hpp>
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <span>
+#include <utility>
+#include <vector>
+
+namespace mrc::channel {
+
+/**
+ * @brief Bounded, lock-free single-producer/single-consumer Channel.
+ *
+ * Writes and reads on the uncontended path are a single release store of the producer or consumer index. The
+ * std::mutex of the detail::RingWaiter is only acquired when the ring is full (writer parks) or empty (reader parks),
+ * which makes this channel well suited for edges where exactly one runnable writes and exactly one runnable reads.
+ *
+ * segment::Runnable swaps this channel in for the default channel of a sink when both ends of the edge are runnables
+ * launched with a single engine; a channel installed with set_channel is never replaced. It is not safe to use with
+ * more than one concurrent writer or more than one concurrent reader; use MpmcChannel or BufferedChannel for those
+ * topologies.
+ *
+ * @tparam T
+ */
+template <typename T>
+class SpscChannel final : public Channel<T>
+{
+  public:
+    SpscChannel(std::size_t buffer_size = default_channel_size()) :
+      m_capacity(detail::next_power_of_two(buffer_size)),
+      m_mask(m_capacity - 1),
+      m_buffer(m_capacity)
+    {}
+    ~SpscChannel() final = default;
+
+    std::size_t capacity() const
+    {
+        return m_capacity;
+    }
+
+  private:
+    Status do_await_write(T&& val) final
+    {
+        while (true)
+        {
+            if (m_is_closed.load(std::memory_order_acquire))
+            {
+                return Status::closed;
+            }
+            if (try_push(val))
+            {
+                m_readers.notify_one();
+                return Status::success;
+            }
+
+            // give other fibers on this thread a chance to drain the ring before parking
+            boost::this_fiber::yield();
+            if (try_push(val))
+            {
+                m_readers.notify_one();
+                return Status::success;
+            }
+
+            m_writers.wait([this] {
+                return m_is_closed.load(std::memory_order_acquire) || !is_full();
+            });
+        }
+    }
+
+    Status do_await_read(T& val) final
+    {
+        while (true)
+        {
+            if (try_pop(val))
+            {
+                m_writers.notify_one();
+                return Status::success;
+            }
+            if (m_is_closed.load(std::memory_order_acquire))
+            {
+                // drain anything written before the channel was closed
+                return drain_after_close(val);
+            }
+
+            m_readers.wait([this] {
+                return m_is_closed.load(std::memory_order_acquire) || !is_empty();
+            });
+        }
+    }
+
+    Status do_try_read(T& val) final
+    {
+        if (try_pop(val))
+        {
+            m_writers.notify_one();
+            return Status::success;
+        }
+        if (m_is_closed.load(std::memory_order_acquire))
+        {
+            return drain_after_close(val);
+        }
+        return Status::empty;
+    }
+
+    Status do_await_read_until(T& val, const time_point_t& deadline) final
+    {
+        while (true)
+        {
+            if (try_pop(val))
+            {
+                m_writers.notify_one();
+                return Status::success;
+            }
+            if (m_is_closed.load(std::memory_order_acquire))
+            {
+                return drain_after_close(val);
+            }
+
+            auto ready = m_readers.wait_until(
+                [this] {
+                    return m_is_closed.load(std::memory_order_acquire) || !is_empty();
+                },
+                deadline);
+
+            if (!ready)
+            {
+                return Status::timeout;
+            }
+        }
+    }
+
+    // writes as much of the batch as fits with a single release of the producer index and a single reader wakeup
+    Status do_await_write_batch(std::span<T> items) final
+    {
+        while (!items.empty())
+        {
+            if (m_is_closed.load(std::memory_order_acquire))
+            {
+                return Status::closed;
+            }
+
+            auto pushed = try_push_n(items);
+            if (pushed > 0)
+            {
+                m_readers.notify_one();
+                items = items.subspan(pushed);
+                continue;
+            }
+
+            boost::this_fiber::yield();
+            if (is_full())
+            {
+                m_writers.wait([this] {
+                    return m_is_closed.load(std::memory_order_acquire) || !is_full();
+                });
+            }
+        }
+        return Status::success;
+    }
+
+    Status do_await_read_up_to(std::span<T> items, std::size_t& count) final
+    {
+        count = 0;
+        if (items.empty())
+        {
+            return Status::success;
+        }
+
+        while (true)
+        {
+            count = try_pop_n(items);
+            if (count > 0)
+            {
+                m_writers.notify_one();
+                return Status::success;
+            }
+            if (m_is_closed.load(std::memory_order_acquire))
+            {
+                count = try_pop_n(items);
+                return count > 0 ? Status::success : Status::closed;
+            }
+
+            m_readers.wait([this] {
+                return m_is_closed.load(std::memory_order_acquire) || !is_empty();
+            });
+        }
+    }
+
+    Status do_await_read_up_to_until(std::span<T> items, std::size_t& count, const time_point_t& deadline) final
+    {
+        count = 0;
+        if (items.empty())
+        {
+            return Status::success;
+        }
+
+        while (true)
+        {
+            count = try_pop_n(items);
+            if (count > 0)
+            {
+                m_writers.notify_one();
+                return Status::success;
+            }
+            if (m_is_closed.load(std::memory_order_acquire))
+            {
+                count = try_pop_n(items);
+                return count > 0 ? Status::success : Status::closed;
+            }
+
+            auto ready = m_readers.wait_until(
+                [this] {
+                    return m_is_closed.load(std::memory_order_acquire) || !is_empty();
+                },
+                deadline);
+
+            if (!ready)
+            {
+                return Status::timeout;
+            }
+        }
+    }
+
+    void do_close_channel() final
+    {
+        m_is_closed.store(true, std::memory_order_release);
+        m_readers.notify_all();
+        m_writers.notify_all();
+    }
+
+    bool do_is_channel_closed() const final
+    {
+        return m_is_closed.load(std::memory_order_acquire);
+    }
+
+    Status drain_after_close(T& val)
+    {
+        if (try_pop(val))
+        {
+            m_writers.notify_one();
+            return Status::success;
+        }
+        return Status::closed;
+    }
+
+    // only called by the producer; val is only moved from on success
+    bool try_push(T& val)
+    {
+        const auto tail = m_tail.load(std::memory_order_relaxed);
+        if (tail - m_head_cache == m_capacity)
+        {
+            m_head_cache = m_head.load(std::memory_order_acquire);
+            if (tail - m_head_cache == m_capacity)
+            {
+                return false;
+            }
+        }
+        m_buffer[tail & m_mask] = std::move(val);
+        m_tail.store(tail + 1, std::memory_order_release);
+        return true;
+    }
+
+    // only called by the consumer
+    bool try_pop(T& val)
+    {
+        const auto head = m_head.load(std::memory_order_relaxed);
+        if (head == m_tail_cache)
+        {
+            m_tail_cache = m_tail.load(std::memory_order_acquire);
+            if (head == m_tail_cache)
+            {
+                return false;
+            }
+        }
+        val = std::move(m_buffer[head & m_mask]);
+        m_head.store(head + 1, std::memory_order_release);
+        return true;
+    }
+
+    // only called by the producer; returns the number of leading elements of items that were moved into the ring
+    std::size_t try_push_n(std::span<T> items)
+    {
+        const auto tail = m_tail.load(std::memory_order_relaxed);
+        auto free       = m_capacity - (tail - m_head_cache);
+        if (free < items.size())
+        {
+            m_head_cache = m_head.load(std::memory_order_acquire);
+            free         = m_capacity - (tail - m_head_cache);
+        }
+
+        const auto n = std::min(free, items.size());
+        for (std::size_t i = 0; i < n; ++i)
+        {
+            m_buffer[(tail + i) & m_mask] = std::move(items[i]);
+        }
+        if (n > 0)
+        {
+            m_tail.store(tail + n, std::memory_order_release);
+        }
+        return n;
+    }
+
+    // only called by the consumer; returns the number of elements moved into the front of items
+    std::size_t try_pop_n(std::span<T> items)
+    {
+        const auto head = m_head.load(std::memory_order_relaxed);
+        auto available  = m_tail_cache - head;
+        if (available < items.size())
+        {
+            m_tail_cache = m_tail.load(std::memory_order_acquire);
+            available    = m_tail_cache - head;
+        }
+
+        const auto n = std::min(available, items.size());
+        for (std::size_t i = 0; i < n; ++i)
+        {
+            items[i] = std::move(m_buffer[(head + i) & m_mask]);
+        }
+        if (n > 0)
+        {
+            m_head.store(head + n, std::memory_order_release);
+        }
+        return n;
+    }
+
+    std::size_t do_size() const final
+    {
+        // load the consumer index first so a concurrent read can not make the difference underflow
+        const auto head = m_head.load(std::memory_order_acquire);
+        return m_tail.load(std::memory_order_acquire) - head;
+    }
+
+    bool is_full() const
+    {
+        return m_tail.load(std::memory_order_acquire) - m_head.load(std::memory_order_acquire) == m_capacity;
+    }
+
+    bool is_empty() const
+    {
+        return m_tail.load(std::memory_order_acquire) == m_head.load(std::memory_order_acquire);
+    }
+
+    const std::size_t m_capacity;
+    const std::size_t m_mask;
+    std::vector<T> m_buffer;
+
+    // consumer owned
+    alignas(detail::CacheLineSize) std::atomic<std::size_t> m_head{0};
+    std::size_t m_tail_cache{0};
+
+    // producer owned
+    alignas(detail::CacheLineSize) std::atomic<std::size_t> m_tail{0};
+    std::size_t m_head_cache{0};
+
+    alignas(detail::CacheLineSize) std::atomic<bool> m_is_closed{false};
+    detail::RingWaiter m_readers;
+    detail::RingWaiter m_writers;
+};
+
+}  // namespace mrc::channel
+
+namespace mrc {
+
+template <typename T>
+using SpscChannel = channel::SpscChannel<T>;  // NOLINT
+
+}  // namespace mrc
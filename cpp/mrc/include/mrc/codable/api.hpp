@@ -249,4 +249,18 @@ class IDecodableStorage : public virtual IStorage
 struct ICodableStorage : public virtual IEncodableStorage, public virtual IDecodableStorage
 {};
 
+/**
+ * @brief ICodableStorage which encodes into a single contiguous buffer in a fixed layout.
+ *
+ * The bytes returned by finalize() can be sent as is and decoded in place, without a parse step, by the storage
+ * returned from IPartition::make_flat_decodable_storage.
+ */
+struct IFlatCodableStorage : public ICodableStorage
+{
+    /**
+     * @brief Complete the encoding; the returned view is invalidated if more objects are encoded
+     */
+    virtual memory::const_buffer_view finalize() = 0;
+};
+
 }  // namespace mrc::codable
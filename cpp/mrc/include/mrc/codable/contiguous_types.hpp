@@ -0,0 +1,91 @@
+/**
+ * SPDX-FileCopyrightText: Copyright (c) 2022-2023, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include "mrc/codable/codable_protocol.hpp"
+#include "mrc/codable/decode.hpp"
+#include "mrc/codable/encode.hpp"
+#include "mrc/codable/encoding_options.hpp"
+#include "mrc/memory/buffer_view.hpp"
+#include "mrc/memory/memory_kind.hpp"
+
+#include <glog/logging.h>
+
+#include <cstddef>
+#include <type_traits>
+#include <typeindex>
+#include <vector>
+
+namespace mrc::codable {
+
+/**
+ * @brief Codable protocol for std::vector<T> of trivially copyable T.
+ *
+ * The elements are encoded as a single descriptor. Unless a copy is forced, the vector's own storage is registered as a
+ * remote memory descriptor so the receiver reads the elements directly out of the sender's memory; vectors smaller than
+ * the registration threshold fall back to an eager descriptor. The vector must outlive the encoded object.
+ *
+ * std::vector<bool> is excluded as it is not contiguous.
+ */
+template <typename T>
+struct codable_protocol<std::vector<T>,
+                        std::enable_if_t<std::is_trivially_copyable_v<T> && !std::is_same_v<T, bool>>>
+{
+    static void serialize(const std::vector<T>& vec, Encoder<std::vector<T>>& encoder, const EncodingOptions& opts)
+    {
+        const memory::const_buffer_view view{vec.data(), vec.size() * sizeof(T), memory::memory_kind::host};
+
+        if (opts.force_copy())
+        {
+            auto index = encoder.create_memory_buffer(view.bytes());
+            encoder.copy_to_buffer(index, view);
+        }
+        else
+        {
+            auto idx = encoder.register_memory_view(view);
+            if (!idx)
+            {
+                encoder.copy_to_eager_descriptor(view);
+            }
+        }
+    }
+
+    static std::vector<T> deserialize(const Decoder<std::vector<T>>& decoder, std::size_t object_idx)
+    {
+        std::vector<T> vec;
+        deserialize_into(decoder, object_idx, vec);
+        return vec;
+    }
+
+    // reuses the capacity of vec; the elements are copied straight from the descriptor into vec.data()
+    static void deserialize_into(const Decoder<std::vector<T>>& decoder, std::size_t object_idx, std::vector<T>& vec)
+    {
+        DCHECK_EQ(std::type_index(typeid(std::vector<T>)).hash_code(), decoder.type_index_hash_for_object(object_idx));
+        auto idx   = decoder.start_idx_for_object(object_idx);
+        auto bytes = decoder.buffer_size(idx);
+        CHECK_EQ(bytes % sizeof(T), 0) << "descriptor size is not a multiple of the element size";
+
+        vec.resize(bytes / sizeof(T));
+        if (!vec.empty())
+        {
+            decoder.copy_from_buffer(idx, {vec.data(), bytes, memory::memory_kind::host});
+        }
+    }
+};
+
+}  // namespace mrc::codable
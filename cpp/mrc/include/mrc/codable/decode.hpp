@@ -37,6 +37,11 @@ struct Decoder final : public StorageForwarder
         return detail::deserialize<T>(sfinae::full_concept{}, *this, object_idx);
     }
 
+    void deserialize_into(T& dst, std::size_t object_idx) const
+    {
+        detail::deserialize_into<T>(sfinae::full_concept{}, *this, object_idx, dst);
+    }
+
   protected:
     void copy_from_buffer(const idx_t& idx, memory::buffer_view dst_view) const
     {
@@ -77,4 +82,18 @@ auto decode(const IDecodableStorage& encoded, std::size_t object_idx = 0)
     return decoder.deserialize(object_idx);
 }
 
+/**
+ * @brief Decode the object at object_idx into an existing object.
+ *
+ * Types whose codable_protocol provides a deserialize_into method reuse the storage already held by dst, e.g. the
+ * capacity of a std::vector or the allocation of a memory::buffer, so the encoded bytes are copied (or RDMA read)
+ * directly into the caller's memory; all other types are decoded into a new object which is move-assigned to dst.
+ */
+template <typename T>
+void decode_into(const IDecodableStorage& encoded, T& dst, std::size_t object_idx = 0)
+{
+    Decoder<T> decoder(encoded);
+    decoder.deserialize_into(dst, object_idx);
+}
+
 }  // namespace mrc::codable
@@ -71,6 +71,21 @@ sfinae::error deserialize(sfinae::error error, const Decoder<T>& encoding, std::
     return {};
 }
 
+// decode into an existing object when the protocol supports it; otherwise decode a new object and move-assign it
+template <typename T>
+auto deserialize_into(sfinae::full_concept c, const Decoder<T>& encoding, std::size_t object_idx, T& dst)
+    -> MRC_AUTO_RETURN_TYPE(codable_protocol<T>::deserialize_into(encoding, object_idx, dst), void);
+
+template <typename T>
+auto deserialize_into(sfinae::l4_concept c, const Decoder<T>& encoding, std::size_t object_idx, T& dst)
+    -> MRC_AUTO_RETURN_TYPE(T::deserialize_into(encoding, object_idx, dst), void);
+
+template <typename T>
+void deserialize_into(sfinae::error error, const Decoder<T>& encoding, std::size_t object_idx, T& dst)
+{
+    dst = deserialize<T>(sfinae::full_concept{}, encoding, object_idx);
+}
+
 }  // namespace detail
 
 template <typename T, typename = void>
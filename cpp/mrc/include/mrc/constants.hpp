@@ -20,6 +20,7 @@
 #define MRC_DEFAULT_BUFFERED_CHANNEL_SIZE 128
 #define MRC_DEFAULT_FIBER_PRIORITY 0
 #define MRC_MAX_EAGER_BUFFER_SIZE 128
+#define MRC_SINK_READ_BATCH_SIZE 32
 
 #define PORT_ID_MAX UINT16_MAX
 #define SEGMENT_ID_MAX UINT16_MAX
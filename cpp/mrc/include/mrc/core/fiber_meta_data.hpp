@@ -19,6 +19,8 @@
 
 #include "mrc/constants.hpp"
 
+#include <cstdint>
+
 namespace mrc {
 
 /**
@@ -27,6 +29,11 @@ namespace mrc {
 struct FiberMetaData
 {
     int priority{MRC_DEFAULT_FIBER_PRIORITY};
+
+    // allow the fiber to be stolen by another thread of the FiberPool with this steal group id, as reported by the
+    // pool; zero keeps the fiber on the thread which launched it. Only honored when work stealing is enabled via
+    // FiberPoolOptions::enable_work_stealing
+    std::uint32_t steal_group{0};
 };
 
 }  // namespace mrc
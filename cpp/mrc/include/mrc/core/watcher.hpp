@@ -17,6 +17,7 @@
 
 #pragma once
 
+#include <atomic>
 #include <memory>
 #include <set>
 
@@ -47,32 +48,54 @@ struct WatcherInterface
     virtual void on_exit(const WatchableEvent&, bool, const void*) = 0;
 };
 
+/**
+ * @brief Base for objects which notify attached WatcherInterfaces on entry to and exit from their hot paths.
+ *
+ * Watchers are expected to be attached before the object starts processing data, e.g. by benchmarking::SegmentWatcher.
+ * Objects without any watcher only pay for a single relaxed load per event, so tracing can stay compiled in for
+ * production builds; defining MRC_TRACING_DISABLED removes the channel events entirely.
+ */
 class Watchable
 {
   public:
     void add_watcher(std::shared_ptr<WatcherInterface> /*obs*/);
     void remove_watcher(std::shared_ptr<WatcherInterface> /*obs*/);
 
+    bool has_watchers() const;
+
   protected:
     inline void watcher_prologue(WatchableEvent /*op*/, const void* addr);
     inline void watcher_epilogue(WatchableEvent /*op*/, bool /*rc*/, const void* addr);
 
   private:
     std::set<std::shared_ptr<WatcherInterface>> m_watchers;
+    std::atomic<bool> m_has_watchers{false};
 };
 
 inline void Watchable::add_watcher(std::shared_ptr<WatcherInterface> obs)
 {
     m_watchers.insert(obs);
+    m_has_watchers.store(true, std::memory_order_relaxed);
 }
 
 inline void Watchable::remove_watcher(std::shared_ptr<WatcherInterface> obs)
 {
     m_watchers.erase(obs);
+    m_has_watchers.store(!m_watchers.empty(), std::memory_order_relaxed);
+}
+
+inline bool Watchable::has_watchers() const
+{
+    return m_has_watchers.load(std::memory_order_relaxed);
 }
 
 inline void Watchable::watcher_prologue(WatchableEvent op, const void* addr)
 {
+    if (!has_watchers())
+    {
+        return;
+    }
+
     for (const auto& obs : m_watchers)
     {
         obs->on_entry(op, addr);
@@ -81,6 +104,11 @@ inline void Watchable::watcher_prologue(WatchableEvent op, const void* addr)
 
 inline void Watchable::watcher_epilogue(WatchableEvent op, bool rc, const void* addr)
 {
+    if (!has_watchers())
+    {
+        return;
+    }
+
     for (const auto& obs : m_watchers)
     {
         obs->on_exit(op, rc, addr);
@@ -0,0 +1,154 @@
+/**
+ * SPDX-FileCopyrightText: Copyright (c) 2023, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <coroutine>
+#include <cstddef>
+#include <cstdint>
+
+namespace mrc::coroutines::detail {
+
+/**
+ * @brief Bounded, lock-free FIFO of coroutine handles owned by a single ThreadPool worker.
+ *
+ * Only the owning worker may push; the owner and any number of thieves may pop. Pops claim items by advancing the head
+ * index with a CAS, so the owner and thieves contend on a single cache line only when the queue is nearly empty. When
+ * the queue is full, push() fails and the caller is expected to spill into the pool's shared injection queue.
+ *
+ * Slots are atomics so a thief reading a slot concurrently with the owner overwriting it is not a data race; the value
+ * read is discarded whenever the subsequent CAS on the head fails.
+ */
+class WorkerQueue
+{
+  public:
+    static constexpr std::size_t Capacity = 256;
+
+    /**
+     * @brief Push a handle onto the tail of the queue; must only be called by the owning worker.
+     * @return false if the queue is full
+     */
+    bool push(std::coroutine_handle<> handle) noexcept
+    {
+        const auto tail = m_tail.load(std::memory_order_relaxed);
+        const auto head = m_head.load(std::memory_order_acquire);
+
+        if (tail - head >= Capacity)
+        {
+            return false;
+        }
+
+        m_slots[tail & Mask].store(handle.address(), std::memory_order_relaxed);
+        m_tail.store(tail + 1, std::memory_order_release);
+        return true;
+    }
+
+    /**
+     * @brief Pop the handle at the head of the queue; safe to call from any thread.
+     * @return the popped handle or nullptr if the queue is empty
+     */
+    std::coroutine_handle<> pop() noexcept
+    {
+        auto head = m_head.load(std::memory_order_acquire);
+
+        while (true)
+        {
+            const auto tail = m_tail.load(std::memory_order_acquire);
+            if (head == tail)
+            {
+                return nullptr;
+            }
+
+            auto* address = m_slots[head & Mask].load(std::memory_order_relaxed);
+            if (m_head.compare_exchange_weak(head, head + 1, std::memory_order_acq_rel, std::memory_order_acquire))
+            {
+                return std::coroutine_handle<>::from_address(address);
+            }
+        }
+    }
+
+    /**
+     * @brief Move up to half of the handles in this queue into dst, which must be owned by the calling worker.
+     *
+     * The first stolen handle is returned to the caller rather than pushed so the thief can run it immediately.
+     *
+     * @return the first stolen handle or nullptr if nothing could be stolen
+     */
+    std::coroutine_handle<> steal_into(WorkerQueue& dst) noexcept
+    {
+        std::array<void*, Capacity / 2> stolen;
+        std::size_t count = 0;
+
+        auto head = m_head.load(std::memory_order_acquire);
+
+        while (true)
+        {
+            const auto tail      = m_tail.load(std::memory_order_acquire);
+            const auto available = tail - head;
+            if (available == 0)
+            {
+                return nullptr;
+            }
+
+            count = available - available / 2;
+            for (std::size_t i = 0; i < count; ++i)
+            {
+                stolen[i] = m_slots[(head + i) & Mask].load(std::memory_order_relaxed);
+            }
+
+            if (m_head.compare_exchange_weak(head, head + count, std::memory_order_acq_rel, std::memory_order_acquire))
+            {
+                break;
+            }
+        }
+
+        // dst is empty whenever its owner is stealing, and count never exceeds half its capacity
+        for (std::size_t i = 1; i < count; ++i)
+        {
+            dst.push(std::coroutine_handle<>::from_address(stolen[i]));
+        }
+
+        return std::coroutine_handle<>::from_address(stolen[0]);
+    }
+
+    /**
+     * @brief Approximate number of queued handles
+     */
+    std::size_t size() const noexcept
+    {
+        const auto head = m_head.load(std::memory_order_acquire);
+        const auto tail = m_tail.load(std::memory_order_acquire);
+        return tail >= head ? tail - head : 0;
+    }
+
+    bool empty() const noexcept
+    {
+        return size() == 0;
+    }
+
+  private:
+    static constexpr std::uint64_t Mask = Capacity - 1;
+    static_assert((Capacity & Mask) == 0, "Capacity must be a power of two");
+
+    alignas(64) std::atomic<std::uint64_t> m_head{0};
+    alignas(64) std::atomic<std::uint64_t> m_tail{0};
+    std::array<std::atomic<void*>, Capacity> m_slots{};
+};
+
+}  // namespace mrc::coroutines::detail
@@ -39,16 +39,17 @@
 #pragma once
 
 #include "mrc/coroutines/concepts/range_of.hpp"
+#include "mrc/coroutines/detail/worker_queue.hpp"
 #include "mrc/coroutines/task.hpp"
 
 #include <atomic>
-#include <condition_variable>
 #include <coroutine>
 #include <cstddef>
 #include <cstdint>
 #include <deque>
 #include <functional>
 #include <iterator>
+#include <memory>
 #include <mutex>
 #include <stop_token>
 #include <string>
@@ -61,6 +62,13 @@ namespace mrc::coroutines {
  * Creates a thread pool that executes arbitrary coroutine tasks in a FIFO scheduler policy.
  * The thread pool by default will create an execution thread per available core on the system.
  *
+ * Each executor thread owns a lock-free local queue. Tasks scheduled from an executor thread are pushed to that
+ * thread's local queue, while tasks scheduled from outside the pool go through a shared injection queue. A coroutine
+ * resumed from an executor thread, e.g. the continuation of an awaited event, is placed in the thread's LIFO slot and
+ * runs next on the same thread while its data is still hot in cache; further coroutines resumed by the same task are
+ * queued behind it in order. Idle executor threads steal half of another thread's local queue before parking on a
+ * per-thread futex.
+ *
  * When shutting down, either by the thread pool destructing or by manually calling shutdown()
  * the thread pool will stop accepting new tasks but will complete all tasks that were scheduled
  * prior to the shutdown request.
@@ -196,19 +204,17 @@ class ThreadPool
         m_size.fetch_add(std::size(handles), std::memory_order::release);
 
         size_t null_handles{0};
+        bool shared{false};
 
+        for (const auto& handle : handles)
         {
-            std::scoped_lock lk{m_wait_mutex};
-            for (const auto& handle : handles)
+            if (handle != nullptr) [[likely]]
+            {
+                shared |= push(handle, false);
+            }
+            else
             {
-                if (handle != nullptr) [[likely]]
-                {
-                    m_queue.emplace_back(handle);
-                }
-                else
-                {
-                    ++null_handles;
-                }
+                ++null_handles;
             }
         }
 
@@ -217,7 +223,10 @@ class ThreadPool
             m_size.fetch_sub(null_handles, std::memory_order::release);
         }
 
-        m_wait_cv.notify_one();
+        if (shared)
+        {
+            wake_one();
+        }
     }
 
     /**
@@ -260,8 +269,13 @@ class ThreadPool
     auto queue_size() const noexcept -> std::size_t
     {
         // Might not be totally perfect but good enough, avoids acquiring the lock for now.
-        std::atomic_thread_fence(std::memory_order::acquire);
-        return m_queue.size();
+        auto size = m_injection_size.load(std::memory_order::acquire);
+        for (const auto& worker : m_workers)
+        {
+            size += worker->queue.size();
+            size += worker->lifo_slot.load(std::memory_order::relaxed) != nullptr ? 1 : 0;
+        }
+        return size;
     }
 
     /**
@@ -295,12 +309,33 @@ class ThreadPool
     /// The background executor threads.
     std::vector<std::jthread> m_threads;
 
-    /// Mutex for executor threads to sleep on the condition variable.
-    std::mutex m_wait_mutex;
-    /// Condition variable for each executor thread to wait on when no tasks are available.
-    std::condition_variable_any m_wait_cv;
-    /// FIFO queue of tasks waiting to be executed.
-    std::deque<std::coroutine_handle<>> m_queue;
+    /// Per executor thread scheduling state; only the owning thread pushes to its queue or touches its LIFO slot.
+    struct Worker
+    {
+        /// Tasks scheduled from this executor thread; other executor threads may steal from it.
+        detail::WorkerQueue queue;
+        /// The first coroutine resumed by the running task, run before anything in the local queue. Never stolen.
+        std::atomic<void*> lifo_slot{nullptr};
+        /// Number of consecutive tasks taken from the LIFO slot.
+        std::uint32_t lifo_polls{0};
+        /// Number of tasks taken, used to periodically poll the injection queue.
+        std::uint32_t tick{0};
+        /// 1 while the executor thread is parked or about to park; wakers reset it to 0 and notify.
+        alignas(64) std::atomic<std::uint32_t> parked{0};
+    };
+
+    /// Per executor thread state, indexed by thread id.
+    std::vector<std::unique_ptr<Worker>> m_workers;
+
+    /// Mutex guarding the injection queue.
+    std::mutex m_injection_mutex;
+    /// FIFO queue of tasks scheduled from threads outside of the pool or spilled from a full local queue.
+    std::deque<std::coroutine_handle<>> m_injection_queue;
+    /// Size of the injection queue, readable without the lock.
+    std::atomic<std::size_t> m_injection_size{0};
+    /// Number of executor threads currently parked.
+    std::atomic<std::size_t> m_parked_count{0};
+
     /**
      * Each background thread runs from this function.
      * @param stop_token Token which signals when shutdown() has been called.
@@ -313,6 +348,38 @@ class ThreadPool
      */
     auto schedule_impl(std::coroutine_handle<> handle) noexcept -> void;
 
+    /**
+     * Queues a handle without waking a parked executor thread.
+     * @param handle The coroutine to queue.
+     * @param lifo Place the handle in the calling executor thread's LIFO slot.
+     * @return True if a handle was made available to other executor threads and one should be woken.
+     */
+    auto push(std::coroutine_handle<> handle, bool lifo) noexcept -> bool;
+
+    /// Pushes a handle onto the shared injection queue.
+    auto inject(std::coroutine_handle<> handle) noexcept -> void;
+
+    /// Finds the next handle for the worker: LIFO slot, local queue, injection queue, then other workers' queues.
+    auto next_handle(Worker& worker, std::size_t idx) noexcept -> std::coroutine_handle<>;
+
+    /// Pops from the injection queue, moving a batch of additional handles into the worker's local queue.
+    auto pop_injected(Worker& worker) noexcept -> std::coroutine_handle<>;
+
+    /// Steals half of another worker's local queue.
+    auto steal(Worker& worker, std::size_t idx) noexcept -> std::coroutine_handle<>;
+
+    /// Parks the worker until it is woken or shutdown is requested, unless work is available.
+    auto park(Worker& worker, const std::stop_token& stop_token) noexcept -> void;
+
+    /// Wakes one parked executor thread, if any.
+    auto wake_one() noexcept -> void;
+
+    /// Wakes the given worker if it is parked.
+    auto unpark(Worker& worker) noexcept -> void;
+
+    /// The calling thread's worker if it is an executor thread of this pool; otherwise nullptr.
+    auto current_worker() noexcept -> Worker*;
+
     /// The number of tasks in the queue + currently executing.
     std::atomic<std::size_t> m_size{0};
     /// Has the thread pool been requested to shut down?
@@ -107,6 +107,22 @@ class ReusablePool final : public std::enable_shared_from_this<ReusablePool<T>>
         return Reusable<T>(std::move(item), this->shared_from_this());
     }
 
+    /**
+     * @brief Non-blocking variant of await_item
+     *
+     * @return true if an item was available and was moved into item, false if all items are in use
+     */
+    bool try_item(Reusable<T>& item)
+    {
+        item_t data;
+        if (m_channel.try_pop(data) != boost::fibers::channel_op_status::success)
+        {
+            return false;
+        }
+        item = Reusable<T>(std::move(data), this->shared_from_this());
+        return true;
+    }
+
     /**
      * @brief Number of items managed by the pool
      */
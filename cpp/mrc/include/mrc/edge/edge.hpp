@@ -114,6 +114,12 @@ class EdgeBase
         return m_is_connected;
     }
 
+    // Number of times this edge has been connected. Greater than one when several upstreams share the same edge
+    std::size_t connection_count() const
+    {
+        return m_connection_count;
+    }
+
     void add_connector(std::function<void()>&& on_connect_fn)
     {
         this->add_connector(EdgeLifetime(std::move(on_connect_fn), true));
@@ -141,6 +147,7 @@ class EdgeBase
     void connect()
     {
         m_is_connected = true;
+        ++m_connection_count;
 
         // Clear the connectors to execute them
         m_connectors.clear();
@@ -170,6 +177,7 @@ class EdgeBase
 
   private:
     bool m_is_connected{false};
+    std::size_t m_connection_count{0};
     std::vector<EdgeLifetime> m_connectors;
     std::vector<EdgeLifetime> m_disconnectors;
     std::vector<std::shared_ptr<EdgeBase>> m_linked_edges;
@@ -86,6 +86,7 @@ struct EdgeBuilder final
     static void make_edge_writable(IWritableAcceptor<SourceT>& source, IWritableProvider<SinkT>& sink)
     {
         constexpr bool IsConvertable = std::is_convertible_v<SourceT, SinkT>;
+        constexpr bool IsArithmetic  = std::is_arithmetic_v<SourceT> && std::is_arithmetic_v<SinkT>;
         constexpr bool LessBits      = sizeof(SourceT) > sizeof(SinkT);  // Sink requires more bits than source.
         constexpr bool FloatToInt    = std::is_floating_point_v<SourceT> && std::is_integral_v<SinkT>;  // float -> int
         constexpr bool SignedToUnsigned = std::is_signed_v<SourceT> && !std::is_signed_v<SinkT>;  // signed -> unsigned
@@ -93,8 +94,9 @@ struct EdgeBuilder final
                                                   (sizeof(SourceT) == sizeof(SinkT));  // Unsigned component could
                                                                                        // exceed signed limits
 
-        // If its convertable but may result in loss of data, it requires narrowing
-        constexpr bool RequiresNarrowing = IsConvertable &&
+        // If its convertable but may result in loss of data, it requires narrowing. Only arithmetic conversions can
+        // narrow; class types such as edge::SharedPayload convert through user defined operators
+        constexpr bool RequiresNarrowing = IsConvertable && IsArithmetic &&
                                            (LessBits || FloatToInt || SignedToUnsigned || UnsignedToSignedLessBits);
 
         std::shared_ptr<WritableEdgeHandle> edge;
@@ -133,6 +135,7 @@ struct EdgeBuilder final
     static void make_edge_readable(IReadableProvider<SourceT>& source, IReadableAcceptor<SinkT>& sink)
     {
         constexpr bool IsConvertable = std::is_convertible_v<SinkT, SourceT>;
+        constexpr bool IsArithmetic  = std::is_arithmetic_v<SourceT> && std::is_arithmetic_v<SinkT>;
         constexpr bool LessBits      = sizeof(SinkT) > sizeof(SourceT);  // Sink requires more bits than source.
         constexpr bool FloatToInt    = std::is_floating_point_v<SourceT> && std::is_integral_v<SinkT>;  // float -> int
         constexpr bool SignedToUnsigned = std::is_signed_v<SinkT> && !std::is_signed_v<SourceT>;  // signed -> unsigned
@@ -140,8 +143,9 @@ struct EdgeBuilder final
                                                   (sizeof(SourceT) == sizeof(SinkT));  // Unsigned component could
                                                                                        // exceed signed limits
 
-        // If its convertable but may result in loss of data, it requires narrowing
-        constexpr bool RequiresNarrowing = IsConvertable &&
+        // If its convertable but may result in loss of data, it requires narrowing. Only arithmetic conversions can
+        // narrow; class types such as edge::SharedPayload convert through user defined operators
+        constexpr bool RequiresNarrowing = IsConvertable && IsArithmetic &&
                                            (LessBits || FloatToInt || SignedToUnsigned || UnsignedToSignedLessBits);
 
         std::shared_ptr<ReadableEdgeHandle> edge;
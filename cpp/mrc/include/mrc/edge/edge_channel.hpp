@@ -21,7 +21,9 @@
 #include "mrc/edge/edge_writable.hpp"
 #include "mrc/edge/forward.hpp"
 
+#include <cstddef>
 #include <memory>
+#include <span>
 
 namespace mrc::edge {
 
@@ -44,6 +46,18 @@ class EdgeChannelReader : public IEdgeReadable<T>
         return m_channel->await_read(t);
     }
 
+    channel::Status await_read_up_to(std::span<T> items, std::size_t& count) override
+    {
+        return m_channel->await_read_up_to(items, count);
+    }
+
+    channel::Status await_read_up_to(std::span<T> items,
+                                     std::size_t& count,
+                                     const channel::time_point_t& tp) override
+    {
+        return m_channel->await_read_up_to(items, count, tp);
+    }
+
   private:
     EdgeChannelReader(std::shared_ptr<mrc::channel::Channel<T>> channel) : m_channel(std::move(channel)) {}
 
@@ -71,6 +85,16 @@ class EdgeChannelWriter : public IEdgeWritable<T>
         return m_channel->await_write(std::move(t));
     }
 
+    channel::Status await_write_batch(std::span<T> items) override
+    {
+        return m_channel->await_write_batch(items);
+    }
+
+    std::size_t queue_depth() const override
+    {
+        return m_channel->size();
+    }
+
   private:
     EdgeChannelWriter(std::shared_ptr<mrc::channel::Channel<T>> channel) : m_channel(std::move(channel)) {}
 
@@ -91,6 +115,20 @@ class EdgeChannel
     }
     virtual ~EdgeChannel() = default;
 
+    // Points an existing reader/writer pair at a new channel. Only valid before any data has been written to the
+    // current channel, i.e. after edges have been formed but before the owning runnables are launched
+    static void rebind(EdgeChannelReader<T>& reader,
+                       EdgeChannelWriter<T>& writer,
+                       std::unique_ptr<mrc::channel::Channel<T>> channel)
+    {
+        CHECK(channel) << "Cannot rebind an EdgeChannel to an empty pointer";
+        CHECK(reader.m_channel == writer.m_channel) << "Reader and writer do not share a channel";
+
+        std::shared_ptr<mrc::channel::Channel<T>> shared_channel(std::move(channel));
+        reader.m_channel = shared_channel;
+        writer.m_channel = std::move(shared_channel);
+    }
+
     [[nodiscard]] std::shared_ptr<EdgeChannelReader<T>> get_reader() const
     {
         return std::shared_ptr<EdgeChannelReader<T>>(new EdgeChannelReader<T>(m_channel));
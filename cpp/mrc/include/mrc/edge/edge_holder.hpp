@@ -197,6 +197,24 @@ class EdgeHolder
     friend class MultiEdgeHolder;
 };
 
+namespace detail {
+
+// Keys are only streamed into error messages; scoped enums have no operator<< so print their underlying value
+template <typename KeyT>
+decltype(auto) printable_key(const KeyT& key)
+{
+    if constexpr (std::is_enum_v<KeyT>)
+    {
+        return static_cast<std::underlying_type_t<KeyT>>(key);
+    }
+    else
+    {
+        return (key);
+    }
+}
+
+}  // namespace detail
+
 template <typename KeyT, typename T>
 class MultiEdgeHolder
 {
@@ -281,7 +299,7 @@ class MultiEdgeHolder
                 return m_edges[key];
             }
 
-            throw std::runtime_error(MRC_CONCAT_STR("Could not find edge pair for key: " << key));
+            throw std::runtime_error(MRC_CONCAT_STR("Could not find edge pair for key: " << detail::printable_key(key)));
         }
 
         return found->second;
@@ -293,7 +311,7 @@ class MultiEdgeHolder
 
         if (found == m_edges.end())
         {
-            throw std::runtime_error(MRC_CONCAT_STR("Could not find edge pair for key: " << key));
+            throw std::runtime_error(MRC_CONCAT_STR("Could not find edge pair for key: " << detail::printable_key(key)));
         }
 
         return found->second;
@@ -305,7 +323,7 @@ class MultiEdgeHolder
 
         if (found == m_edges.end())
         {
-            throw std::runtime_error(MRC_CONCAT_STR("Could not find edge pair for key: " << key));
+            throw std::runtime_error(MRC_CONCAT_STR("Could not find edge pair for key: " << detail::printable_key(key)));
         }
 
         return found->second;
@@ -36,6 +36,7 @@
 #include <memory>
 #include <mutex>
 #include <optional>
+#include <span>
 #include <stdexcept>
 #include <type_traits>
 #include <typeindex>
@@ -62,6 +63,33 @@ class IEdgeReadable : public virtual Edge<T>, public IEdgeReadableBase
     }
 
     virtual channel::Status await_read(T& t) = 0;
+
+    // Blocks until at least one element is available and reads up to items.size() elements. The default
+    // implementation reads a single element; edges backed by a channel override this to drain whatever is already
+    // buffered in the same call.
+    virtual channel::Status await_read_up_to(std::span<T> items, std::size_t& count)
+    {
+        count = 0;
+        if (items.empty())
+        {
+            return channel::Status::success;
+        }
+
+        auto rc = this->await_read(items[0]);
+        if (rc == channel::Status::success)
+        {
+            count = 1;
+        }
+        return rc;
+    }
+
+    // Same as await_read_up_to, but gives up with Status::timeout if nothing is available before the deadline. The
+    // default implementation cannot wait with a deadline; like the overload without one, it blocks until a single
+    // element is read and never returns Status::timeout.
+    virtual channel::Status await_read_up_to(std::span<T> items, std::size_t& count, const channel::time_point_t& tp)
+    {
+        return this->await_read_up_to(items, count);
+    }
 };
 
 template <typename InputT, typename OutputT = InputT>
@@ -36,6 +36,7 @@
 #include <memory>
 #include <mutex>
 #include <optional>
+#include <span>
 #include <stdexcept>
 #include <type_traits>
 #include <typeindex>
@@ -70,6 +71,28 @@ class IEdgeWritable : public virtual Edge<T>, public virtual IEdgeWritableBase
     {
         return await_write(std::move(data));
     }
+
+    // Writes each element of items in order, moving from them. Edges backed by a channel override this to write the
+    // whole batch under one synchronization point. On a non-success status only a prefix of items was written.
+    virtual channel::Status await_write_batch(std::span<T> items)
+    {
+        for (auto& item : items)
+        {
+            auto rc = this->await_write(std::move(item));
+            if (rc != channel::Status::success)
+            {
+                return rc;
+            }
+        }
+        return channel::Status::success;
+    }
+
+    // Approximate number of items written to this edge which the downstream has not consumed yet. Only edges which
+    // end in a channel can report this; all others return 0.
+    virtual std::size_t queue_depth() const
+    {
+        return 0;
+    }
 };
 
 template <typename InputT, typename OutputT = InputT>
@@ -84,6 +107,11 @@ class ConvertingEdgeWritableBase : public IEdgeWritable<InputT>
         this->add_linked_edge(downstream);
     }
 
+    std::size_t queue_depth() const override
+    {
+        return m_downstream->queue_depth();
+    }
+
   protected:
     inline IEdgeWritable<OutputT>& downstream() const
     {
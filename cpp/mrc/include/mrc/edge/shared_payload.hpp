@@ -0,0 +1,153 @@
+/**
+ * SPDX-FileCopyrightText: Copyright (c) 2023, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include "mrc/edge/edge_adapter_registry.hpp"
+#include "mrc/edge/edge_connector.hpp"
+
+#include <glog/logging.h>
+
+#include <memory>
+#include <mutex>
+#include <type_traits>
+#include <typeindex>
+#include <utility>
+
+namespace mrc::edge {
+
+/**
+ * @brief Reference counted, immutable envelope around a value which is shared by multiple downstream edges.
+ *
+ * Copying a SharedPayload only increments a reference count. Consumers which only read the value can accept a
+ * SharedPayload<T> or a std::shared_ptr<const T> and never copy it. Consumers which need a mutable T convert the
+ * payload to a T, which copies the value only if another consumer still holds a reference to it (copy-on-write); the
+ * last holder receives the value by move.
+ */
+template <typename T>
+class SharedPayload
+{
+  public:
+    using value_type = T;
+
+    SharedPayload() = default;
+
+    explicit SharedPayload(T&& value) : m_value(std::make_shared<T>(std::move(value))) {}
+
+    const T& get() const
+    {
+        DCHECK(m_value) << "SharedPayload is empty";
+        return *m_value;
+    }
+
+    const T& operator*() const
+    {
+        return get();
+    }
+
+    const T* operator->() const
+    {
+        return &get();
+    }
+
+    explicit operator bool() const
+    {
+        return static_cast<bool>(m_value);
+    }
+
+    std::shared_ptr<const T> share() const
+    {
+        return m_value;
+    }
+
+    long use_count() const
+    {
+        return m_value.use_count();
+    }
+
+    /**
+     * @brief Extract a mutable T, moving it out of the envelope if this is the only reference and copying otherwise.
+     * The payload is empty afterwards.
+     */
+    T take() &&
+    {
+        auto value = std::move(m_value);
+
+        if constexpr (std::is_default_constructible_v<T>)
+        {
+            if (!value)
+            {
+                return T{};
+            }
+        }
+        CHECK(value) << "cannot take the value of an empty SharedPayload";
+
+        // no other SharedPayload can be created from this one while it is the sole owner, so the count is exact here
+        if (value.use_count() == 1)
+        {
+            return std::move(*value);
+        }
+        return *value;
+    }
+
+    operator T() &&  // NOLINT(google-explicit-constructor)
+    {
+        return std::move(*this).take();
+    }
+
+    operator std::shared_ptr<const T>() const  // NOLINT(google-explicit-constructor)
+    {
+        return share();
+    }
+
+  private:
+    // the value is never modified through a shared reference; it is held as non-const so the last owner may move it
+    std::shared_ptr<T> m_value;
+};
+
+/**
+ * @brief Registers the edge converters which unwrap a SharedPayload<T> for sinks of type T and
+ * std::shared_ptr<const T>. Safe to call multiple times.
+ */
+template <typename T>
+struct SharedPayloadConnector
+{
+    SharedPayloadConnector() = delete;
+
+    static void register_converters()
+    {
+        static std::once_flag s_once;
+
+        std::call_once(s_once, [] {
+            register_converter<T>();
+            register_converter<std::shared_ptr<const T>>();
+        });
+    }
+
+  private:
+    template <typename OutputT>
+    static void register_converter()
+    {
+        // the converters may already have been registered by other means, e.g. via EdgeConnector
+        if (!EdgeAdapterRegistry::has_ingress_converter(typeid(SharedPayload<T>), typeid(OutputT)))
+        {
+            EdgeConnector<SharedPayload<T>, OutputT>::register_converter();
+        }
+    }
+};
+
+}  // namespace mrc::edge
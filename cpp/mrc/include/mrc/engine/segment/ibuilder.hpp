@@ -24,6 +24,9 @@
 #include <memory>
 #include <string>
 
+namespace mrc::metrics {
+class NodeMetrics;
+}  // namespace mrc::metrics
 namespace mrc::runnable {
 class Launchable;
 }  // namespace mrc::runnable
@@ -58,6 +61,7 @@ class IBuilder final
     std::shared_ptr<::mrc::segment::IngressPortBase> get_ingress_base(const std::string& name);
     std::shared_ptr<::mrc::segment::EgressPortBase> get_egress_base(const std::string& name);
     std::function<void(std::int64_t)> make_throughput_counter(const std::string& name);
+    std::shared_ptr<metrics::NodeMetrics> make_node_metrics(const std::string& name);
 
   private:
     Builder* m_impl;
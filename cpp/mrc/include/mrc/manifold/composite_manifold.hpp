@@ -25,6 +25,13 @@
 
 namespace mrc::manifold {
 
+/**
+ * @brief Manifold composed of an ingress, which accepts the upstream segments, and an egress, which writes to the
+ * downstream segments.
+ *
+ * Derived classes are responsible for connecting the ingress to the egress, either directly or through a progress
+ * engine which they start and join.
+ */
 template <typename IngressT, typename EgressT>
 class CompositeManifold : public Manifold
 {
@@ -40,9 +47,6 @@ class CompositeManifold : public Manifold
             .enqueue([this] {
                 m_ingress = std::make_unique<IngressT>();
                 m_egress  = std::make_unique<EgressT>();
-
-                // Then link them together
-                mrc::make_edge(*m_ingress, *m_egress);
             })
             .get();
     }
@@ -53,10 +57,7 @@ class CompositeManifold : public Manifold
       Manifold(std::move(port_name), resources),
       m_ingress(std::move(ingress)),
       m_egress(std::move(egress))
-    {
-        // Already created, link them together
-        mrc::make_edge(*m_ingress, *m_egress);
-    }
+    {}
 
   protected:
     IngressT& ingress()
@@ -17,17 +17,26 @@
 
 #pragma once
 
+#include "mrc/channel/status.hpp"
 #include "mrc/edge/edge_builder.hpp"
+#include "mrc/edge/edge_writable.hpp"
 #include "mrc/manifold/interface.hpp"
+#include "mrc/manifold/load_balancing_policy.hpp"
 #include "mrc/node/operators/muxer.hpp"
 #include "mrc/node/operators/router.hpp"
 #include "mrc/node/sink_properties.hpp"
 #include "mrc/node/source_properties.hpp"
 #include "mrc/types.hpp"
 
+#include <glog/logging.h>
+
+#include <algorithm>
 #include <cstddef>
 #include <memory>
+#include <mutex>
 #include <random>
+#include <utility>
+#include <vector>
 
 namespace mrc::manifold {
 
@@ -90,4 +99,88 @@ class RoundRobinEgress : public node::Router<SegmentAddress, T>, public TypedEgr
     std::vector<SegmentAddress> m_pick_list;
 };
 
+/**
+ * @brief Egress which picks the downstream segment for each value with a LoadBalancingPolicy.
+ *
+ * Unlike RoundRobinEgress, await_write may be called concurrently by multiple progress engines. Only the selection of
+ * the output is serialized; the write itself, which may block on a full downstream channel, happens outside the lock.
+ */
+template <typename T>
+class BalancedEgress : public node::RouterBase<SegmentAddress, T>, public TypedEgress<T>
+{
+  public:
+    BalancedEgress() : m_policy(make_load_balancing_policy(default_load_balancing_policy())) {}
+
+    void set_policy(std::unique_ptr<LoadBalancingPolicy> policy)
+    {
+        CHECK(policy);
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_policy = std::move(policy);
+    }
+
+    channel::Status await_write(T&& data)
+    {
+        std::shared_ptr<edge::IEdgeWritable<T>> output;
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            CHECK(!m_outputs.empty()) << "no egress outputs on load-balancer";
+
+            auto idx = m_policy->select(m_outputs.size(), [this](std::size_t i) {
+                return m_outputs[i]->queue_depth();
+            });
+
+            CHECK_LT(idx, m_outputs.size());
+            output = m_outputs[idx];
+        }
+        return output->await_write(std::move(data));
+    }
+
+    /**
+     * @brief Drop all downstream connections, closing the downstream channels once no other writers remain
+     */
+    void release_outputs()
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_outputs.clear();
+        this->release_edge_connections();
+    }
+
+  protected:
+    channel::Status on_next(T&& data) override
+    {
+        return await_write(std::move(data));
+    }
+
+  private:
+    void do_add_output(const SegmentAddress& address, edge::IWritableProvider<T>* sink) override
+    {
+        mrc::make_edge(*this->get_source(address), *sink);
+
+        std::lock_guard<std::mutex> lock(m_mutex);
+        update_outputs();
+    }
+
+    // requires m_mutex
+    void update_outputs()
+    {
+        auto keys = this->edge_connection_keys();
+
+        // shuffle so that the manifolds of different segments do not all favor the same downstream segment on ties
+        std::shuffle(keys.begin(), keys.end(), std::mt19937(std::random_device()()));
+
+        m_outputs.clear();
+        m_outputs.reserve(keys.size());
+        for (const auto& key : keys)
+        {
+            m_outputs.push_back(this->get_writable_edge(key));
+        }
+    }
+
+    std::mutex m_mutex;
+    std::unique_ptr<LoadBalancingPolicy> m_policy;
+
+    // cached writable edges so the hot path neither walks the edge map nor performs a dynamic cast
+    std::vector<std::shared_ptr<edge::IEdgeWritable<T>>> m_outputs;
+};
+
 }  // namespace mrc::manifold
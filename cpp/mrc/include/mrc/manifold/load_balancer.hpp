@@ -17,97 +17,123 @@
 
 #pragma once
 
+#include "mrc/channel/status.hpp"
 #include "mrc/core/addresses.hpp"
 #include "mrc/edge/edge_builder.hpp"
 #include "mrc/manifold/composite_manifold.hpp"
+#include "mrc/manifold/egress.hpp"
+#include "mrc/manifold/ingress.hpp"
 #include "mrc/manifold/interface.hpp"
+#include "mrc/manifold/load_balancing_policy.hpp"
 #include "mrc/node/generic_sink.hpp"
 #include "mrc/node/operators/muxer.hpp"
 #include "mrc/node/rx_sink.hpp"
 #include "mrc/node/source_channel_owner.hpp"
 #include "mrc/pipeline/resources.hpp"
+#include "mrc/runnable/launch_control.hpp"
 #include "mrc/runnable/launch_options.hpp"
 #include "mrc/runnable/launchable.hpp"
+#include "mrc/runnable/runner.hpp"
 #include "mrc/runnable/types.hpp"
 #include "mrc/types.hpp"
 
+#include <glog/logging.h>
+
 #include <memory>
-#include <unordered_map>
+#include <utility>
 
 namespace mrc::manifold {
 
 namespace detail {
 
+/**
+ * @brief Progress engine of a LoadBalancer; drains the values muxed from the upstream segments and writes each of them
+ * to the downstream segment chosen by the egress policy.
+ */
 template <typename T>
 class Balancer : public node::GenericSink<T>
 {
   public:
-    Balancer(RoundRobinEgress<T>& state) : m_state(state) {}
+    Balancer(BalancedEgress<T>& egress) : m_egress(egress) {}
 
   private:
     void on_data(T&& data) final
     {
-        // LOG(INFO) << "balancer node: " << data;
-        m_state.await_write(std::move(data));
+        auto status = m_egress.await_write(std::move(data));
+        LOG_IF(WARNING, status != channel::Status::success)
+            << "load-balancer failed to write to a downstream segment; the value was dropped";
     }
 
     void will_complete() final
     {
-        DVLOG(10) << "shutdown load-balancer - clear output channels";
-        // m_state.clear();
+        DVLOG(10) << "shutdown load-balancer - release output channels";
+        m_egress.release_outputs();
     };
 
-    RoundRobinEgress<T>& m_state;
+    BalancedEgress<T>& m_egress;
 };
 
 }  // namespace detail
 
+/**
+ * @brief Manifold which distributes the values of all upstream segments over the downstream segments.
+ *
+ * Upstream segments write into a single channel which is drained by the manifold's own runnable, launched on the main
+ * engine factory by start(). For each value, the LoadBalancingPolicy of the egress picks the downstream segment based
+ * on the occupancy of the downstream channels, so a slow segment receives less work instead of stalling the pipeline.
+ */
 template <typename T>
-class LoadBalancer : public CompositeManifold<MuxedIngress<T>, RoundRobinEgress<T>>
+class LoadBalancer : public CompositeManifold<MuxedIngress<T>, BalancedEgress<T>>
 {
-    using base_t = CompositeManifold<MuxedIngress<T>, RoundRobinEgress<T>>;
+    using base_t = CompositeManifold<MuxedIngress<T>, BalancedEgress<T>>;
 
   public:
-    LoadBalancer(PortName port_name, pipeline::Resources& resources) : base_t(std::move(port_name), resources)
+    LoadBalancer(PortName port_name, pipeline::Resources& resources) :
+      LoadBalancer(std::move(port_name), resources, default_load_balancing_policy())
+    {}
+
+    LoadBalancer(PortName port_name, pipeline::Resources& resources, LoadBalancingPolicyType policy) :
+      base_t(std::move(port_name), resources)
     {
         m_launch_options.engine_factory_name = "main";
         m_launch_options.pe_count            = 1;
         m_launch_options.engines_per_pe      = 8;
 
-        // // construct any resources
-        // this->resources()
-        //     .main()
-        //     .enqueue([this] {
-        //         m_balancer = std::make_shared<detail::Balancer<T>>(this->egress());
-        //         mrc::make_edge(this->ingress().source(), *m_balancer);
-        //     })
-        //     .get();
+        // construct the progress engine on the same NUMA node / memory domain as the ingress and egress
+        this->resources()
+            .main()
+            .enqueue([this, policy] {
+                this->egress().set_policy(make_load_balancing_policy(policy));
+                m_balancer = std::make_unique<detail::Balancer<T>>(this->egress());
+                mrc::make_edge(this->ingress(), *m_balancer);
+            })
+            .get();
     }
 
     void start() final
     {
-        // this->resources()
-        //     .main()
-        //     .enqueue([this] {
-        //         if (m_runner)
-        //         {
-        //             // todo(#179) - validate this fix and improve test coverage
-        //             // this will be handled now by the default behavior of SourceChannelOwner::no_channel method
-        //             // CHECK(!this->egress().output_channels().empty()) << "no egress channels on manifold";
-        //             return;
-        //         }
-        //         CHECK(m_balancer);
-        //         m_runner = this->resources()
-        //                        .launch_control()
-        //                        .prepare_launcher(launch_options(), std::move(m_balancer))
-        //                        ->ignition();
-        //     })
-        //     .get();
+        this->resources()
+            .main()
+            .enqueue([this] {
+                if (m_runner)
+                {
+                    return;
+                }
+                CHECK(m_balancer);
+                m_runner = this->resources()
+                               .launch_control()
+                               .prepare_launcher(launch_options(), std::move(m_balancer))
+                               ->ignition();
+            })
+            .get();
     }
 
     void join() final
     {
-        // m_runner->await_join();
+        if (m_runner)
+        {
+            m_runner->await_join();
+        }
     }
 
     const runnable::LaunchOptions& launch_options() const
@@ -119,8 +145,8 @@ class LoadBalancer : public CompositeManifold<MuxedIngress<T>, RoundRobinEgress<
     // launch options
     runnable::LaunchOptions m_launch_options;
 
-    // // this is the progress engine that will drive the load balancer
-    // std::shared_ptr<node::GenericSink<T>> m_balancer;
+    // progress engine which drives the load balancer; ownership is transferred to the runner on start
+    std::unique_ptr<detail::Balancer<T>> m_balancer;
 
     // runner
     std::unique_ptr<runnable::Runner> m_runner{nullptr};
@@ -0,0 +1,99 @@
+/**
+ * SPDX-FileCopyrightText: Copyright (c) 2023, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <functional>
+#include <memory>
+#include <random>
+
+namespace mrc::manifold {
+
+/**
+ * @brief Built-in strategies a LoadBalancer manifold can use to pick the downstream segment for each value
+ */
+enum class LoadBalancingPolicyType
+{
+    /// cycle through the downstream segments regardless of their backlog
+    RoundRobin,
+    /// write to the downstream segment with the fewest queued items; ties are broken round-robin
+    LeastQueueDepth,
+    /// sample two downstream segments at random and write to the one with fewer queued items
+    PowerOfTwoChoices,
+};
+
+/**
+ * @brief Selects which output of a BalancedEgress receives the next value.
+ *
+ * A policy is owned by a single egress, which serializes all calls to select().
+ */
+class LoadBalancingPolicy
+{
+  public:
+    /// returns the number of items written to, but not yet consumed by, the output with the given index
+    using queue_depth_fn_t = std::function<std::size_t(std::size_t)>;
+
+    virtual ~LoadBalancingPolicy() = default;
+
+    /**
+     * @brief Pick the index of the output to which the next value is written
+     * @param output_count number of outputs, always greater than zero
+     * @param queue_depth occupancy of each output
+     */
+    virtual std::size_t select(std::size_t output_count, const queue_depth_fn_t& queue_depth) = 0;
+};
+
+class RoundRobinPolicy final : public LoadBalancingPolicy
+{
+  public:
+    std::size_t select(std::size_t output_count, const queue_depth_fn_t& queue_depth) final;
+
+  private:
+    std::size_t m_next{0};
+};
+
+class LeastQueueDepthPolicy final : public LoadBalancingPolicy
+{
+  public:
+    std::size_t select(std::size_t output_count, const queue_depth_fn_t& queue_depth) final;
+
+  private:
+    // the scan starts one past the previous pick so idle outputs are used in turn
+    std::size_t m_start{0};
+};
+
+class PowerOfTwoChoicesPolicy final : public LoadBalancingPolicy
+{
+  public:
+    PowerOfTwoChoicesPolicy();
+
+    std::size_t select(std::size_t output_count, const queue_depth_fn_t& queue_depth) final;
+
+  private:
+    std::minstd_rand m_generator;
+};
+
+std::unique_ptr<LoadBalancingPolicy> make_load_balancing_policy(LoadBalancingPolicyType type);
+
+/**
+ * @brief Policy used by LoadBalancer manifolds which are not given one explicitly; defaults to LeastQueueDepth
+ */
+LoadBalancingPolicyType default_load_balancing_policy();
+void set_default_load_balancing_policy(LoadBalancingPolicyType type);
+
+}  // namespace mrc::manifold
@@ -37,6 +37,12 @@ struct codable_protocol<mrc::memory::buffer>
     static void serialize(const memory::buffer& obj, Encoder<memory::buffer>& encoded, const EncodingOptions& opts);
 
     static memory::buffer deserialize(const Decoder<memory::buffer>& encoded, std::size_t object_idx);
+
+    /**
+     * @brief Decode into dst, reusing its allocation when it already holds exactly the encoded number of bytes;
+     * otherwise dst is replaced by a buffer from the decoder's pooled host memory resource.
+     */
+    static void deserialize_into(const Decoder<memory::buffer>& encoded, std::size_t object_idx, memory::buffer& dst);
 };
 
 }  // namespace mrc::codable
@@ -27,12 +27,17 @@
 #include <spdlog/common.h>
 #include <spdlog/fmt/bundled/ostream.h>
 
+#include <atomic>
 #include <cstddef>
+#include <cstdint>
 #include <map>
 #include <shared_mutex>
+#include <utility>
 
 namespace mrc::memory {
 
+using arena_stats = detail::arena::arena_stats;
+
 // Ignore naming conventions here to match RMM
 // NOLINTBEGIN(readability-identifier-naming)
 
@@ -46,9 +51,14 @@ namespace mrc::memory {
  * arenas for non-default streams. Each arena allocates memory from the global arena in chunks
  * called superblocks.
  *
- * Blocks in each arena are allocated using address-ordered first fit. When a block is freed, it is
- * coalesced with neighbouring free blocks if the addresses are contiguous. Free superblocks are
- * returned to the global arena.
+ * Blocks in each arena are allocated using address-ordered best fit from a size-indexed free list. When
+ * a block is freed, it is coalesced with neighbouring free blocks if the addresses are contiguous. Free
+ * superblocks are returned to the global arena.
+ *
+ * Allocations of up to 64 KiB are rounded up to one of a few size classes and recycled through
+ * per-thread caches which take no lock (see detail::arena::arena), so transient buffers rarely reach
+ * the arena locks at all. The hit rate of the caches, the contention on the global arena lock and the
+ * fragmentation of the global arena are reported by stats().
  *
  * In real-world applications, allocation sizes tend to follow a power law distribution in which
  * large allocations are rare, but small ones quite common. By handling small allocations in the
@@ -56,9 +66,7 @@ namespace mrc::memory {
  * fragmentation under high concurrency.
  *
  * This design is inspired by several existing CPU memory allocators targeting multi-threaded
- * applications (glibc malloc, Hoard, jemalloc, TCMalloc), albeit in a simpler form. Possible future
- * improvements include using size classes, allocation caches, and more fine-grained locking or
- * lock-free approaches.
+ * applications (glibc malloc, Hoard, jemalloc, TCMalloc), albeit in a simpler form.
  *
  * \see Wilson, P. R., Johnstone, M. S., Neely, M., & Boles, D. (1995, September). Dynamic storage
  * allocation: A survey and critical review. In International Workshop on Memory Management (pp.
@@ -123,6 +131,23 @@ class arena_resource final : public adaptor<Upstream>
     arena_resource(arena_resource&&) noexcept            = delete;
     arena_resource& operator=(arena_resource&&) noexcept = delete;
 
+    /**
+     * @brief Sample the statistics of the arenas; the cache counters are summed over all threads.
+     */
+    arena_stats stats() const
+    {
+        arena_stats stats;
+        global_arena_->sample(stats);
+
+        read_lock lock(mtx_);
+        for (auto const& thread_arena : thread_arenas_)
+        {
+            stats.cache_hits   += thread_arena.second->cache_hits();
+            stats.cache_misses += thread_arena.second->cache_misses();
+        }
+        return stats;
+    }
+
   private:
     /**
      * @brief Allocates memory of size at least `bytes`.
@@ -142,12 +167,13 @@ class arena_resource final : public adaptor<Upstream>
             return nullptr;
         }
 
-        bytes         = detail::arena::align_up(bytes);
+        bytes         = detail::arena::round_to_size_class(bytes);
         auto& arena   = get_thread_arena();
         void* pointer = arena.allocate(bytes);
 
         if (pointer == nullptr)
         {
+            arena.flush_cache();
             write_lock lock(mtx_);
             defragment();
             pointer = arena.allocate(bytes);
@@ -180,12 +206,14 @@ class arena_resource final : public adaptor<Upstream>
             return;
         }
 
-        bytes = detail::arena::align_up(bytes);
+        bytes = detail::arena::round_to_size_class(bytes);
         get_thread_arena().deallocate(ptr, bytes);
     }
 
     /**
      * @brief Defragment memory by returning all free blocks to the global arena.
+     *
+     * The caches of other threads are flushed the next time those threads use the resource.
      */
     void defragment()
     {
@@ -224,12 +252,21 @@ class arena_resource final : public adaptor<Upstream>
      */
     arena& get_thread_arena()
     {
+        // The arena this thread used last, tagged with the id of its resource. Ids are never reused, so the entry of
+        // a destroyed resource can never match.
+        thread_local std::pair<std::uint64_t, arena*> last_used{0, nullptr};
+        if (last_used.first == id_)
+        {
+            return *last_used.second;
+        }
+
         auto const thread_id = std::this_thread::get_id();
         {
             read_lock lock(mtx_);
             auto const iter = thread_arenas_.find(thread_id);
             if (iter != thread_arenas_.end())
             {
+                last_used = {id_, iter->second.get()};
                 return *iter->second;
             }
         }
@@ -238,6 +275,7 @@ class arena_resource final : public adaptor<Upstream>
             auto thread_arena = std::make_shared<arena>(global_arena_);
             thread_arenas_.emplace(thread_id, thread_arena);
             thread_local detail::arena::arena_cleaner<pointer_type> cleaner{thread_arena};
+            last_used = {id_, thread_arena.get()};
             return *thread_arena;
         }
     }
@@ -307,6 +345,10 @@ class arena_resource final : public adaptor<Upstream>
     }
      */
 
+    /// Source of the ids of resources.
+    static inline std::atomic<std::uint64_t> next_id_{1};  // NOLINT
+    /// Identifies this resource in the thread local lookup of get_thread_arena.
+    std::uint64_t const id_{next_id_.fetch_add(1, std::memory_order_relaxed)};  // NOLINT
     /// The global arena to allocate superblocks from.
     std::shared_ptr<global_arena> global_arena_;  // NOLINT
     /// Arenas for default streams, one per thread.
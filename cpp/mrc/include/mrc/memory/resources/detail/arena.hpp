@@ -26,13 +26,19 @@
 #include <spdlog/fmt/bundled/ostream.h>
 
 #include <algorithm>
+#include <array>
+#include <atomic>
+#include <bit>
 #include <cstddef>
+#include <iterator>
 #include <limits>
 #include <memory>
 #include <mutex>
 #include <numeric>
 #include <set>
 #include <unordered_map>
+#include <utility>
+#include <vector>
 
 namespace mrc::memory::detail::arena {
 /// Minimum size of a superblock (256 KiB).
@@ -157,11 +163,6 @@ class block
     std::size_t size_{};  ///< Size in bytes. // NOLINT
 };
 
-inline bool block_size_compare(block lhs, block rhs)
-{
-    return lhs.size() < rhs.size();
-}
-
 /**
  * @brief Align up to the allocation alignment.
  *
@@ -184,93 +185,266 @@ constexpr std::size_t align_down(std::size_t value) noexcept
     return rmm::detail::align_down(value, rmm::detail::CUDA_ALLOCATION_ALIGNMENT);
 }
 
+/// Largest allocation (64 KiB) served from the per-thread caches.
+constexpr std::size_t maximum_cached_size = 1U << 16U;  // NOLINT
+/// Number of size classes of the per-thread caches.
+constexpr std::size_t size_class_count = 28;  // NOLINT
+
 /**
- * @brief Get the first free block of at least `size` bytes.
+ * @brief Index of the size class of an aligned allocation of at most `maximum_cached_size` bytes.
  *
- * Address-ordered first-fit has shown to perform slightly better than best-fit when it comes to
- * memory fragmentation, and slightly cheaper to implement. It is also used by some popular
- * allocators such as jemalloc.
+ * Sizes up to 1 KiB have a class per 256 bytes; larger sizes have four classes per power of two, so rounding a size up
+ * to its class wastes at most a fifth of it.
  *
- * \see Johnstone, M. S., & Wilson, P. R. (1998). The memory fragmentation problem: Solved?. ACM
- * Sigplan Notices, 34(3), 26-36.
- *
- * @param free_blocks The address-ordered set of free blocks.
- * @param size The number of bytes to allocate.
- * @return block A block of memory of at least `size` bytes, or an empty block if not found.
+ * @param size The aligned size in bytes.
+ * @return The index of the size class.
  */
-inline block first_fit(std::set<block>& free_blocks, std::size_t size)
+constexpr std::size_t size_class_index(std::size_t size) noexcept
 {
-    auto const iter = std::find_if(free_blocks.cbegin(), free_blocks.cend(), [size](auto const& blk) {
-        return blk.fits(size);
-    });
-
-    if (iter == free_blocks.cend())
+    if (size <= 1024)
     {
-        return {};
+        return size / 256 - 1;
     }
-    // Remove the block from the free_list.
-    auto const blk  = *iter;
-    auto const next = free_blocks.erase(iter);
+    auto const log2 = static_cast<std::size_t>(std::bit_width(size - 1)) - 1;
+    auto const step = ((size - 1) >> (log2 - 2)) & 3U;
+    return 4 + (log2 - 10) * 4 + step;
+}
 
-    if (blk.size() > size)
+/**
+ * @brief Size in bytes of the given size class.
+ *
+ * @param index The index of the size class.
+ * @return The largest allocation served by the class.
+ */
+constexpr std::size_t size_class_size(std::size_t index) noexcept
+{
+    if (index < 4)
     {
-        // Split the block and put the remainder back.
-        auto const split = blk.split(size);
-        free_blocks.insert(next, split.second);
-        return split.first;
+        return (index + 1) * 256;
     }
-    return blk;
+    auto const log2 = (index - 4) / 4 + 10;
+    auto const step = (index - 4) % 4;
+    return (std::size_t{1} << log2) + (step + 1) * (std::size_t{1} << (log2 - 2));
 }
 
 /**
- * @brief Coalesce the given block with other free blocks.
+ * @brief Align `bytes` and round sizes which are served from the per-thread caches up to their size class.
  *
- * @param free_blocks The address-ordered set of free blocks.
- * @param b The block to coalesce.
- * @return block The coalesced block.
+ * Allocations and deallocations must agree on the size of a block, so both round their sizes with this function.
+ *
+ * @param bytes The requested size in bytes.
+ * @return The size of the block that is allocated for `bytes`.
  */
-inline block coalesce_block(std::set<block>& free_blocks, block const& blk)
+constexpr std::size_t round_to_size_class(std::size_t bytes) noexcept
 {
-    if (!blk.is_valid())
+    auto const aligned = align_up(bytes);
+    return aligned <= maximum_cached_size ? size_class_size(size_class_index(aligned)) : aligned;
+}
+
+/**
+ * @brief Free blocks indexed both by address, for coalescing, and by size, for allocation.
+ */
+class free_list
+{
+  public:
+    using const_iterator = std::set<block>::const_iterator;
+
+    /**
+     * @brief Get the smallest free block of at least `size` bytes, splitting off and keeping the remainder.
+     *
+     * Among blocks of equal size the one with the lowest address is used, i.e. this is address-ordered best fit,
+     * which fragments about as little as address-ordered first fit but finds its block in O(log n) rather than
+     * scanning the free list.
+     *
+     * \see Johnstone, M. S., & Wilson, P. R. (1998). The memory fragmentation problem: Solved?. ACM
+     * Sigplan Notices, 34(3), 26-36.
+     *
+     * @param size The number of bytes to allocate.
+     * @return block A block of memory of exactly `size` bytes, or an empty block if not found.
+     */
+    block best_fit(std::size_t size)
     {
+        auto const iter = by_size_.lower_bound(block{static_cast<char*>(nullptr), size});
+        if (iter == by_size_.cend())
+        {
+            return {};
+        }
+
+        auto const blk = *iter;
+        by_size_.erase(iter);
+        auto const next  = by_address_.erase(by_address_.find(blk));
+        total_size_     -= blk.size();
+
+        if (blk.size() > size)
+        {
+            // Split the block and put the remainder back.
+            auto const split = blk.split(size);
+            insert(next, split.second);
+            return split.first;
+        }
         return blk;
     }
 
-    // Find the right place (in ascending address order) to insert the block.
-    auto const next     = free_blocks.lower_bound(blk);
-    auto const previous = next == free_blocks.cbegin() ? next : std::prev(next);
+    /**
+     * @brief Coalesce the given block with its free neighbours and add the result to the list.
+     *
+     * @param blk The block to coalesce.
+     * @return block The coalesced block.
+     */
+    block coalesce(block const& blk)
+    {
+        if (!blk.is_valid())
+        {
+            return blk;
+        }
+
+        // Find the right place (in ascending address order) to insert the block.
+        const_iterator next = by_address_.lower_bound(blk);
+        block merged        = blk;
+
+        if (next != by_address_.cbegin())
+        {
+            auto const previous = std::prev(next);
+            if (previous->is_contiguous_before(merged))
+            {
+                merged = previous->merge(merged);
+                remove(previous);
+            }
+        }
+        if (next != by_address_.cend() && merged.is_contiguous_before(*next))
+        {
+            merged = merged.merge(*next);
+            next   = remove(next);
+        }
 
-    // Coalesce with neighboring blocks.
-    bool const merge_prev = previous->is_contiguous_before(blk);
-    bool const merge_next = next != free_blocks.cend() && blk.is_contiguous_before(*next);
+        insert(next, merged);
+        return merged;
+    }
 
-    block merged{};
-    if (merge_prev && merge_next)
+    /**
+     * @brief Remove a block which is in the list.
+     *
+     * @param blk The block to remove, as returned by `coalesce`.
+     */
+    void erase(block const& blk)
     {
-        merged = previous->merge(blk).merge(*next);
-        free_blocks.erase(previous);
-        auto const iter = free_blocks.erase(next);
-        free_blocks.insert(iter, merged);
+        auto const iter = by_address_.find(blk);
+        RMM_LOGGING_ASSERT(iter != by_address_.cend() && iter->size() == blk.size());
+        remove(iter);
     }
-    else if (merge_prev)
+
+    void clear()
     {
-        merged          = previous->merge(blk);
-        auto const iter = free_blocks.erase(previous);
-        free_blocks.insert(iter, merged);
+        by_address_.clear();
+        by_size_.clear();
+        total_size_ = 0;
     }
-    else if (merge_next)
+
+    [[nodiscard]] bool empty() const
     {
-        merged          = blk.merge(*next);
-        auto const iter = free_blocks.erase(next);
-        free_blocks.insert(iter, merged);
+        return by_address_.empty();
     }
-    else
+
+    [[nodiscard]] std::size_t size() const
     {
-        free_blocks.emplace(blk);
-        merged = blk;
+        return by_address_.size();
+    }
+
+    /// Returns the total size in bytes of the free blocks.
+    [[nodiscard]] std::size_t total_size() const
+    {
+        return total_size_;
+    }
+
+    /// Returns the largest free block, or an empty block if the list is empty.
+    [[nodiscard]] block largest() const
+    {
+        return by_size_.empty() ? block{} : *by_size_.crbegin();
+    }
+
+    /// Iterates the free blocks in ascending address order.
+    [[nodiscard]] const_iterator begin() const
+    {
+        return by_address_.cbegin();
+    }
+
+    [[nodiscard]] const_iterator end() const
+    {
+        return by_address_.cend();
+    }
+
+  private:
+    /// Orders blocks by size, then by address.
+    struct size_order
+    {
+        bool operator()(block const& lhs, block const& rhs) const
+        {
+            return lhs.size() < rhs.size() || (lhs.size() == rhs.size() && lhs < rhs);
+        }
+    };
+
+    void insert(const_iterator hint, block const& blk)
+    {
+        by_address_.insert(hint, blk);
+        by_size_.insert(blk);
+        total_size_ += blk.size();
+    }
+
+    const_iterator remove(const_iterator iter)
+    {
+        total_size_ -= iter->size();
+        by_size_.erase(*iter);
+        return by_address_.erase(iter);
     }
-    return merged;
-}
+
+    std::set<block> by_address_;           // NOLINT
+    std::set<block, size_order> by_size_;  // NOLINT
+    std::size_t total_size_{};             // NOLINT
+};
+
+/**
+ * @brief Counters of an arena_resource, sampled by `arena_resource::stats()`.
+ */
+struct arena_stats
+{
+    /// Allocations small enough for the per-thread caches which were served from a cache.
+    std::size_t cache_hits{};
+    /// Allocations small enough for the per-thread caches which had to go to the thread's arena.
+    std::size_t cache_misses{};
+    /// Acquisitions of the global arena lock.
+    std::size_t lock_acquisitions{};
+    /// Acquisitions of the global arena lock which had to wait for another thread.
+    std::size_t contended_acquisitions{};
+    /// Bytes the global arena has allocated from upstream.
+    std::size_t current_size{};
+    /// Bytes in the free blocks of the global arena.
+    std::size_t free_bytes{};
+    /// Number of free blocks in the global arena.
+    std::size_t free_blocks{};
+    /// Size of the largest free block of the global arena.
+    std::size_t largest_free_block{};
+
+    /// Fraction of cacheable allocations served from a per-thread cache.
+    [[nodiscard]] double hit_rate() const
+    {
+        auto const total = cache_hits + cache_misses;
+        return total == 0 ? 0.0 : static_cast<double>(cache_hits) / static_cast<double>(total);
+    }
+
+    /// Fraction of global arena lock acquisitions which had to wait.
+    [[nodiscard]] double contention() const
+    {
+        return lock_acquisitions == 0
+                   ? 0.0
+                   : static_cast<double>(contended_acquisitions) / static_cast<double>(lock_acquisitions);
+    }
+
+    /// Fraction of the free bytes of the global arena which lie outside its largest free block.
+    [[nodiscard]] double fragmentation() const
+    {
+        return free_bytes == 0 ? 0.0 : 1.0 - static_cast<double>(largest_free_block) / static_cast<double>(free_bytes);
+    }
+};
 
 template <typename T>
 inline auto total_block_size(T const& blocks)
@@ -340,7 +514,7 @@ class global_arena final
         }
         RMM_EXPECTS(initial_size <= maximum_size_, "Initial arena size exceeds the maximum pool size!");
 
-        free_blocks_.emplace(expand_arena(initial_size));
+        free_blocks_.coalesce(expand_arena(initial_size));
     }
 
     // Disable copy (and move) semantics.
@@ -355,7 +529,7 @@ class global_arena final
      */
     ~global_arena()
     {
-        lock_guard lock(mtx_);
+        std::lock_guard<std::mutex> lock(mtx_);
         for (auto const& blk : upstream_blocks_)
         {
             upstream_mr_->deallocate(blk.pointer(), blk.size());
@@ -372,33 +546,40 @@ class global_arena final
      */
     block allocate(std::size_t bytes)
     {
-        lock_guard lock(mtx_);
+        auto lock = acquire();
         return get_block(bytes);
     }
 
     /**
-     * @brief Deallocate memory pointed to by `blk`.
+     * @brief Deallocate a batch of blocks under a single acquisition of the lock, e.g. the free blocks of a dying
+     * arena or the superblocks an arena released.
      *
-     * @param blk Block to be deallocated.
+     * @param blocks The blocks to deallocate.
      */
-    void deallocate(block const& blk)
+    template <typename BlocksT>
+    void deallocate(BlocksT const& blocks)
     {
-        lock_guard lock(mtx_);
-        coalesce_block(free_blocks_, blk);
+        auto lock = acquire();
+        for (auto const& blk : blocks)
+        {
+            free_blocks_.coalesce(blk);
+        }
     }
 
     /**
-     * @brief Deallocate a set of free blocks from a dying arena.
+     * @brief Sample the size, free list and lock counters of the global arena.
      *
-     * @param free_blocks The set of free blocks.
+     * @param stats The statistics to fill in; the per-thread cache counters are left untouched.
      */
-    void deallocate(std::set<block> const& free_blocks)
+    void sample(arena_stats& stats) const
     {
-        lock_guard lock(mtx_);
-        for (auto const& blk : free_blocks)
-        {
-            coalesce_block(free_blocks_, blk);
-        }
+        std::lock_guard<std::mutex> lock(mtx_);
+        stats.lock_acquisitions      = lock_acquisitions_;
+        stats.contended_acquisitions = contended_acquisitions_;
+        stats.current_size           = current_size_;
+        stats.free_bytes             = free_blocks_.total_size();
+        stats.free_blocks            = free_blocks_.size();
+        stats.largest_free_block     = free_blocks_.largest().size();
     }
 
     /**
@@ -408,7 +589,7 @@ class global_arena final
      */
     void dump_memory_log(std::shared_ptr<spdlog::logger> const& logger) const
     {
-        lock_guard lock(mtx_);
+        std::lock_guard<std::mutex> lock(mtx_);
 
         logger->info("  Maximum size: {}", rmm::detail::bytes{maximum_size_});
         logger->info("  Current size: {}", rmm::detail::bytes{current_size_});
@@ -416,9 +597,8 @@ class global_arena final
         logger->info("  # free blocks: {}", free_blocks_.size());
         if (!free_blocks_.empty())
         {
-            logger->info("  Total size of free blocks: {}", rmm::detail::bytes{total_block_size(free_blocks_)});
-            auto const largest_free = *std::max_element(free_blocks_.begin(), free_blocks_.end(), block_size_compare);
-            logger->info("  Size of largest free block: {}", rmm::detail::bytes{largest_free.size()});
+            logger->info("  Total size of free blocks: {}", rmm::detail::bytes{free_blocks_.total_size()});
+            logger->info("  Size of largest free block: {}", rmm::detail::bytes{free_blocks_.largest().size()});
         }
 
         logger->info("  # upstream blocks={}", upstream_blocks_.size());
@@ -426,7 +606,20 @@ class global_arena final
     }
 
   private:
-    using lock_guard = std::lock_guard<std::mutex>;
+    /**
+     * @brief Lock the global arena, counting the acquisitions which had to wait for another thread.
+     */
+    std::unique_lock<std::mutex> acquire()
+    {
+        std::unique_lock<std::mutex> lock(mtx_, std::try_to_lock);
+        if (!lock.owns_lock())
+        {
+            lock.lock();
+            ++contended_acquisitions_;
+        }
+        ++lock_acquisitions_;
+        return lock;
+    }
 
     /**
      * @brief Get an available memory block of at least `size` bytes.
@@ -436,8 +629,8 @@ class global_arena final
      */
     block get_block(std::size_t size)
     {
-        // Find the first-fit free block.
-        auto const blk = first_fit(free_blocks_, size);
+        // Find the best-fit free block.
+        auto const blk = free_blocks_.best_fit(size);
         if (blk.is_valid())
         {
             return blk;
@@ -445,8 +638,8 @@ class global_arena final
 
         // No existing larger blocks available, so grow the arena.
         auto const upstream_block = expand_arena(size_to_grow(size));
-        coalesce_block(free_blocks_, upstream_block);
-        return first_fit(free_blocks_, size);
+        free_blocks_.coalesce(upstream_block);
+        return free_blocks_.best_fit(size);
     }
 
     /**
@@ -489,10 +682,14 @@ class global_arena final
     std::size_t maximum_size_;  // NOLINT
     /// The current size of the global arena.
     std::size_t current_size_{};  // NOLINT
-    /// Address-ordered set of free blocks.
-    std::set<block> free_blocks_;  // NOLINT
+    /// Free blocks, indexed by address and size.
+    free_list free_blocks_;  // NOLINT
     /// Blocks allocated from upstream so that they can be quickly freed.
     std::vector<block> upstream_blocks_;  // NOLINT
+    /// Number of times the lock was acquired.
+    std::size_t lock_acquisitions_{};  // NOLINT
+    /// Number of times the lock was held by another thread when it was acquired.
+    std::size_t contended_acquisitions_{};  // NOLINT
     /// Mutex for exclusive lock.
     mutable std::mutex mtx_;  // NOLINT
 };
@@ -503,6 +700,11 @@ class global_arena final
  * An arena is a per-thread or per-non-default-stream memory pool. It allocates
  * superblocks from the global arena, and return them when the superblocks become empty.
  *
+ * Blocks of up to `maximum_cached_size` bytes are recycled through a cache of size segregated free lists which only
+ * the owning thread touches, so the common allocate/free cycle of small transient buffers takes no lock. A cache
+ * which overflows hands half of its blocks back to the arena at once, and a miss refills several blocks of its size
+ * class under a single acquisition of the arena lock.
+ *
  * @tparam Upstream Memory resource to use for allocating the global arena. Implements
  * rmm::mr::device_memory_resource interface.
  */
@@ -528,13 +730,33 @@ class arena
     /**
      * @brief Allocates memory of size at least `bytes`.
      *
-     * @throws `std::bad_alloc` if the requested allocation could not be fulfilled.
+     * Must only be called by the thread which owns the arena.
      *
-     * @param bytes The size in bytes of the allocation.
-     * @return void* Pointer to the newly allocated memory.
+     * @param bytes The size in bytes of the allocation, as returned by `round_to_size_class`.
+     * @return void* Pointer to the newly allocated memory, or nullptr if the allocation could not be fulfilled.
      */
     void* allocate(std::size_t bytes)
     {
+        if (flush_requested_.load(std::memory_order_relaxed))
+        {
+            flush_cache();
+        }
+
+        if (bytes <= maximum_cached_size)
+        {
+            auto& cache = cache_[size_class_index(bytes)];
+            if (!cache.empty())
+            {
+                cache_hits_.fetch_add(1, std::memory_order_relaxed);
+                cached_bytes_ -= bytes;
+                auto* const ptr = cache.back();
+                cache.pop_back();
+                return ptr;
+            }
+            cache_misses_.fetch_add(1, std::memory_order_relaxed);
+            return refill(cache, bytes);
+        }
+
         lock_guard lock(mtx_);
         auto const blk = get_block(bytes);
         return blk.pointer();
@@ -543,29 +765,98 @@ class arena
     /**
      * @brief Deallocate memory pointed to by `ptr`, and possibly return superblocks to upstream.
      *
+     * Must only be called by the thread which owns the arena.
+     *
      * @param ptr Pointer to be deallocated.
      * @param bytes The size in bytes of the allocation. This must be equal to the value of `bytes`
      * that was passed to the `allocate` call that returned `p`.
-     * @param stream Stream on which to perform deallocation.
      */
     void deallocate(void* ptr, std::size_t bytes)
     {
-        lock_guard lock(mtx_);
-        block const blk{ptr, bytes};
-        auto const merged = coalesce_block(free_blocks_, blk);
-        shrink_arena(merged);
+        if (flush_requested_.load(std::memory_order_relaxed))
+        {
+            flush_cache();
+        }
+
+        if (bytes <= maximum_cached_size)
+        {
+            auto& cache = cache_[size_class_index(bytes)];
+            if (cache.size() < cache_depth(bytes) && cached_bytes_ + bytes <= maximum_cached_bytes)
+            {
+                cache.push_back(ptr);
+                cached_bytes_ += bytes;
+                return;
+            }
+
+            // Hand the older half of a full size class back together with this block.
+            std::vector<block> batch{{ptr, bytes}};
+            auto const count = cache.size() / 2;
+            for (std::size_t i = 0; i < count; ++i)
+            {
+                batch.emplace_back(cache[i], bytes);
+            }
+            cache.erase(cache.begin(), cache.begin() + static_cast<std::ptrdiff_t>(count));
+            cached_bytes_ -= count * bytes;
+            release(batch);
+            return;
+        }
+
+        release(std::array<block, 1>{block{ptr, bytes}});
+    }
+
+    /**
+     * @brief Return all cached blocks to the arena.
+     *
+     * Must only be called by the thread which owns the arena.
+     */
+    void flush_cache()
+    {
+        flush_requested_.store(false, std::memory_order_relaxed);
+
+        std::vector<block> batch;
+        for (std::size_t index = 0; index < size_class_count; ++index)
+        {
+            for (auto* ptr : cache_[index])
+            {
+                batch.emplace_back(ptr, size_class_size(index));
+            }
+            cache_[index].clear();
+        }
+        cached_bytes_ = 0;
+
+        if (!batch.empty())
+        {
+            release(batch);
+        }
     }
 
     /**
      * @brief Clean the arena and deallocate free blocks from the global arena.
+     *
+     * May be called from any thread. The cache is only touched by the owning thread, so it is flushed the next time
+     * that thread allocates or deallocates.
      */
     void clean()
     {
+        flush_requested_.store(true, std::memory_order_relaxed);
+
         lock_guard lock(mtx_);
         global_arena_->deallocate(free_blocks_);
         free_blocks_.clear();
     }
 
+    /// Number of allocations served from the cache.
+    [[nodiscard]] std::size_t cache_hits() const
+    {
+        return cache_hits_.load(std::memory_order_relaxed);
+    }
+
+    /// Number of cacheable allocations which missed the cache.
+    [[nodiscard]] std::size_t cache_misses() const
+    {
+        return cache_misses_.load(std::memory_order_relaxed);
+    }
+
     /**
      * Dump memory to log.
      *
@@ -577,9 +868,8 @@ class arena
         logger->info("    # free blocks: {}", free_blocks_.size());
         if (!free_blocks_.empty())
         {
-            logger->info("    Total size of free blocks: {}", rmm::detail::bytes{total_block_size(free_blocks_)});
-            auto const largest_free = *std::max_element(free_blocks_.begin(), free_blocks_.end(), block_size_compare);
-            logger->info("    Size of largest free block: {}", rmm::detail::bytes{largest_free.size()});
+            logger->info("    Total size of free blocks: {}", rmm::detail::bytes{free_blocks_.total_size()});
+            logger->info("    Size of largest free block: {}", rmm::detail::bytes{free_blocks_.largest().size()});
         }
     }
 
@@ -587,6 +877,77 @@ class arena
     using lock_guard = std::lock_guard<std::mutex>;
     /// Maximum number of free blocks to keep.
     static constexpr int max_free_blocks = 16;  // NOLINT
+    /// Maximum number of bytes held by the cache (1 MiB).
+    static constexpr std::size_t maximum_cached_bytes = 1U << 20U;  // NOLINT
+    /// Maximum number of bytes held by a single size class of the cache (64 KiB).
+    static constexpr std::size_t maximum_class_bytes = 1U << 16U;  // NOLINT
+
+    /**
+     * @brief Maximum number of blocks cached for the size class of `size`; between 2 and 32.
+     */
+    static constexpr std::size_t cache_depth(std::size_t size)
+    {
+        return std::clamp<std::size_t>(maximum_class_bytes / size, 2, 32);
+    }
+
+    /**
+     * @brief Allocate a block for a size class whose cache is empty, and refill the cache with up to half its depth
+     * of blocks which are already free in the arena.
+     *
+     * @param cache The empty cache of the size class.
+     * @param size The size of the class in bytes.
+     * @return void* Pointer to the allocated block, or nullptr if no block could be allocated.
+     */
+    void* refill(std::vector<void*>& cache, std::size_t size)
+    {
+        lock_guard lock(mtx_);
+        auto const blk = get_block(size);
+        if (!blk.is_valid())
+        {
+            return nullptr;
+        }
+
+        auto const count = cache_depth(size) / 2;
+        while (cache.size() < count && cached_bytes_ + size <= maximum_cached_bytes)
+        {
+            auto const extra = free_blocks_.best_fit(size);
+            if (!extra.is_valid())
+            {
+                break;
+            }
+            cache.push_back(extra.pointer());
+            cached_bytes_ += size;
+        }
+        return blk.pointer();
+    }
+
+    /**
+     * @brief Coalesce a batch of blocks into the arena, and return the resulting free superblocks and any free blocks
+     * beyond `max_free_blocks` to the global arena in a single batch.
+     *
+     * @param blocks The blocks to deallocate.
+     */
+    template <typename BlocksT>
+    void release(BlocksT const& blocks)
+    {
+        std::vector<block> surplus;
+
+        lock_guard lock(mtx_);
+        for (auto const& blk : blocks)
+        {
+            auto const merged = free_blocks_.coalesce(blk);
+            if (merged.is_superblock() || free_blocks_.size() > max_free_blocks)
+            {
+                free_blocks_.erase(merged);
+                surplus.push_back(merged);
+            }
+        }
+
+        if (!surplus.empty())
+        {
+            global_arena_->deallocate(surplus);
+        }
+    }
 
     /**
      * @brief Get an available memory block of at least `size` bytes.
@@ -598,8 +959,8 @@ class arena
     {
         if (size < minimum_superblock_size)
         {
-            // Find the first-fit free block.
-            auto const blk = first_fit(free_blocks_, size);
+            // Find the best-fit free block.
+            auto const blk = free_blocks_.best_fit(size);
             if (blk.is_valid())
             {
                 return blk;
@@ -610,8 +971,8 @@ class arena
         auto const superblock = expand_arena(size);
         if (superblock.is_valid())
         {
-            coalesce_block(free_blocks_, superblock);
-            return first_fit(free_blocks_, size);
+            free_blocks_.coalesce(superblock);
+            return free_blocks_.best_fit(size);
         }
         return superblock;
     }
@@ -627,27 +988,22 @@ class arena
         return global_arena_->allocate(superblock_size);
     }
 
-    /**
-     * @brief Shrink this arena by returning free superblocks to upstream.
-     *
-     * @param blk The block that can be used to shrink the arena.
-     * @param stream Stream on which to perform shrinking.
-     */
-    void shrink_arena(block const& blk)
-    {
-        if (blk.is_superblock() || free_blocks_.size() > max_free_blocks)
-        {
-            global_arena_->deallocate(blk);
-            free_blocks_.erase(blk);
-        }
-    }
-
     /// The global arena to allocate superblocks from.
     std::shared_ptr<global_arena<Upstream>> global_arena_;  // NOLINT
-    /// Free blocks.
-    std::set<block> free_blocks_;  // NOLINT
+    /// Free blocks, indexed by address and size.
+    free_list free_blocks_;  // NOLINT
     /// Mutex for exclusive lock.
     mutable std::mutex mtx_;  // NOLINT
+    /// Cached blocks of each size class; only touched by the owning thread.
+    std::array<std::vector<void*>, size_class_count> cache_;  // NOLINT
+    /// Total size of the cached blocks.
+    std::size_t cached_bytes_{};  // NOLINT
+    /// Set by `clean` to have the owning thread flush its cache.
+    std::atomic<bool> flush_requested_{false};  // NOLINT
+    /// Allocations served from the cache.
+    std::atomic<std::size_t> cache_hits_{0};  // NOLINT
+    /// Cacheable allocations which missed the cache.
+    std::atomic<std::size_t> cache_misses_{0};  // NOLINT
 };
 
 /**
@@ -675,6 +1031,7 @@ class arena_cleaner
         if (!arena_.expired())
         {
             auto arena_ptr = arena_.lock();
+            arena_ptr->flush_cache();
             arena_ptr->clean();
         }
     }
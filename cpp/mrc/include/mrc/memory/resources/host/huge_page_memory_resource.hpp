@@ -0,0 +1,177 @@
+/**
+ * SPDX-FileCopyrightText: Copyright (c) 2022-2023, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include "mrc/memory/resources/memory_resource.hpp"
+
+#include <glog/logging.h>
+#include <sys/mman.h>
+#include <unistd.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <new>
+
+#ifndef MAP_HUGE_SHIFT
+    #define MAP_HUGE_SHIFT 26
+#endif
+
+namespace mrc::memory {
+
+/**
+ * @brief Host memory_resource which maps huge pages directly from the kernel.
+ *
+ * With `use_hugetlbfs`, each allocation is a MAP_HUGETLB mapping of `page_size` pages (2 MiB or 1 GiB) taken from the
+ * pool reserved by the administrator (/sys/kernel/mm/hugepages/hugepages-<size>/nr_hugepages); when the pool cannot
+ * satisfy a mapping, the allocation falls back to transparent huge pages. Otherwise allocations are anonymous mappings
+ * aligned to `page_size` and advised with MADV_HUGEPAGE, which the kernel backs with transparent huge pages if enabled.
+ *
+ * Allocation sizes are rounded up to a multiple of `page_size`, so the resource is meant to be the upstream of a pool
+ * such as the arena. With `prefault`, pages are faulted in when they are allocated rather than on first touch.
+ */
+class huge_page_memory_resource final : public memory_resource
+{
+  public:
+    static constexpr std::size_t huge_page_2mib = std::size_t{1} << 21;
+    static constexpr std::size_t huge_page_1gib = std::size_t{1} << 30;
+
+    huge_page_memory_resource(std::size_t page_size, bool use_hugetlbfs, bool prefault = false) :
+      m_page_size(page_size),
+      m_use_hugetlbfs(use_hugetlbfs),
+      m_prefault(prefault)
+    {
+        CHECK(m_page_size == huge_page_2mib || m_page_size == huge_page_1gib)
+            << "huge pages must be either 2 MiB or 1 GiB; got " << m_page_size << " bytes";
+    }
+
+    std::size_t page_size() const
+    {
+        return m_page_size;
+    }
+
+    /**
+     * @brief Faults in [ptr, ptr + bytes) with one write per base page; if a huge page backs the range, the first write
+     * faults in the whole huge page. Used by adaptors which must set a memory policy before the pages are populated.
+     */
+    static void touch(void* ptr, std::size_t bytes)
+    {
+        const auto stride = static_cast<std::size_t>(sysconf(_SC_PAGESIZE));
+        auto* data        = static_cast<volatile std::byte*>(ptr);
+        for (std::size_t offset = 0; offset < bytes; offset += stride)
+        {
+            data[offset] = std::byte{0};
+        }
+    }
+
+  private:
+    void* do_allocate(std::size_t bytes) final
+    {
+        // don't allocate anything if the user requested zero bytes
+        if (0 == bytes)
+        {
+            return nullptr;
+        }
+
+        const auto mapped_bytes = round_up(bytes);
+
+        void* ptr = m_use_hugetlbfs ? map_hugetlbfs(mapped_bytes) : nullptr;
+        if (ptr == nullptr)
+        {
+            ptr = map_transparent(mapped_bytes);
+        }
+        return ptr;
+    }
+
+    void do_deallocate(void* ptr, std::size_t bytes) final
+    {
+        CHECK_EQ(munmap(ptr, round_up(bytes)), 0);
+    }
+
+    memory_kind do_kind() const final
+    {
+        return memory_kind::host;
+    }
+
+    std::size_t round_up(std::size_t bytes) const
+    {
+        return (bytes + m_page_size - 1) & ~(m_page_size - 1);
+    }
+
+    void* map_hugetlbfs(std::size_t bytes) const
+    {
+        const int page_shift = (m_page_size == huge_page_1gib) ? 30 : 21;
+
+        int flags = MAP_PRIVATE | MAP_ANONYMOUS | MAP_HUGETLB | (page_shift << MAP_HUGE_SHIFT);
+        if (m_prefault)
+        {
+            flags |= MAP_POPULATE;
+        }
+
+        void* ptr = mmap(nullptr, bytes, PROT_READ | PROT_WRITE, flags, -1, 0);
+        if (ptr == MAP_FAILED)  // NOLINT(performance-no-int-to-ptr)
+        {
+            LOG_FIRST_N(WARNING, 1) << "unable to map " << bytes << " bytes of hugetlbfs pages of size " << m_page_size
+                                    << "; falling back to transparent huge pages";  // NOLINT
+            return nullptr;
+        }
+        return ptr;
+    }
+
+    void* map_transparent(std::size_t bytes) const
+    {
+        // over-map by one huge page and trim to a huge page boundary; the kernel only uses huge pages for aligned ranges
+        const auto reserved = bytes + m_page_size;
+
+        void* base = mmap(nullptr, reserved, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+        if (base == MAP_FAILED)  // NOLINT(performance-no-int-to-ptr)
+        {
+            throw std::bad_alloc{};
+        }
+
+        const auto start   = reinterpret_cast<std::uintptr_t>(base);
+        const auto aligned = (start + m_page_size - 1) & ~(m_page_size - 1);
+        const auto head    = aligned - start;
+        const auto tail    = reserved - head - bytes;
+
+        if (head > 0)
+        {
+            CHECK_EQ(munmap(base, head), 0);
+        }
+        if (tail > 0)
+        {
+            CHECK_EQ(munmap(reinterpret_cast<void*>(aligned + bytes), tail), 0);  // NOLINT(performance-no-int-to-ptr)
+        }
+
+        auto* ptr = reinterpret_cast<void*>(aligned);  // NOLINT(performance-no-int-to-ptr)
+
+        // best effort; fails with EINVAL when transparent huge pages are disabled in the kernel
+        madvise(ptr, bytes, MADV_HUGEPAGE);
+
+        if (m_prefault)
+        {
+            touch(ptr, bytes);
+        }
+        return ptr;
+    }
+
+    const std::size_t m_page_size;
+    const bool m_use_hugetlbfs;
+    const bool m_prefault;
+};
+
+}  // namespace mrc::memory
@@ -1,5 +1,5 @@
 /**
- * SPDX-FileCopyrightText: Copyright (c) 2021-2023, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-FileCopyrightText: Copyright (c) 2022-2023, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
  * SPDX-License-Identifier: Apache-2.0
  *
  * Licensed under the Apache License, Version 2.0 (the "License");
@@ -17,18 +17,26 @@
 
 #pragma once
 
-#include <cstddef>
+#include "mrc/metrics/detail/sharded_value.hpp"
 
-namespace prometheus {
-class Counter;
-}
+#include <cstddef>
+#include <cstdint>
+#include <memory>
 
 namespace mrc::metrics {
 
+/**
+ * @brief Monotonically increasing count. Increments land on a per-thread shard and never contend with other threads;
+ * the shards are merged when the counter is read.
+ *
+ * Copies share the same underlying count, which is kept alive by both the copies and the Registry.
+ */
 class Counter
 {
   public:
-    explicit Counter(prometheus::Counter*);
+    using cells_t = detail::ShardedValue<std::uint64_t>;
+
+    explicit Counter(std::shared_ptr<cells_t> cells);
 
     Counter(const Counter&)            = default;
     Counter& operator=(const Counter&) = default;
@@ -36,11 +44,20 @@ class Counter
     Counter(Counter&&) noexcept            = default;
     Counter& operator=(Counter&&) noexcept = default;
 
-    void increment();
-    void increment(const std::size_t& ticks);
+    void increment()
+    {
+        m_cells->add(1);
+    }
+
+    void increment(const std::size_t& ticks)
+    {
+        m_cells->add(ticks);
+    }
+
+    std::uint64_t value() const;
 
   private:
-    prometheus::Counter* m_counter;
+    std::shared_ptr<cells_t> m_cells;
 };
 
 }  // namespace mrc::metrics
@@ -0,0 +1,76 @@
+/**
+ * SPDX-FileCopyrightText: Copyright (c) 2022-2023, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <cstddef>
+
+namespace mrc::metrics::detail {
+
+static constexpr std::size_t CacheLineSize    = 64;
+static constexpr std::size_t MetricShardCount = 16;
+
+// hands out shard indexes round-robin; called once per thread
+std::size_t next_thread_shard();
+
+/**
+ * @brief Index of the calling thread's shard, assigned round-robin the first time a thread updates any metric.
+ *
+ * Threads only share a shard once more than MetricShardCount threads have touched metrics; updates remain correct,
+ * they merely contend again.
+ */
+inline std::size_t this_thread_shard()
+{
+    thread_local const std::size_t shard = next_thread_shard();
+    return shard;
+}
+
+/**
+ * @brief Integral value split across cache-line sized, per-thread shards. Updates are a single relaxed fetch_add on the
+ * caller's shard; the value is the sum of all shards and is only computed when it is read, e.g. at scrape time.
+ */
+template <typename T>
+class ShardedValue
+{
+  public:
+    void add(T delta)
+    {
+        m_shards[this_thread_shard()].value.fetch_add(delta, std::memory_order_relaxed);
+    }
+
+    T sum() const
+    {
+        T total = 0;
+        for (const auto& shard : m_shards)
+        {
+            total += shard.value.load(std::memory_order_relaxed);
+        }
+        return total;
+    }
+
+  private:
+    struct alignas(CacheLineSize) Shard
+    {
+        std::atomic<T> value{0};
+    };
+
+    std::array<Shard, MetricShardCount> m_shards;
+};
+
+}  // namespace mrc::metrics::detail
@@ -0,0 +1,83 @@
+/**
+ * SPDX-FileCopyrightText: Copyright (c) 2022-2023, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include "mrc/utils/macros.hpp"
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <mutex>
+#include <string>
+#include <thread>
+
+namespace mrc::metrics {
+
+class Registry;
+
+/**
+ * @brief Publishes a Registry in the Prometheus text exposition format, either over http at GET /metrics, to a file
+ * which is rewritten periodically, or both. Each export runs on its own background thread until stop() is called or
+ * the Exporter is destroyed; the Registry must outlive the Exporter.
+ */
+class Exporter final
+{
+  public:
+    explicit Exporter(const Registry& registry);
+    ~Exporter();
+
+    DELETE_COPYABILITY(Exporter);
+    DELETE_MOVEABILITY(Exporter);
+
+    /**
+     * @brief Serves the registry on address:port; a port of zero binds an ephemeral port. Returns the bound port.
+     *
+     * Besides GET /metrics, the endpoint serves the event trace of the process (see tracing::dump_chrome_trace) at GET
+     * /trace, and switches tracing on and off with GET /trace/enable and GET /trace/disable.
+     */
+    std::uint16_t serve(const std::string& address, std::uint16_t port);
+
+    /**
+     * @brief Writes the registry to path every interval and once more on stop
+     */
+    void write_periodically(std::string path, std::chrono::milliseconds interval);
+
+    /**
+     * @brief Writes the registry to path once. The file is replaced atomically, so readers never see a partial file.
+     */
+    void write(const std::string& path) const;
+
+    void stop();
+
+  private:
+    void serve_loop();
+    void handle_connection(int fd) const;
+
+    const Registry& m_registry;
+
+    int m_listen_fd{-1};
+    std::thread m_server;
+    std::thread m_writer;
+
+    std::mutex m_mutex;
+    std::condition_variable m_cv;
+    std::atomic<bool> m_running{true};
+};
+
+}  // namespace mrc::metrics
@@ -0,0 +1,61 @@
+/**
+ * SPDX-FileCopyrightText: Copyright (c) 2022-2023, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include "mrc/metrics/detail/sharded_value.hpp"
+
+#include <cstdint>
+#include <memory>
+
+namespace mrc::metrics {
+
+/**
+ * @brief Value which can go up and down, e.g. the number of items in flight. Like Counter, updates are applied to a
+ * per-thread shard and merged when the gauge is read.
+ *
+ * Copies share the same underlying value.
+ */
+class Gauge
+{
+  public:
+    using cells_t = detail::ShardedValue<std::int64_t>;
+
+    explicit Gauge(std::shared_ptr<cells_t> cells);
+
+    void increment(std::int64_t delta = 1)
+    {
+        m_cells->add(delta);
+    }
+
+    void decrement(std::int64_t delta = 1)
+    {
+        m_cells->add(-delta);
+    }
+
+    /**
+     * @brief Moves the gauge to an absolute value. Increments made concurrently with a set may be lost.
+     */
+    void set(std::int64_t value);
+
+    std::int64_t value() const;
+
+  private:
+    std::shared_ptr<cells_t> m_cells;
+};
+
+}  // namespace mrc::metrics
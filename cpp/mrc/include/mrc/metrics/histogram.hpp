@@ -0,0 +1,138 @@
+/**
+ * SPDX-FileCopyrightText: Copyright (c) 2022-2023, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include "mrc/metrics/detail/sharded_value.hpp"
+
+#include <array>
+#include <atomic>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+namespace mrc::metrics {
+
+/**
+ * @brief Log-linear (HDR style) bucketing of unsigned 64-bit values.
+ *
+ * Values below 2^SubBucketBits each get their own bucket; every power of two range above that is split into
+ * 2^SubBucketBits equally sized buckets, bounding the relative error of any bucket to 1/2^SubBucketBits (12.5%) over
+ * the whole 64-bit range.
+ */
+struct HistogramBuckets
+{
+    static constexpr std::size_t SubBucketBits  = 3;
+    static constexpr std::size_t SubBucketCount = std::size_t{1} << SubBucketBits;
+    static constexpr std::size_t BucketCount    = (64 - SubBucketBits + 1) * SubBucketCount;
+
+    static constexpr std::size_t index(std::uint64_t value)
+    {
+        if (value < SubBucketCount)
+        {
+            return value;
+        }
+
+        const std::size_t shift = std::bit_width(value) - 1 - SubBucketBits;
+        return (shift + 1) * SubBucketCount + ((value >> shift) & (SubBucketCount - 1));
+    }
+
+    static constexpr std::uint64_t lower_bound(std::size_t index)
+    {
+        const auto octave = index / SubBucketCount;
+        const auto sub    = index % SubBucketCount;
+        return octave == 0 ? sub : (SubBucketCount + sub) << (octave - 1);
+    }
+
+    // inclusive
+    static constexpr std::uint64_t upper_bound(std::size_t index)
+    {
+        const auto octave = index / SubBucketCount;
+        return octave == 0 ? lower_bound(index) : lower_bound(index) + ((std::uint64_t{1} << (octave - 1)) - 1);
+    }
+};
+
+namespace detail {
+
+static constexpr std::size_t HistogramShardCount = 4;
+
+struct HistogramCells
+{
+    struct alignas(CacheLineSize) Shard
+    {
+        std::array<std::atomic<std::uint64_t>, HistogramBuckets::BucketCount> buckets{};
+        std::atomic<std::uint64_t> sum{0};
+    };
+
+    // a histogram is several kilobytes per shard, so it is split into fewer shards than counters and gauges
+    std::array<Shard, HistogramShardCount> shards;
+};
+
+}  // namespace detail
+
+/**
+ * @brief Merged view of a Histogram at the time snapshot() was called
+ */
+struct HistogramSnapshot
+{
+    // one count per HistogramBuckets bucket
+    std::vector<std::uint64_t> buckets;
+    std::uint64_t count{0};
+    std::uint64_t sum{0};
+
+    /**
+     * @brief Estimate of the value below which the fraction q of the recorded values fall. Returns the inclusive upper
+     * bound of the bucket holding that value, or zero if nothing was recorded.
+     */
+    std::uint64_t quantile(double q) const;
+
+    /**
+     * @brief Number of recorded values strictly below bound; exact when bound is the lower bound of a bucket, which is
+     * true of every power of two.
+     */
+    std::uint64_t count_below(std::uint64_t bound) const;
+};
+
+/**
+ * @brief Distribution of values, typically latencies in nanoseconds. Recording a value is two relaxed fetch_adds on
+ * the caller's shard.
+ *
+ * Copies share the same underlying buckets.
+ */
+class Histogram
+{
+  public:
+    using cells_t = detail::HistogramCells;
+
+    explicit Histogram(std::shared_ptr<cells_t> cells);
+
+    void record(std::uint64_t value)
+    {
+        auto& shard = m_cells->shards[detail::this_thread_shard() % detail::HistogramShardCount];
+        shard.buckets[HistogramBuckets::index(value)].fetch_add(1, std::memory_order_relaxed);
+        shard.sum.fetch_add(value, std::memory_order_relaxed);
+    }
+
+    HistogramSnapshot snapshot() const;
+
+  private:
+    std::shared_ptr<cells_t> m_cells;
+};
+
+}  // namespace mrc::metrics
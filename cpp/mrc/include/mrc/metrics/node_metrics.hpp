@@ -0,0 +1,71 @@
+/**
+ * SPDX-FileCopyrightText: Copyright (c) 2022-2023, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include "mrc/metrics/counter.hpp"
+#include "mrc/metrics/gauge.hpp"
+#include "mrc/metrics/histogram.hpp"
+#include "mrc/metrics/registry.hpp"
+
+#include <cstddef>
+#include <functional>
+#include <memory>
+
+namespace mrc {
+struct WatcherInterface;
+}  // namespace mrc
+
+namespace mrc::metrics {
+
+/**
+ * @brief Standard metrics of a segment node, which the segment builder registers for every node it creates when
+ * MetricsOptions::node_metrics is enabled:
+ *
+ *  - mrc_node_received_total: values the node took from its input
+ *  - mrc_node_emitted_total: values the node wrote to its output
+ *  - mrc_node_in_flight: values taken from the input whose processing has not yet finished
+ *  - mrc_node_processing_seconds: histogram of the time from taking a value until the node is ready for the next one
+ *  - mrc_node_queue_depth: values waiting in the input channel of the node
+ *
+ * The values are fed by watchers attached to the sink and source of the node. Nodes which were fused into their
+ * upstream process their values on the upstream's thread and only report the counters and the queue depth.
+ */
+class NodeMetrics
+{
+  public:
+    NodeMetrics(Registry& registry, Registry::labels_t labels);
+
+    std::shared_ptr<WatcherInterface> sink_watcher() const;
+    std::shared_ptr<WatcherInterface> source_watcher() const;
+
+    /**
+     * @brief Samples the depth of the input channel each time the registry is read
+     */
+    void set_queue_depth_fn(std::function<std::size_t()> queue_depth_fn);
+
+  private:
+    Registry& m_registry;
+    Registry::labels_t m_labels;
+
+    Counter m_received;
+    Counter m_emitted;
+    Gauge m_in_flight;
+    Histogram m_processing;
+};
+
+}  // namespace mrc::metrics
@@ -18,24 +18,18 @@
 #pragma once
 
 #include "mrc/metrics/counter.hpp"
+#include "mrc/metrics/gauge.hpp"
+#include "mrc/metrics/histogram.hpp"
 
 #include <cstddef>
+#include <functional>
 #include <map>
 #include <memory>
+#include <mutex>
 #include <string>
 #include <utility>
 #include <vector>
 
-// IWYU pragma: no_include "prometheus/family.h"
-
-namespace prometheus {
-class Registry;
-template <typename T>
-class Family;
-class Counter;
-
-}  // namespace prometheus
-
 namespace mrc::metrics {
 
 struct CounterReport
@@ -45,20 +39,56 @@ struct CounterReport
     std::size_t count;
 };
 
+/**
+ * @brief Owns the metrics of a pipeline, grouped into families by name and distinguished by their labels.
+ *
+ * Requesting a metric which already exists returns a handle to the existing one, so independent callers can share a
+ * metric by name and labels. Creating metrics and reading them takes a lock; updating them through the returned handles
+ * never does.
+ */
 class Registry
 {
   public:
+    using labels_t = std::map<std::string, std::string>;
+
     Registry();
+    ~Registry();
 
-    Counter make_counter(std::string name, std::map<std::string, std::string> labels);
+    Counter make_counter(std::string name, labels_t labels);
     Counter make_throughput_counter(std::string);
 
+    Gauge make_gauge(std::string name, labels_t labels);
+
+    /**
+     * @brief Registers a gauge whose value is sampled from sample_fn whenever the registry is read, e.g. the depth of a
+     * channel. Replaces any callback previously registered with the same name and labels. sample_fn is called with the
+     * registry lock held and must not call back into the registry.
+     */
+    void make_callback_gauge(std::string name, labels_t labels, std::function<double()> sample_fn);
+
+    /**
+     * @brief Histogram of unsigned values; scale converts recorded values to the exported unit, e.g. 1e-9 to export
+     * nanosecond latencies in seconds.
+     */
+    Histogram make_histogram(std::string name, labels_t labels, double scale = 1.0);
+
+    void set_help(const std::string& name, std::string help);
+
     std::vector<CounterReport> collect_throughput_counters() const;
 
-  protected:
+    /**
+     * @brief Renders all metrics in the Prometheus text exposition format (version 0.0.4)
+     */
+    std::string serialize() const;
+
   private:
-    std::shared_ptr<prometheus::Registry> m_registry;
-    prometheus::Family<prometheus::Counter>& m_throughput_counters;
+    enum class Type;
+    struct Family;
+
+    Family& get_family(const std::string& name, Type type);
+
+    mutable std::mutex m_mutex;
+    std::map<std::string, std::unique_ptr<Family>> m_families;
 };
 
 }  // namespace mrc::metrics
@@ -20,6 +20,7 @@
 #include "mrc/channel/status.hpp"
 #include "mrc/edge/deferred_edge.hpp"
 #include "mrc/edge/edge_builder.hpp"
+#include "mrc/edge/shared_payload.hpp"
 #include "mrc/node/sink_properties.hpp"
 #include "mrc/node/source_channel_owner.hpp"
 #include "mrc/node/source_properties.hpp"
@@ -28,6 +29,7 @@
 #include <memory>
 #include <mutex>
 #include <stdexcept>
+#include <utility>
 
 namespace mrc::node {
 
@@ -231,4 +233,86 @@ class Broadcast : public WritableProvider<T>, public edge::IWritableAcceptor<T>
     std::weak_ptr<BroadcastEdge> m_edge;
 };
 
+/**
+ * @brief Broadcast which wraps each value once in an immutable SharedPayload shared by all downstream edges, instead of
+ * copying the value for every downstream.
+ *
+ * Downstreams may accept SharedPayload<T> or std::shared_ptr<const T> to read the value without copying it, or T, in
+ * which case the payload is unwrapped by a converting edge and the value is copied only if another downstream still
+ * holds a reference to it.
+ */
+template <typename T>
+class SharedBroadcast : public WritableProvider<T>, public edge::IWritableAcceptor<edge::SharedPayload<T>>
+{
+    using payload_t = edge::SharedPayload<T>;
+
+    class SharedBroadcastEdge : public edge::IEdgeWritable<T>, public MultiSourceProperties<size_t, payload_t>
+    {
+      public:
+        SharedBroadcastEdge(SharedBroadcast& parent) : m_parent(parent) {}
+
+        ~SharedBroadcastEdge()
+        {
+            m_parent.on_complete();
+        }
+
+        channel::Status await_write(T&& data) override
+        {
+            payload_t payload(std::move(data));
+
+            for (size_t i = this->edge_connection_count() - 1; i > 0; --i)
+            {
+                CHECK(this->get_writable_edge(i)->await_write(payload_t(payload)) == channel::Status::success);
+            }
+
+            // hand over our reference last so a downstream which unwraps the value can move it if it is the only holder
+            return this->get_writable_edge(0)->await_write(std::move(payload));
+        }
+
+        void add_downstream(std::shared_ptr<edge::WritableEdgeHandle> downstream)
+        {
+            auto edge_count = this->edge_connection_count();
+
+            this->make_edge_connection(edge_count, downstream);
+        }
+
+      private:
+        SharedBroadcast& m_parent;
+    };
+
+  public:
+    SharedBroadcast()
+    {
+        // allow downstreams connected at runtime, e.g. through segment ports, to unwrap the payload
+        edge::SharedPayloadConnector<T>::register_converters();
+
+        auto edge = std::make_shared<SharedBroadcastEdge>(*this);
+
+        // Save to avoid casting
+        m_edge = edge;
+
+        WritableProvider<T>::init_owned_edge(edge);
+    }
+
+    void set_writable_edge_handle(std::shared_ptr<edge::WritableEdgeHandle> ingress) override
+    {
+        if (auto e = m_edge.lock())
+        {
+            e->add_downstream(ingress);
+        }
+        else
+        {
+            LOG(ERROR) << "Edge was destroyed";
+        }
+    }
+
+    void on_complete()
+    {
+        VLOG(10) << "SharedBroadcast completed";
+    }
+
+  private:
+    std::weak_ptr<SharedBroadcastEdge> m_edge;
+};
+
 }  // namespace mrc::node
@@ -24,9 +24,15 @@
 #include "mrc/node/source_channel_owner.hpp"
 #include "mrc/node/source_properties.hpp"
 
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
 #include <map>
 #include <memory>
+#include <mutex>
 #include <type_traits>
+#include <utility>
+#include <vector>
 
 namespace mrc::node {
 
@@ -53,6 +59,7 @@ class RouterBase : public ForwardingWritableProvider<InputT>, public MultiSource
     void drop_edge(const KeyT& key)
     {
         MultiSourceProperties<KeyT, output_data_t>::release_edge_connection(key);
+        this->on_edge_connections_changed();
     }
 
   protected:
@@ -67,6 +74,7 @@ class RouterBase : public ForwardingWritableProvider<InputT>, public MultiSource
             auto adapted_ingress = edge::EdgeBuilder::adapt_writable_edge<OutputT>(std::move(ingress));
 
             m_parent.MultiSourceProperties<KeyT, OutputT>::make_edge_connection(m_key, std::move(adapted_ingress));
+            m_parent.on_edge_connections_changed();
         }
 
       private:
@@ -78,6 +86,9 @@ class RouterBase : public ForwardingWritableProvider<InputT>, public MultiSource
     {
         MultiSourceProperties<KeyT, output_data_t>::release_edge_connections();
     }
+
+    // Called whenever a downstream edge is connected or dropped
+    virtual void on_edge_connections_changed() {}
 };
 
 template <typename KeyT, typename InputT, typename OutputT = InputT, typename = void>
@@ -138,6 +149,254 @@ class Router<KeyT, InputT, OutputT, std::enable_if_t<std::is_same_v<InputT, Outp
     virtual KeyT determine_key_for_value(const InputT& t) = 0;
 };
 
+namespace detail {
+
+/**
+ * @brief Immutable lookup table from keys to downstream edges.
+ *
+ * Integral and enum keys whose range is dense enough are indexed directly; all other key sets are stored as a sorted,
+ * contiguous array and searched with a binary search. The table owns a reference to each edge, so lookups return raw
+ * pointers without touching any reference count.
+ */
+template <typename KeyT, typename T>
+class FlatEdgeTable
+{
+    static constexpr bool IsIndexable = (std::is_integral_v<KeyT> && !std::is_same_v<KeyT, bool>) ||
+                                        std::is_enum_v<KeyT>;
+
+    // underlying integer of the key, only used when IsIndexable
+    using raw_key_t = typename std::
+        conditional_t<std::is_enum_v<KeyT>, std::underlying_type<KeyT>, std::type_identity<KeyT>>::type;
+
+  public:
+    using edge_t = edge::IEdgeWritable<T>;
+
+    // maximum number of unused slots per key before falling back to the sorted array
+    static constexpr std::size_t MaxSlotsPerKey = 4;
+    static constexpr std::size_t MinSlots       = 64;
+
+    /**
+     * @brief Rebuild the table; edges must be sorted by key with unique keys
+     */
+    void build(std::vector<std::pair<KeyT, std::shared_ptr<edge_t>>> edges)
+    {
+        clear();
+
+        m_keys.reserve(edges.size());
+        m_sorted.reserve(edges.size());
+        m_owned.reserve(edges.size());
+
+        for (auto& [key, edge] : edges)
+        {
+            m_keys.push_back(key);
+            m_sorted.push_back(edge.get());
+            m_owned.push_back(std::move(edge));
+        }
+
+        if constexpr (IsIndexable)
+        {
+            if (!m_keys.empty())
+            {
+                const auto range = offset(m_keys.back(), m_keys.front()) + 1;
+
+                if (range <= MaxSlotsPerKey * m_keys.size() + MinSlots)
+                {
+                    m_min_key = m_keys.front();
+                    m_direct.assign(range, nullptr);
+
+                    for (std::size_t i = 0; i < m_keys.size(); ++i)
+                    {
+                        m_direct[offset(m_keys[i], m_min_key)] = m_sorted[i];
+                    }
+                }
+            }
+        }
+    }
+
+    void clear()
+    {
+        m_direct.clear();
+        m_keys.clear();
+        m_sorted.clear();
+        m_owned.clear();
+    }
+
+    /**
+     * @brief Find the edge for key, or nullptr if none is connected
+     */
+    edge_t* find(const KeyT& key) const
+    {
+        if constexpr (IsIndexable)
+        {
+            if (!m_direct.empty())
+            {
+                // keys below the minimum wrap around to large offsets and fail the bounds check
+                const auto idx = offset(key, m_min_key);
+                return idx < m_direct.size() ? m_direct[idx] : nullptr;
+            }
+        }
+
+        auto found = std::lower_bound(m_keys.begin(), m_keys.end(), key);
+        if (found == m_keys.end() || key < *found)
+        {
+            return nullptr;
+        }
+        return m_sorted[found - m_keys.begin()];
+    }
+
+    bool is_direct() const
+    {
+        return !m_direct.empty();
+    }
+
+    std::size_t size() const
+    {
+        return m_keys.size();
+    }
+
+  private:
+    static std::size_t offset(const KeyT& key, const KeyT& base)
+    {
+        using index_t = std::make_unsigned_t<raw_key_t>;
+        return static_cast<std::size_t>(static_cast<index_t>(static_cast<index_t>(static_cast<raw_key_t>(key)) -
+                                                             static_cast<index_t>(static_cast<raw_key_t>(base))));
+    }
+
+    KeyT m_min_key{};
+    std::vector<edge_t*> m_direct;
+
+    std::vector<KeyT> m_keys;
+    std::vector<edge_t*> m_sorted;
+
+    std::vector<std::shared_ptr<edge_t>> m_owned;
+};
+
+}  // namespace detail
+
+/**
+ * @brief Router for high rate dispatch over a mostly static set of keys.
+ *
+ * The first value routed after the downstream edges change freezes the edge table into an immutable
+ * detail::FlatEdgeTable which is published as a raw pointer, so routing a value costs an atomic load, without any
+ * reference counting, followed by a single array index (dense integral or enum keys) or a binary search over a
+ * contiguous array (all other keys). Connecting or dropping an edge frees the table, so a dropped edge is released right
+ * away; edges must therefore not be reconfigured while values are being routed.
+ */
+template <typename KeyT, typename InputT, typename OutputT = InputT>
+class FlatRouterBase : public RouterBase<KeyT, InputT, OutputT>
+{
+    using table_t = detail::FlatEdgeTable<KeyT, OutputT>;
+
+  public:
+    /**
+     * @brief Build the edge table now rather than when the next value is routed
+     */
+    void freeze()
+    {
+        this->frozen_table();
+    }
+
+  protected:
+    /**
+     * @brief Find the edge for key; the edge stays alive until the downstream edges are next reconfigured
+     */
+    edge::IEdgeWritable<OutputT>* find_edge(const KeyT& key)
+    {
+        auto* edge = this->frozen_table()->find(key);
+
+        if (edge == nullptr)
+        {
+            throw exceptions::MrcRuntimeError("FlatRouter has no downstream edge connected for the routed key");
+        }
+
+        return edge;
+    }
+
+    void on_complete() override
+    {
+        this->discard_table();
+        RouterBase<KeyT, InputT, OutputT>::on_complete();
+    }
+
+  private:
+    const table_t* frozen_table()
+    {
+        const auto* table = m_table.load(std::memory_order_acquire);
+        if (table != nullptr)
+        {
+            return table;
+        }
+
+        std::lock_guard<std::mutex> lock(m_mutex);
+
+        if (!m_owned_table)
+        {
+            std::vector<std::pair<KeyT, std::shared_ptr<edge::IEdgeWritable<OutputT>>>> edges;
+            for (const auto& key : this->edge_connection_keys())
+            {
+                edges.emplace_back(key, MultiSourceProperties<KeyT, OutputT>::get_writable_edge(key));
+            }
+
+            auto built = std::make_unique<table_t>();
+            built->build(std::move(edges));
+
+            m_owned_table = std::move(built);
+            m_table.store(m_owned_table.get(), std::memory_order_release);
+        }
+        return m_owned_table.get();
+    }
+
+    void discard_table()
+    {
+        // edge reconfiguration never overlaps routing, so no reader can still hold a pointer into the table
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_table.store(nullptr, std::memory_order_release);
+        m_owned_table.reset();
+    }
+
+    void on_edge_connections_changed() override
+    {
+        this->discard_table();
+    }
+
+    std::mutex m_mutex;
+    std::unique_ptr<const table_t> m_owned_table;
+    std::atomic<const table_t*> m_table{nullptr};
+};
+
+template <typename KeyT, typename InputT, typename OutputT = InputT, typename = void>
+class FlatRouter;
+
+template <typename KeyT, typename InputT, typename OutputT>
+class FlatRouter<KeyT, InputT, OutputT, std::enable_if_t<std::is_convertible_v<InputT, OutputT>>>
+  : public FlatRouterBase<KeyT, InputT, OutputT>
+{
+  protected:
+    channel::Status on_next(InputT&& data) override
+    {
+        return this->find_edge(this->determine_key_for_value(data))->await_write(std::move(data));
+    }
+
+    virtual KeyT determine_key_for_value(const InputT& t) = 0;
+};
+
+template <typename KeyT, typename InputT, typename OutputT>
+class FlatRouter<KeyT, InputT, OutputT, std::enable_if_t<!std::is_convertible_v<InputT, OutputT>>>
+  : public FlatRouterBase<KeyT, InputT, OutputT>
+{
+  protected:
+    channel::Status on_next(InputT&& data) override
+    {
+        auto edge = this->find_edge(this->determine_key_for_value(data));
+
+        return edge->await_write(this->convert_value(std::move(data)));
+    }
+
+    virtual KeyT determine_key_for_value(const InputT& t) = 0;
+
+    virtual OutputT convert_value(InputT&& data) = 0;
+};
+
 template <typename KeyT, typename T>
 class TaggedRouter : public Router<KeyT, std::pair<KeyT, T>, T>
 {
@@ -159,4 +418,22 @@ class TaggedRouter : public Router<KeyT, std::pair<KeyT, T>, T>
     }
 };
 
+template <typename KeyT, typename T>
+class FlatTaggedRouter : public FlatRouter<KeyT, std::pair<KeyT, T>, T>
+{
+  protected:
+    using input_data_t  = std::pair<KeyT, T>;
+    using output_data_t = T;
+
+    KeyT determine_key_for_value(const input_data_t& data) override
+    {
+        return data.first;
+    }
+
+    output_data_t convert_value(input_data_t&& data) override
+    {
+        return std::move(data.second);
+    }
+};
+
 }  // namespace mrc::node
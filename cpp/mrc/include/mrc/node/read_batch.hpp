@@ -0,0 +1,113 @@
+/**
+ * SPDX-FileCopyrightText: Copyright (c) 2023, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include "mrc/channel/types.hpp"
+#include "mrc/utils/macros.hpp"
+
+#include <functional>
+#include <map>
+#include <optional>
+#include <vector>
+
+namespace mrc::node {
+
+/**
+ * @brief Scope covering the values a sink's progress engine delivers from a single read of its channel.
+ *
+ * Operators with a high fixed cost per call, e.g. acquiring the Python GIL, can hold values back until the end of the
+ * batch by registering a flush callback with the current ReadBatch and then process them together. The progress engine
+ * runs the callbacks after it has delivered the last value of the batch, before it waits on its channel again, and
+ * before it propagates an exception thrown while delivering a value.
+ *
+ * A ReadBatch is installed per fiber; current() returns nullptr outside of a sink progress engine, in which case
+ * operators should process each value immediately.
+ */
+class ReadBatch
+{
+  public:
+    ReadBatch();
+    ~ReadBatch();
+
+    DELETE_COPYABILITY(ReadBatch);
+    DELETE_MOVEABILITY(ReadBatch);
+
+    static ReadBatch* current();
+
+    /**
+     * @brief Run flush_fn once at the end of the batch. Callbacks registered while flushing, e.g. by an operator which
+     * receives the values released by an upstream operator, run as part of the same flush.
+     */
+    void defer(std::function<void()> flush_fn);
+
+    /**
+     * @brief Run all deferred callbacks in the order they were registered
+     */
+    void flush();
+
+  private:
+    ReadBatch* m_previous;
+    std::vector<std::function<void()>> m_flush_fns;
+};
+
+/**
+ * @brief Callbacks which a sink's progress engine runs once their deadline has passed, whether or not further values
+ * arrive.
+ *
+ * Operators which hold values across reads, e.g. a window with a timeout, can schedule a callback instead of running a
+ * timer of their own; the callback runs on the progress engine's fiber, within its runnable::Context. The engine limits
+ * each wait on its channel to the earliest deadline and runs the expired callbacks inside a ReadBatch, both after a
+ * wait times out and after each batch of values. An exception thrown by a callback is propagated like one thrown while
+ * delivering a value.
+ *
+ * ReadDeadlines are installed per fiber for the lifetime of the progress engine; current() returns nullptr outside of a
+ * sink progress engine, in which case operators have to rely on the arrival of values or the end of the stream.
+ */
+class ReadDeadlines
+{
+  public:
+    ReadDeadlines();
+    ~ReadDeadlines();
+
+    DELETE_COPYABILITY(ReadDeadlines);
+    DELETE_MOVEABILITY(ReadDeadlines);
+
+    static ReadDeadlines* current();
+
+    /**
+     * @brief Run callback_fn once deadline has passed; callbacks with the same deadline run in the order they were
+     * scheduled
+     */
+    void schedule(channel::time_point_t deadline, std::function<void()> callback_fn);
+
+    /**
+     * @brief Earliest deadline of the scheduled callbacks, if any
+     */
+    std::optional<channel::time_point_t> next() const;
+
+    /**
+     * @brief Run every callback whose deadline has passed; callbacks may schedule further callbacks
+     */
+    void run_expired();
+
+  private:
+    ReadDeadlines* m_previous;
+    std::multimap<channel::time_point_t, std::function<void()>> m_callbacks;
+};
+
+}  // namespace mrc::node
@@ -19,6 +19,7 @@
 
 #include "mrc/channel/buffered_channel.hpp"
 #include "mrc/node/forward.hpp"
+#include "mrc/node/sink_channel_owner.hpp"
 #include "mrc/node/sink_properties.hpp"
 
 namespace mrc::node {
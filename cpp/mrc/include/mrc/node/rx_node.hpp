@@ -19,6 +19,7 @@
 
 #include "mrc/channel/buffered_channel.hpp"
 #include "mrc/channel/channel.hpp"
+#include "mrc/channel/inline_channel.hpp"
 #include "mrc/constants.hpp"
 #include "mrc/core/utils.hpp"
 #include "mrc/core/watcher.hpp"
@@ -36,6 +37,7 @@
 #include <exception>
 #include <memory>
 #include <mutex>
+#include <utility>
 
 namespace mrc::node {
 
@@ -68,6 +70,16 @@ class RxNode : public RxSinkBase<InputT>,
 
     void make_stream(stream_fn_t fn);
 
+    /**
+     * @brief Runs the stream on the caller of the input edge instead of this node's own runnable. Each value written by
+     * the upstream passes through the operators, including the prologue/epilogue taps, before the write returns.
+     *
+     * Used by segment operator fusion. Must be called after the edges have been formed and before the upstream is
+     * launched; the node must not be launched afterwards. Returns false, leaving the node unchanged, if the input edge
+     * is shared by more than one writer.
+     */
+    bool run_inline();
+
   private:
     // the following method(s) are moved to private from their original scopes to prevent access from deriving classes
     using RxSinkBase<InputT>::observable;
@@ -79,9 +91,14 @@ class RxNode : public RxSinkBase<InputT>,
     void on_stop(const rxcpp::subscription& subscription) override;
     void on_kill(const rxcpp::subscription& subscription) final;
 
+    bool supports_elastic_instances() const final;
+
     // m_stream works like an operator. It is a function taking an observable and returning an observable. Allows
     // delayed construction of the observable chain for prologue/epilogue
     stream_fn_t m_stream;
+
+    // set by run_inline
+    rxcpp::composite_subscription m_inline_subscription;
 };
 
 template <typename InputT, typename OutputT, typename ContextT>
@@ -124,6 +141,51 @@ void RxNode<InputT, OutputT, ContextT>::do_subscribe(rxcpp::composite_subscripti
     observable_out.subscribe(subscription, RxSourceBase<OutputT>::observer());
 }
 
+template <typename InputT, typename OutputT, typename ContextT>
+bool RxNode<InputT, OutputT, ContextT>::run_inline()
+{
+    if (this->channel_writer_connection_count() != 1)
+    {
+        return false;
+    }
+
+    rxcpp::subjects::subject<InputT> subject;
+    auto subscriber = subject.get_subscriber();
+
+    auto channel = std::make_unique<channel::InlineChannel<InputT>>(
+        [this, subscriber](InputT&& data) mutable {
+            this->inline_on_next(subscriber, std::move(data));
+        },
+        [subscriber]() mutable {
+            subscriber.on_completed();
+        });
+
+    if (!this->replace_channel(std::move(channel)))
+    {
+        return false;
+    }
+
+    // same chain as do_subscribe, but fed by the subject rather than the channel reader
+    auto observable_in  = this->apply_prologue_taps(subject.get_observable());
+    auto observable_out = this->apply_epilogue_taps(m_stream(observable_in));
+
+    const auto& observer = RxSourceBase<OutputT>::observer();
+    observable_out.subscribe(m_inline_subscription,
+                             rxcpp::make_observer_dynamic<OutputT>(
+                                 [observer](OutputT data) {
+                                     observer.on_next(std::move(data));
+                                 },
+                                 [observer](std::exception_ptr ptr) {
+                                     observer.on_error(std::move(ptr));
+                                 },
+                                 [this]() {
+                                     // there is no runnable to reach on_shutdown_critical_section
+                                     RxSourceBase<OutputT>::release_edge_connection();
+                                 }));
+
+    return true;
+}
+
 template <typename InputT, typename OutputT, typename ContextT>
 void RxNode<InputT, OutputT, ContextT>::on_stop(const rxcpp::subscription& subscription)
 {
@@ -144,6 +206,13 @@ void RxNode<InputT, OutputT, ContextT>::on_shutdown_critical_section()
     RxSourceBase<OutputT>::release_edge_connection();
 }
 
+template <typename InputT, typename OutputT, typename ContextT>
+bool RxNode<InputT, OutputT, ContextT>::supports_elastic_instances() const
+{
+    // every instance drains the shared input channel on its own and the output is only released by rank 0
+    return true;
+}
+
 template <typename T>
 class EdgeRxSubscriber : public edge::IEdgeWritable<T>
 {
@@ -76,9 +76,16 @@ void RxRunnable<ContextT>::run(ContextT& ctx)
 template <typename ContextT>
 void RxRunnable<ContextT>::shutdown(ContextT& ctx)
 {
+    if (ctx.is_elastic())
+    {
+        // rank 0 waits for the elastic instances before it enters the critical section
+        return;
+    }
+
     ctx.barrier();
     if (ctx.rank() == 0)
     {
+        ctx.await_elastic_instances();
         DVLOG(10) << ctx.info() << " critical section shutdown - start";
         will_complete();
         on_shutdown_critical_section();
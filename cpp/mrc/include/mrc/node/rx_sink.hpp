@@ -111,6 +111,8 @@ class RxSink : public RxSinkBase<T>, public RxRunnable<ContextT>, public RxProlo
     void on_stop(const rxcpp::subscription& subscription) final;
     void on_kill(const rxcpp::subscription& subscription) final;
 
+    bool supports_elastic_instances() const final;
+
     observer_t m_observer;
 };
 
@@ -140,6 +142,11 @@ void RxSink<T, ContextT>::do_subscribe(rxcpp::composite_subscription& subscripti
             }
         },
         [this] {
+            // each instance completes its subscriber; a retired elastic instance must not end the stream for the others
+            if (runnable::Context::get_runtime_context().retire_requested())
+            {
+                return;
+            }
             m_observer.on_completed();
         });
 
@@ -163,6 +170,13 @@ template <typename T, typename ContextT>
 void RxSink<T, ContextT>::on_shutdown_critical_section()
 {}
 
+template <typename T, typename ContextT>
+bool RxSink<T, ContextT>::supports_elastic_instances() const
+{
+    // every instance drains the shared input channel on its own
+    return true;
+}
+
 template <typename T>
 class RxSinkComponent : public WritableProvider<T>
 {
@@ -20,22 +20,36 @@
 #include "mrc/channel/buffered_channel.hpp"
 #include "mrc/channel/channel.hpp"
 #include "mrc/channel/status.hpp"
+#include "mrc/channel/types.hpp"
 #include "mrc/constants.hpp"
 #include "mrc/core/utils.hpp"
 #include "mrc/core/watcher.hpp"
 #include "mrc/exceptions/runtime_error.hpp"
 #include "mrc/node/forward.hpp"
+#include "mrc/node/read_batch.hpp"
 #include "mrc/node/sink_channel_owner.hpp"
+#include "mrc/runnable/context.hpp"
+#include "mrc/tracing/event_trace.hpp"
 #include "mrc/utils/type_utils.hpp"
 
 #include <glog/logging.h>
 #include <rxcpp/rx.hpp>
 
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
 #include <exception>
 #include <iomanip>
+#include <iterator>
 #include <memory>
 #include <mutex>
+#include <optional>
+#include <span>
 #include <string>
+#include <utility>
+#include <vector>
 
 namespace mrc::node {
 
@@ -46,18 +60,51 @@ class RxSinkBase : public WritableProvider<T>, public ReadableAcceptor<T>, publi
     void sink_add_watcher(std::shared_ptr<WatcherInterface> watcher);
     void sink_remove_watcher(std::shared_ptr<WatcherInterface> watcher);
 
+    /**
+     * @brief Controls how many values the progress engine delivers per read of the input channel; each read is
+     * delivered inside a ReadBatch. After the first value of a read arrives, the engine waits up to max_wait for the
+     * read to fill up to max_count values. Without a call, a sink with a single instance batches up to
+     * MRC_SINK_READ_BATCH_SIZE values which are already buffered, while the instances of a sink with several, or
+     * elastic, instances read one value at a time so no instance holds back values its idle siblings could process.
+     * Must be called before the sink is launched.
+     */
+    void set_read_batch(std::size_t max_count, std::chrono::microseconds max_wait = std::chrono::microseconds(0));
+
+    /**
+     * @brief Names the spans the progress engine records for channel reads and values handed to the node while event
+     * tracing is enabled; unnamed sinks are not traced. Must be called before the sink is launched.
+     */
+    void sink_set_trace_name(const std::string& name);
+
   protected:
     RxSinkBase();
     ~RxSinkBase() override = default;
 
     const rxcpp::observable<T>& observable() const;
 
+    // delivers a value written to the input edge directly to s; used when the sink runs in its upstream's context
+    void inline_on_next(rxcpp::subscriber<T>& s, T&& data);
+
   private:
     // this is our channel reader progress engine
     void progress_engine(rxcpp::subscriber<T>& s);
 
+    // hands values which were read from the channel, but not delivered because the subscriber unsubscribed in the
+    // middle of a batch, to the other instances of the runnable
+    void return_unread(std::span<T> items);
+    bool take_unread(std::span<T> items, std::size_t& count);
+
     // observable
     rxcpp::observable<T> m_observable;
+
+    std::optional<std::size_t> m_read_batch_size;
+    std::chrono::microseconds m_read_batch_wait{0};
+
+    std::uint32_t m_trace_id{0};
+
+    std::mutex m_unread_mutex;
+    std::vector<T> m_unread;
+    std::atomic<bool> m_has_unread{false};
 };
 
 template <typename T>
@@ -67,7 +114,7 @@ RxSinkBase<T>::RxSinkBase() :
   }))
 {
     // Set the default channel
-    this->set_channel(std::make_unique<mrc::channel::BufferedChannel<T>>());
+    this->set_default_channel(std::make_unique<mrc::channel::BufferedChannel<T>>());
 }
 
 template <typename T>
@@ -76,21 +123,215 @@ const rxcpp::observable<T>& RxSinkBase<T>::observable() const
     return m_observable;
 }
 
+template <typename T>
+void RxSinkBase<T>::inline_on_next(rxcpp::subscriber<T>& s, T&& data)
+{
+    this->watcher_prologue(WatchableEvent::sink_on_data, &data);
+    const auto span = tracing::begin_span(m_trace_id);
+    s.on_next(std::move(data));
+    tracing::end_span(tracing::EventType::node, m_trace_id, span);
+}
+
+template <typename T>
+void RxSinkBase<T>::set_read_batch(std::size_t max_count, std::chrono::microseconds max_wait)
+{
+    CHECK_GT(max_count, 0) << "read batch size must be at least one";
+    m_read_batch_size = max_count;
+    m_read_batch_wait = max_wait;
+}
+
+template <typename T>
+void RxSinkBase<T>::sink_set_trace_name(const std::string& name)
+{
+    m_trace_id = tracing::intern(name);
+}
+
 template <typename T>
 void RxSinkBase<T>::progress_engine(rxcpp::subscriber<T>& s)
 {
-    T data;
-    this->watcher_prologue(WatchableEvent::channel_read, &data);
-    while (s.is_subscribed() && (this->get_readable_edge()->await_read(data) == channel::Status::success))
+    // instances of an elastic runnable wake up at least once per scaling interval, so a retired instance stops even
+    // if its input is idle, and report the time they spend on each batch to the autoscaler
+    auto* context = runnable::Context::has_runtime_context() ? &runnable::Context::get_runtime_context() : nullptr;
+    const auto scaling_interval = context != nullptr ? context->scaling_interval() : std::chrono::nanoseconds(0);
+    const bool scaling          = scaling_interval.count() > 0;
+    auto queue_depth            = scaling ? this->channel_depth_fn() : nullptr;
+
+    // draining the values already buffered saves a channel synchronization per value, but the values of a batch are
+    // processed one after another by this instance; sibling instances would sit idle, so a sink with several or
+    // elastic instances reads one value at a time unless set_read_batch asked for more. A configured wait lets a
+    // batch linger for more values and trades latency for throughput.
+    const bool shared_input = context != nullptr && (context->size() > 1 || scaling);
+    const auto batch_size   = m_read_batch_size.value_or(shared_input ? 1 : MRC_SINK_READ_BATCH_SIZE);
+
+    auto storage = std::make_unique<T[]>(batch_size);
+    std::span<T> batch(storage.get(), batch_size);
+    std::size_t count = 0;
+
+    auto edge = this->get_readable_edge();
+
+    // callbacks scheduled by the operators of this node run on this fiber once their deadline passes
+    ReadDeadlines deadlines;
+
+    auto run_expired_deadlines = [&]() {
+        ReadBatch read_batch;
+        try
+        {
+            deadlines.run_expired();
+        } catch (...)
+        {
+            read_batch.flush();
+            throw;
+        }
+        read_batch.flush();
+    };
+
+    // waits for the next read, waking up for each scheduled deadline and, on elastic instances, each scaling interval
+    auto await_batch = [&]() {
+        auto next_tick = channel::clock_t::now() + scaling_interval;
+        while (true)
+        {
+            auto deadline = deadlines.next();
+            if (scaling && (!deadline || next_tick < *deadline))
+            {
+                deadline = next_tick;
+            }
+            if (!deadline)
+            {
+                return edge->await_read_up_to(batch, count);
+            }
+
+            auto status = edge->await_read_up_to(batch, count, *deadline);
+            if (status != channel::Status::timeout)
+            {
+                return status;
+            }
+
+            run_expired_deadlines();
+
+            if (scaling && channel::clock_t::now() >= next_tick)
+            {
+                if (!context->scaling_tick(std::chrono::nanoseconds(0), queue_depth()))
+                {
+                    return status;
+                }
+                next_tick = channel::clock_t::now() + scaling_interval;
+            }
+        }
+    };
+
+    // trace spans are carried on this fiber's stack, so fibers interleaving on a thread cannot mix them up
+    auto read_span = tracing::begin_span(m_trace_id);
+    this->watcher_prologue(WatchableEvent::channel_read, batch.data());
+    while (s.is_subscribed() && (take_unread(batch, count) || await_batch() == channel::Status::success))
+    {
+        if (m_read_batch_wait.count() > 0 && count < batch.size())
+        {
+            // linger for the rest of the batch, but not past a scheduled deadline; a timeout or closed channel simply
+            // ends the batch early
+            auto deadline = channel::clock_t::now() + m_read_batch_wait;
+            if (auto scheduled = deadlines.next(); scheduled && *scheduled < deadline)
+            {
+                deadline = *scheduled;
+            }
+            std::size_t read = 0;
+            while (count < batch.size() &&
+                   edge->await_read_up_to(batch.subspan(count), read, deadline) == channel::Status::success)
+            {
+                count += read;
+            }
+        }
+        tracing::end_span(tracing::EventType::channel_read, m_trace_id, read_span);
+
+        channel::time_point_t started{};
+        if (scaling)
+        {
+            started = channel::clock_t::now();
+        }
+
+        // every value gets its own read and on_data events; the read of the first value was opened before the wait
+        std::size_t delivered = 0;
+        ReadBatch read_batch;
+        try
+        {
+            for (; delivered < count && s.is_subscribed(); ++delivered)
+            {
+                if (delivered > 0)
+                {
+                    this->watcher_prologue(WatchableEvent::channel_read, &batch[delivered]);
+                }
+                this->watcher_epilogue(WatchableEvent::channel_read, true, &batch[delivered]);
+                this->watcher_prologue(WatchableEvent::sink_on_data, &batch[delivered]);
+                const auto span = tracing::begin_span(m_trace_id);
+                s.on_next(std::move(batch[delivered]));
+                tracing::end_span(tracing::EventType::node, m_trace_id, span);
+            }
+
+            // a busy input never times out, so deadlines which passed while the batch was processed run here
+            if (s.is_subscribed())
+            {
+                deadlines.run_expired();
+            }
+        } catch (...)
+        {
+            // values deferred by earlier on_next calls of this batch must not be lost
+            read_batch.flush();
+            throw;
+        }
+        read_batch.flush();
+
+        if (delivered < count)
+        {
+            return_unread(batch.subspan(delivered, count - delivered));
+        }
+
+        if (scaling)
+        {
+            const auto busy_time = channel::clock_t::now() - started;
+            if (!context->scaling_tick(std::chrono::duration_cast<std::chrono::nanoseconds>(busy_time), queue_depth()))
+            {
+                DVLOG(10) << context->info() << " retired";
+                break;
+            }
+        }
+
+        read_span = tracing::begin_span(m_trace_id);
+        this->watcher_prologue(WatchableEvent::channel_read, batch.data());
+    }
+
+    // a retired instance only stops reading; the stream has not ended, so the observer is completed by the instances
+    // which drain the channel once it is closed
+    if (context != nullptr && context->retire_requested())
     {
-        this->watcher_epilogue(WatchableEvent::channel_read, true, &data);
-        this->watcher_prologue(WatchableEvent::sink_on_data, &data);
-        s.on_next(std::move(data));
-        this->watcher_prologue(WatchableEvent::channel_read, &data);
+        DVLOG(10) << context->info() << " retired without completing the observer";
+        return;
     }
     s.on_completed();
 }
 
+template <typename T>
+void RxSinkBase<T>::return_unread(std::span<T> items)
+{
+    std::lock_guard<decltype(m_unread_mutex)> lock(m_unread_mutex);
+    std::move(items.begin(), items.end(), std::back_inserter(m_unread));
+    m_has_unread.store(true, std::memory_order_release);
+}
+
+template <typename T>
+bool RxSinkBase<T>::take_unread(std::span<T> items, std::size_t& count)
+{
+    if (!m_has_unread.load(std::memory_order_acquire))
+    {
+        return false;
+    }
+
+    std::lock_guard<decltype(m_unread_mutex)> lock(m_unread_mutex);
+    count = std::min(items.size(), m_unread.size());
+    std::move(m_unread.begin(), m_unread.begin() + count, items.begin());
+    m_unread.erase(m_unread.begin(), m_unread.begin() + count);
+    m_has_unread.store(!m_unread.empty(), std::memory_order_release);
+    return count > 0;
+}
+
 template <typename T>
 void RxSinkBase<T>::sink_add_watcher(std::shared_ptr<WatcherInterface> watcher)
 {
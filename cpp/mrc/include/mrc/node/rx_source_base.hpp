@@ -26,14 +26,17 @@
 #include "mrc/exceptions/runtime_error.hpp"
 #include "mrc/node/source_channel_owner.hpp"
 #include "mrc/runnable/context.hpp"
+#include "mrc/tracing/event_trace.hpp"
 #include "mrc/utils/type_utils.hpp"
 
 #include <glog/logging.h>
 #include <rxcpp/rx.hpp>
 
+#include <cstdint>
 #include <exception>
 #include <memory>
 #include <mutex>
+#include <string>
 
 namespace mrc::node {
 
@@ -54,6 +57,12 @@ class RxSourceBase : public ReadableProvider<T>,
     void source_add_watcher(std::shared_ptr<WatcherInterface> watcher);
     void source_remove_watcher(std::shared_ptr<WatcherInterface> watcher);
 
+    /**
+     * @brief Names the spans recorded for channel writes while event tracing is enabled; unnamed sources are not
+     * traced. Must be called before the source is launched.
+     */
+    void source_set_trace_name(const std::string& name);
+
   protected:
     RxSourceBase();
     ~RxSourceBase() override = default;
@@ -65,6 +74,8 @@ class RxSourceBase : public ReadableProvider<T>,
     // using SourceChannelOwner<T>::await_write;
 
     rxcpp::observer<T> m_observer;
+
+    std::uint32_t m_trace_id{0};
 };
 
 template <typename T>
@@ -73,7 +84,9 @@ RxSourceBase<T>::RxSourceBase() :
       [this](T data) {
           this->watcher_epilogue(WatchableEvent::sink_on_data, true, &data);
           this->watcher_prologue(WatchableEvent::channel_write, &data);
+          const auto span = tracing::begin_span(m_trace_id);
           this->get_writable_edge()->await_write(std::move(data));
+          tracing::end_span(tracing::EventType::channel_write, m_trace_id, span);
           this->watcher_epilogue(WatchableEvent::channel_write, true, &data);
       },
       [](std::exception_ptr ptr) {
@@ -102,4 +115,10 @@ void RxSourceBase<T>::source_remove_watcher(std::shared_ptr<WatcherInterface> wa
     Watchable::remove_watcher(std::move(watcher));
 }
 
+template <typename T>
+void RxSourceBase<T>::source_set_trace_name(const std::string& name)
+{
+    m_trace_id = tracing::intern(name);
+}
+
 }  // namespace mrc::node
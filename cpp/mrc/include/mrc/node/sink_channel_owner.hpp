@@ -21,6 +21,9 @@
 #include "mrc/node/forward.hpp"
 #include "mrc/node/sink_properties.hpp"
 
+#include <cstddef>
+#include <functional>
+#include <memory>
 #include <mutex>
 
 namespace mrc::node {
@@ -39,11 +42,67 @@ class SinkChannelOwner : public virtual SinkProperties<T>
         edge::EdgeChannel<T> edge_channel(std::move(channel));
 
         this->do_set_channel(edge_channel);
+        m_has_default_channel = false;
+    }
+
+    /**
+     * @brief True while the sink holds the channel it was constructed with; only such a channel may be swapped by
+     * replace_channel, a channel installed with set_channel is the user's choice and is kept
+     */
+    bool has_default_channel() const
+    {
+        return m_has_default_channel;
+    }
+
+    /**
+     * @brief Swaps the channel behind an already connected sink without disturbing its edges. Returns false if the
+     * channel edges are no longer alive. Must only be called before the sink and its upstreams have been launched.
+     */
+    bool replace_channel(std::unique_ptr<mrc::channel::Channel<T>> channel)
+    {
+        auto reader = m_channel_reader.lock();
+        auto writer = m_channel_writer.lock();
+
+        if (!reader || !writer)
+        {
+            return false;
+        }
+
+        edge::EdgeChannel<T>::rebind(*reader, *writer, std::move(channel));
+        return true;
+    }
+
+    /**
+     * @brief Number of upstream connections sharing the channel writer
+     */
+    std::size_t channel_writer_connection_count() const
+    {
+        auto writer = m_channel_writer.lock();
+        return writer ? writer->connection_count() : 0;
+    }
+
+    /**
+     * @brief Returns a function reporting the number of values buffered in the channel. The function does not keep the
+     * node alive and reports zero once the channel edges have been released.
+     */
+    std::function<std::size_t()> channel_depth_fn() const
+    {
+        return [writer = m_channel_writer]() -> std::size_t {
+            auto locked = writer.lock();
+            return locked ? locked->queue_depth() : 0;
+        };
     }
 
   protected:
     SinkChannelOwner() = default;
 
+    // installs the channel a node is constructed with
+    void set_default_channel(std::unique_ptr<mrc::channel::Channel<T>> channel)
+    {
+        set_channel(std::move(channel));
+        m_has_default_channel = true;
+    }
+
     void do_set_channel(edge::EdgeChannel<T>& edge_channel)
     {
         // Create 2 edges, one for reading and writing. On connection, persist the other to allow the node to still use
@@ -51,6 +110,9 @@ class SinkChannelOwner : public virtual SinkProperties<T>
         auto channel_reader = edge_channel.get_reader();
         auto channel_writer = edge_channel.get_writer();
 
+        m_channel_reader = channel_reader;
+        m_channel_writer = channel_writer;
+
         channel_writer->add_connector([this, channel_reader]() {
             // Finally, set the other half as the connected edge to allow readers the ability to pull from the channel.
             // Only do this after a full connection has been made to avoid reading from a channel that will never be
@@ -60,6 +122,11 @@ class SinkChannelOwner : public virtual SinkProperties<T>
 
         SinkProperties<T>::init_owned_edge(channel_writer);
     }
+
+  private:
+    std::weak_ptr<edge::EdgeChannelReader<T>> m_channel_reader;
+    std::weak_ptr<edge::EdgeChannelWriter<T>> m_channel_writer;
+    bool m_has_default_channel{false};
 };
 
 }  // namespace mrc::node
@@ -69,17 +69,26 @@ class EngineGroups final
     void set_default_engine_type(runnable::EngineType engine_type);
     void set_ignore_hyper_threads(bool default_false);
 
+    /**
+     * @brief When enabled, each segment is built with adjacent RxNode stages fused into a single runnable. A node is
+     * fused into its upstream when it is fed by exactly one other node, the two are connected 1:1, and both run a single
+     * engine from the same engine factory. Fused nodes keep their names, taps and metrics but are not launched.
+     */
+    void set_fuse_operator_chains(bool default_false);
+
     const EngineFactoryOptions& engine_group_options(const std::string& name) const;
     const std::map<std::string, EngineFactoryOptions>& map() const;
     bool dedicated_main_thread() const;
     bool dedicated_network_thread() const;
     bool ignore_hyper_threads() const;
+    bool fuse_operator_chains() const;
     runnable::EngineType default_engine_type() const;
 
   private:
     bool m_dedicated_main_thread{false};
     bool m_dedicated_network_thread{false};
     bool m_ignore_hyper_threads{false};
+    bool m_fuse_operator_chains{false};
     runnable::EngineType m_default_engine_type{runnable::EngineType::Fiber};
     std::map<std::string, EngineFactoryOptions> m_engine_resource_groups;
 };
@@ -39,14 +39,24 @@ class FiberPoolOptions
      **/
     FiberPoolOptions& enable_tracing_scheduler(bool default_false);
 
+    /**
+     * @brief enable work stealing between the threads of a fiber pool which share a numa node
+     *
+     * Only fibers launched by reusable fiber engine factories are allowed to migrate; runnables in those pools must
+     * not hold thread affine resources, e.g. the Python GIL, across a fiber suspension point.
+     **/
+    FiberPoolOptions& enable_work_stealing(bool default_false);
+
     [[nodiscard]] bool enable_memory_binding() const;
     [[nodiscard]] bool enable_thread_binding() const;
     [[nodiscard]] bool enable_tracing_scheduler() const;
+    [[nodiscard]] bool enable_work_stealing() const;
 
   private:
     bool m_enable_memory_binding{true};
     bool m_enable_thread_binding{true};
     bool m_enable_tracing_scheduler{false};
+    bool m_enable_work_stealing{false};
 };
 
 }  // namespace mrc
@@ -0,0 +1,77 @@
+/**
+ * SPDX-FileCopyrightText: Copyright (c) 2022-2023, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <chrono>
+#include <cstdint>
+#include <string>
+
+namespace mrc {
+
+/**
+ * @brief Collection and export of pipeline metrics
+ *
+ * Every pipeline owns a metrics::Registry. When an export port or path is set, the registry is published in the
+ * Prometheus text format over http at GET /metrics and/or written to a file for the lifetime of the pipeline.
+ */
+class MetricsOptions
+{
+  public:
+    MetricsOptions() = default;
+
+    /**
+     * @brief register throughput, in-flight, latency and queue depth metrics for every node created by a segment; the
+     * metrics are fed by watchers on each node, which adds a virtual call and a clock read per value
+     **/
+    MetricsOptions& node_metrics(bool default_false);
+
+    /**
+     * @brief address on which the metrics endpoint listens
+     **/
+    MetricsOptions& export_address(std::string address);
+
+    /**
+     * @brief port on which the metrics endpoint listens; zero disables the endpoint
+     **/
+    MetricsOptions& export_port(std::uint16_t port);
+
+    /**
+     * @brief file to which the metrics are periodically written; empty disables the file export
+     **/
+    MetricsOptions& export_path(std::string path);
+
+    /**
+     * @brief time between writes of the metrics file
+     **/
+    MetricsOptions& export_interval(std::chrono::milliseconds interval);
+
+    [[nodiscard]] bool node_metrics() const;
+    [[nodiscard]] const std::string& export_address() const;
+    [[nodiscard]] std::uint16_t export_port() const;
+    [[nodiscard]] const std::string& export_path() const;
+    [[nodiscard]] std::chrono::milliseconds export_interval() const;
+
+  private:
+    bool m_node_metrics{false};
+    std::string m_export_address{"127.0.0.1"};
+    std::uint16_t m_export_port{0};
+    std::string m_export_path;
+    std::chrono::milliseconds m_export_interval{5000};
+};
+
+}  // namespace mrc
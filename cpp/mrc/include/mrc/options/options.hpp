@@ -19,7 +19,9 @@
 
 #include "mrc/options/engine_groups.hpp"
 #include "mrc/options/fiber_pool.hpp"
+#include "mrc/options/metrics.hpp"
 #include "mrc/options/placement.hpp"
+#include "mrc/options/progress_engine.hpp"
 #include "mrc/options/resources.hpp"
 #include "mrc/options/services.hpp"
 #include "mrc/options/topology.hpp"
@@ -37,7 +39,9 @@ class Options
 
     EngineGroups& engine_factories();
     FiberPoolOptions& fiber_pool();
+    MetricsOptions& metrics();
     PlacementOptions& placement();
+    ProgressEngineOptions& progress_engine();
     ResourceOptions& resources();
     ServiceOptions& services();
     TopologyOptions& topology();
@@ -49,7 +53,9 @@ class Options
 
     [[nodiscard]] const EngineGroups& engine_factories() const;
     [[nodiscard]] const FiberPoolOptions& fiber_pool() const;
+    [[nodiscard]] const MetricsOptions& metrics() const;
     [[nodiscard]] const PlacementOptions& placement() const;
+    [[nodiscard]] const ProgressEngineOptions& progress_engine() const;
     [[nodiscard]] const ResourceOptions& resources() const;
     [[nodiscard]] const ServiceOptions& services() const;
     [[nodiscard]] const TopologyOptions& topology() const;
@@ -62,7 +68,9 @@ class Options
   private:
     std::unique_ptr<EngineGroups> m_engine_groups;
     std::unique_ptr<FiberPoolOptions> m_fiber_pool;
+    std::unique_ptr<MetricsOptions> m_metrics;
     std::unique_ptr<PlacementOptions> m_placement;
+    std::unique_ptr<ProgressEngineOptions> m_progress_engine;
     std::unique_ptr<ResourceOptions> m_resources;
     std::unique_ptr<ServiceOptions> m_services;
     std::unique_ptr<TopologyOptions> m_topology;
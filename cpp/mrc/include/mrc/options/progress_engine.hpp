@@ -0,0 +1,73 @@
+/**
+ * SPDX-FileCopyrightText: Copyright (c) 2022-2023, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <chrono>
+#include <cstddef>
+
+namespace mrc {
+
+/**
+ * @brief Polling behavior of the network progress engines
+ *
+ * A progress engine polls without pause while events are arriving. After spin_count consecutive empty polls it sleeps
+ * between polls, doubling the sleep up to max_backoff. If parking is enabled, once it has been idle for park_threshold
+ * it blocks its thread on the event file descriptor of the ucx worker until an event arrives or park_timeout expires.
+ *
+ * Parking is off by default: a parked engine blocks every fiber on the network thread, and work which reaches those
+ * fibers without a wake of the worker, e.g. tasks on the network task queue, waits for up to park_timeout.
+ */
+class ProgressEngineOptions
+{
+  public:
+    ProgressEngineOptions() = default;
+
+    /**
+     * @brief number of consecutive empty polls before the progress engine starts backing off
+     **/
+    ProgressEngineOptions& spin_count(std::size_t count);
+
+    /**
+     * @brief upper bound of the exponentially growing sleep between empty polls
+     **/
+    ProgressEngineOptions& max_backoff(std::chrono::microseconds duration);
+
+    /**
+     * @brief idle time after which the progress engine parks on the event file descriptor; zero, the default, disables
+     * parking
+     **/
+    ProgressEngineOptions& park_threshold(std::chrono::microseconds duration);
+
+    /**
+     * @brief maximum time a parked progress engine blocks its thread before polling again
+     **/
+    ProgressEngineOptions& park_timeout(std::chrono::milliseconds duration);
+
+    [[nodiscard]] std::size_t spin_count() const;
+    [[nodiscard]] std::chrono::microseconds max_backoff() const;
+    [[nodiscard]] std::chrono::microseconds park_threshold() const;
+    [[nodiscard]] std::chrono::milliseconds park_timeout() const;
+
+  private:
+    std::size_t m_spin_count{256};
+    std::chrono::microseconds m_max_backoff{50};
+    std::chrono::microseconds m_park_threshold{0};
+    std::chrono::milliseconds m_park_timeout{10};
+};
+
+}  // namespace mrc
@@ -21,6 +21,21 @@
 
 namespace mrc {
 
+/**
+ * @brief Page type backing the blocks a host memory pool draws from the system
+ */
+enum class HugePages
+{
+    /// regular pages from the system allocator
+    Disabled,
+    /// 2 MiB aligned anonymous mappings advised with MADV_HUGEPAGE; the kernel backs them with transparent huge pages
+    Transparent,
+    /// 2 MiB pages from the reserved hugetlbfs pool; falls back to Transparent when the pool is exhausted
+    Explicit2MiB,
+    /// 1 GiB pages from the reserved hugetlbfs pool; falls back to Transparent when the pool is exhausted
+    Explicit1GiB,
+};
+
 class MemoryPoolOptions
 {
   public:
@@ -37,6 +52,25 @@ class MemoryPoolOptions
         return *this;
     }
 
+    /**
+     * @brief back the pool with huge pages (default: HugePages::Disabled); only honored by host memory pools
+     */
+    MemoryPoolOptions& huge_pages(HugePages value)
+    {
+        m_huge_pages = value;
+        return *this;
+    }
+
+    /**
+     * @brief fault in pool blocks when they are allocated, i.e. the initial block at startup, rather than on first touch
+     * (default: false); only honored by host memory pools backed by huge pages
+     */
+    MemoryPoolOptions& prefault(bool value)
+    {
+        m_prefault = value;
+        return *this;
+    }
+
     [[nodiscard]] std::size_t block_size() const
     {
         return m_block_size;
@@ -45,10 +79,20 @@ class MemoryPoolOptions
     {
         return m_max_aggregate_bytes;
     }
+    [[nodiscard]] HugePages huge_pages() const
+    {
+        return m_huge_pages;
+    }
+    [[nodiscard]] bool prefault() const
+    {
+        return m_prefault;
+    }
 
   private:
     std::size_t m_block_size;
     std::size_t m_max_aggregate_bytes;
+    HugePages m_huge_pages{HugePages::Disabled};
+    bool m_prefault{false};
 };
 
 class ResourceOptions
@@ -0,0 +1,83 @@
+/**
+ * SPDX-FileCopyrightText: Copyright (c) 2022-2023, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <cstddef>
+
+namespace mrc::runnable {
+
+/**
+ * @brief State of an elastic Runnable which the Runner hands to its AutoscalerPolicy once per autoscale interval
+ */
+struct AutoscalerSample
+{
+    /// instances which are launched and not retiring
+    std::size_t instance_count;
+    /// instances launched with the Runnable, which are never retired
+    std::size_t min_instances;
+    /// LaunchOptions::max_instances
+    std::size_t max_instances;
+    /// values waiting in the input channel
+    std::size_t queue_depth;
+    /// mean fraction of the last interval the instances spent processing values, between 0 and 1
+    double utilization;
+};
+
+/**
+ * @brief Decides how many instances an elastic Runnable should run.
+ *
+ * A policy is owned by a single Runner, which serializes all calls to target_instance_count().
+ */
+class AutoscalerPolicy
+{
+  public:
+    virtual ~AutoscalerPolicy() = default;
+
+    /**
+     * @brief Number of instances the Runnable should run; the Runner clamps it to [min_instances, max_instances]
+     */
+    virtual std::size_t target_instance_count(const AutoscalerSample& sample) = 0;
+};
+
+/**
+ * @brief Default policy; scales the instances so their utilization moves to the middle of the band between
+ * scale_down_utilization and scale_up_utilization.
+ *
+ * Instances are added while utilization is above the band and values queue up on the input, and retired while it is
+ * below the band and the input is not backed up. A change is only made once its condition held for patience
+ * consecutive samples, so short bursts do not make the node flap.
+ */
+class UtilizationAutoscalerPolicy final : public AutoscalerPolicy
+{
+  public:
+    UtilizationAutoscalerPolicy(double scale_up_utilization   = 0.8,
+                                double scale_down_utilization = 0.3,
+                                std::size_t patience          = 3);
+
+    std::size_t target_instance_count(const AutoscalerSample& sample) final;
+
+  private:
+    const double m_scale_up_utilization;
+    const double m_scale_down_utilization;
+    const std::size_t m_patience;
+
+    std::size_t m_scale_up_streak{0};
+    std::size_t m_scale_down_streak{0};
+};
+
+}  // namespace mrc::runnable
@@ -19,7 +19,10 @@
 
 #include <glog/logging.h>
 
+#include <atomic>
+#include <chrono>
 #include <cstddef>
+#include <cstdint>
 #include <exception>
 #include <sstream>
 #include <string>
@@ -36,6 +39,9 @@ enum class EngineType;
  * A unique Context is provided by the Launcher for each concurrent instance of Runnable. The Context provides
  * the rank() of the current instances, the number of instances via size() and a barrier() method to collectively
  * synchronize all instances.
+ *
+ * Instances added to a running Runnable by Runner::add_instances are elastic. Their ranks follow those of the launched
+ * instances, size() is the number of launched instances, and they do not take part in lock() or barrier().
  */
 class Context
 {
@@ -56,6 +62,33 @@ class Context
 
     const std::string& info() const;
 
+    bool is_elastic() const;
+
+    /**
+     * @brief True once Runner::retire_instances selected this instance; the Runnable returns from main soon after
+     */
+    bool retire_requested() const;
+
+    /**
+     * @brief How often the progress engine of an elastic Runnable calls scaling_tick() while it waits for input; zero
+     * if this instance is neither elastic nor driving the autoscaler of its Runner
+     */
+    std::chrono::nanoseconds scaling_interval() const;
+
+    /**
+     * @brief Called by the progress engine of an elastic Runnable after each batch of values and at least once per
+     * scaling_interval(); accounts the time spent processing values since the previous call and, on rank 0, runs the
+     * autoscaler of the Runner.
+     * @return false if the instance was retired and should stop reading its input
+     */
+    bool scaling_tick(std::chrono::nanoseconds busy_time, std::size_t queue_depth);
+
+    /**
+     * @brief Stops the Runner from adding instances and waits for the elastic instances to return from main; called by
+     * rank 0 before it shuts down the Runnable
+     */
+    void await_elastic_instances();
+
     template <typename ContextT>
     ContextT& as()
     {
@@ -65,11 +98,12 @@ class Context
     }
 
     static Context& get_runtime_context();
+    static bool has_runtime_context();
 
     void set_exception(std::exception_ptr exception_ptr);
 
   protected:
-    void init(const Runner& runner);
+    void init(Runner& runner);
     bool status() const;
     void finish();
     virtual void init_info(std::stringstream& ss);
@@ -79,7 +113,13 @@ class Context
     std::size_t m_size;
     std::string m_info{"Uninitialized Context"};
     std::exception_ptr m_exception_ptr{nullptr};
-    const Runner* m_runner{nullptr};
+    Runner* m_runner{nullptr};
+
+    // set by the Runner before the instance is launched
+    bool m_elastic{false};
+    std::chrono::nanoseconds m_scaling_interval{0};
+    std::atomic<bool> m_retire_requested{false};
+    std::atomic<std::int64_t> m_busy_time_ns{0};
 
     virtual void do_lock()                          = 0;
     virtual void do_unlock()                        = 0;
@@ -41,11 +41,13 @@
 #include "mrc/runnable/types.hpp"
 
 #include <cstdint>
+#include <cstddef>
 #include <map>
 #include <memory>
 #include <mutex>
 #include <string>
 #include <utility>
+#include <vector>
 
 namespace mrc::runnable {
 
@@ -103,8 +105,9 @@ class LaunchControl final
         // engines are out way of running some task on the specified backend
         std::shared_ptr<Engines> engines = build_engines(options);
 
-        // make contexts
+        // make contexts, and the factory for the contexts of elastic instances
         std::vector<std::shared_ptr<Context>> contexts;
+        Runner::instance_factory_t instance_factory;
         if constexpr (is_fiber_runnable_v<RunnableT>)
         {
             CHECK(get_engine_factory(options.engine_factory_name).backend() == EngineType::Fiber) << "Requested "
@@ -115,6 +118,11 @@ class LaunchControl final
             contexts = make_contexts<FiberContext<ContextWrapperT<context_t>>>(
                 *engines,
                 std::forward<ContextArgsT>(context_args)...);
+
+            instance_factory = make_instance_factory<FiberContext<ContextWrapperT<context_t>>>(
+                options,
+                engines->size(),
+                std::forward<ContextArgsT>(context_args)...);
         }
         else if constexpr (is_thread_context_v<RunnableT>)
         {
@@ -125,6 +133,11 @@ class LaunchControl final
             contexts = make_contexts<ThreadContext<ContextWrapperT<context_t>>>(
                 *engines,
                 std::forward<ContextArgsT>(context_args)...);
+
+            instance_factory = make_instance_factory<ThreadContext<ContextWrapperT<context_t>>>(
+                options,
+                engines->size(),
+                std::forward<ContextArgsT>(context_args)...);
         }
         else
         {
@@ -134,12 +147,22 @@ class LaunchControl final
                 contexts = make_contexts<FiberContext<ContextWrapperT<context_t>>>(
                     *engines,
                     std::forward<ContextArgsT>(context_args)...);
+
+                instance_factory = make_instance_factory<FiberContext<ContextWrapperT<context_t>>>(
+                    options,
+                    engines->size(),
+                    std::forward<ContextArgsT>(context_args)...);
             }
             else if (backend == EngineType::Thread)
             {
                 contexts = make_contexts<ThreadContext<ContextWrapperT<context_t>>>(
                     *engines,
                     std::forward<ContextArgsT>(context_args)...);
+
+                instance_factory = make_instance_factory<ThreadContext<ContextWrapperT<context_t>>>(
+                    options,
+                    engines->size(),
+                    std::forward<ContextArgsT>(context_args)...);
             }
             else
             {
@@ -149,6 +172,7 @@ class LaunchControl final
 
         // create runner
         auto runner = runnable::make_runner(std::move(runnable));
+        runner->set_instance_factory(std::move(instance_factory), options.max_instances, options.autoscale_interval);
 
         // construct the launcher
         return std::make_unique<Launcher>(std::move(runner), std::move(contexts), std::move(engines));
@@ -204,8 +228,9 @@ class LaunchControl final
         // engines are out way of running some task on the specified backend
         std::shared_ptr<Engines> engines = build_engines(options);
 
-        // make contexts
+        // make contexts, and the factory for the contexts of elastic instances
         std::vector<std::shared_ptr<Context>> contexts;
+        Runner::instance_factory_t instance_factory;
         if constexpr (is_fiber_runnable_v<RunnableT>)
         {
             CHECK(get_engine_factory(options.engine_factory_name).backend() == EngineType::Fiber) << "Requested "
@@ -213,6 +238,11 @@ class LaunchControl final
                                                                                                      "be run on a "
                                                                                                      "ThreadEngine";
             contexts = make_contexts<context_t>(*engines, std::forward<ContextArgsT>(context_args)...);
+
+            instance_factory = make_instance_factory<context_t>(
+                options,
+                engines->size(),
+                std::forward<ContextArgsT>(context_args)...);
         }
         else if constexpr (is_thread_context_v<RunnableT>)
         {
@@ -221,6 +251,11 @@ class LaunchControl final
                                                                                                       "to be run on a "
                                                                                                       "FiberEngine";
             contexts = make_contexts<context_t>(*engines, std::forward<ContextArgsT>(context_args)...);
+
+            instance_factory = make_instance_factory<context_t>(
+                options,
+                engines->size(),
+                std::forward<ContextArgsT>(context_args)...);
         }
         else
         {
@@ -229,11 +264,21 @@ class LaunchControl final
             {
                 contexts = make_contexts<FiberContext<context_t>>(*engines,
                                                                   std::forward<ContextArgsT>(context_args)...);
+
+                instance_factory = make_instance_factory<FiberContext<context_t>>(
+                    options,
+                    engines->size(),
+                    std::forward<ContextArgsT>(context_args)...);
             }
             else if (backend == EngineType::Thread)
             {
                 contexts = make_contexts<ThreadContext<context_t>>(*engines,
                                                                    std::forward<ContextArgsT>(context_args)...);
+
+                instance_factory = make_instance_factory<ThreadContext<context_t>>(
+                    options,
+                    engines->size(),
+                    std::forward<ContextArgsT>(context_args)...);
             }
             else
             {
@@ -243,6 +288,7 @@ class LaunchControl final
 
         // create runner
         auto runner = runnable::make_runner(std::move(runnable));
+        runner->set_instance_factory(std::move(instance_factory), options.max_instances, options.autoscale_interval);
 
         // construct the launcher
         return std::make_unique<Launcher>(std::move(runner), std::move(contexts), std::move(engines));
@@ -337,6 +383,35 @@ class LaunchControl final
         return std::move(contexts);
     }
 
+    /**
+     * @brief Generate a factory for the Contexts of the elastic instances which Runner::add_instances launches next to
+     * the instances made by make_contexts; each elastic instance gets an engine on its own processing element.
+     */
+    template <typename WrappedContextT, typename... ArgsT>
+    Runner::instance_factory_t make_instance_factory(const LaunchOptions& options,
+                                                     std::size_t size,
+                                                     ArgsT&&... args) const
+    {
+        auto engine_factory = config().resource_groups.at(options.engine_factory_name);
+        return [engine_factory, options, size, args...](const std::vector<std::size_t>& ranks) {
+            auto elastic_options           = options;
+            elastic_options.pe_count       = ranks.size();
+            elastic_options.engines_per_pe = 1;
+
+            auto engines = engine_factory->build_engines(elastic_options);
+
+            // elastic instances take no part in lock() or barrier(), so they do not share the launched instances'
+            // resources; each one gets resources sized for a single instance
+            std::vector<std::shared_ptr<Context>> contexts;
+            for (const auto rank : ranks)
+            {
+                auto resources = std::make_shared<typename WrappedContextT::resource_t>(1);
+                contexts.push_back(std::make_shared<WrappedContextT>(resources, rank, size, args...));
+            }
+            return std::make_pair(std::move(engines), std::move(contexts));
+        };
+    }
+
     /**
      * @brief Access the config
      *
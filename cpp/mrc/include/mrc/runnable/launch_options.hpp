@@ -18,14 +18,42 @@
 #pragma once
 
 #include "mrc/constants.hpp"
+#include "mrc/core/bitmap.hpp"
 #include "mrc/options/engine_groups.hpp"
 #include "mrc/runnable/types.hpp"
 
+#include <chrono>
+#include <cstddef>
 #include <cstdint>
 #include <string>
+#include <variant>
 
 namespace mrc::runnable {
 
+/// launch on the partition with this id
+struct PartitionPlacement
+{
+    std::size_t partition_id;
+};
+
+/// launch on a partition whose cpus are on this numa node
+struct NumaNodePlacement
+{
+    std::uint32_t numa_id;
+};
+
+/// launch on the partition whose cpus overlap most with cpu_set
+struct CpuSetPlacement
+{
+    CpuSet cpu_set;
+};
+
+/**
+ * @brief Placement hint of a segment object. Without a hint (std::monostate) an object is launched on the partition of
+ * its segment; a hint which no partition can satisfy falls back to that partition with a warning.
+ */
+using placement_hint_t = std::variant<std::monostate, PartitionPlacement, NumaNodePlacement, CpuSetPlacement>;
+
 struct LaunchOptions
 {
     LaunchOptions() = default;
@@ -38,6 +66,14 @@ struct LaunchOptions
     std::size_t pe_count{1};
     std::size_t engines_per_pe{1};
     std::string engine_factory_name{default_engine_factory_name()};
+    placement_hint_t placement{};
+
+    // upper bound on the instances of a node or sink; if it exceeds pe_count * engines_per_pe, an autoscaler adds
+    // elastic instances up to this bound and retires them down to the launched instances. See Runner::add_instances
+    std::size_t max_instances{0};
+
+    // how often the autoscaler samples the node, and how quickly idle elastic instances notice they were retired
+    std::chrono::milliseconds autoscale_interval{1000};
 };
 
 struct ServiceLaunchOptions : public LaunchOptions
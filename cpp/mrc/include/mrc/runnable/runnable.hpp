@@ -87,6 +87,13 @@ class Runnable
      */
     virtual void on_state_update(const State&);
 
+    /**
+     * @brief Whether the Runner may add instances to, and retire instances from, the running Runnable; see
+     * Runner::add_instances. Runnables which opt in must stop reading their input when Context::scaling_tick returns
+     * false, and must not rely on lock() or barrier() in their elastic instances.
+     */
+    virtual bool supports_elastic_instances() const;
+
     std::atomic<State> m_state{State::Init};
 
     friend class Runner;
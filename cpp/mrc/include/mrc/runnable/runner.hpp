@@ -17,6 +17,7 @@
 
 #pragma once
 
+#include "mrc/runnable/autoscaler_policy.hpp"
 #include "mrc/runnable/engine.hpp"
 #include "mrc/runnable/fiber_context.hpp"
 #include "mrc/runnable/forward.hpp"
@@ -29,7 +30,9 @@
 #include <glog/logging.h>
 
 #include <atomic>
+#include <chrono>
 #include <cstddef>
+#include <deque>
 #include <functional>
 #include <memory>
 #include <mutex>
@@ -59,6 +62,10 @@ class Runnable;
  * immediate scope of the callback method.
  *
  * After enqueued, the unique_ptr from make_runner maybe stored in any container that holds unique_ptr<Runnable>.
+ *
+ * Runnables which support it can be scaled while they run: add_instances launches elastic instances on new engines and
+ * retire_instances winds them down again. When a Runner is prepared by LaunchControl with LaunchOptions::max_instances
+ * above the launched instances, an AutoscalerPolicy does so based on the input queue depth and instance utilization.
  */
 class Runner
 {
@@ -127,6 +134,37 @@ class Runner
      */
     void kill() const;
 
+    /**
+     * @brief Launch count elastic instances of the running Runnable, each on its own engine built from the launch
+     * options of the Runnable. The slots and ranks of retired instances which have returned are reused before new
+     * ranks are appended, so the number of instances stays bounded by the most that ran at once.
+     *
+     * Engines of a single use engine factory are not given back when an instance retires; elastic nodes should use a
+     * reusable engine factory. Throws if the Runnable does not support elastic instances or was not prepared by a
+     * LaunchControl, and if the engine factory cannot build the engines.
+     *
+     * @return the number of instances added, which is 0 before launch and once the Runnable is shutting down
+     */
+    std::size_t add_instances(std::size_t count);
+
+    /**
+     * @brief Ask up to count elastic instances, the most recently added first, to return from main after the values
+     * they hold. The instances launched with the Runnable are never retired.
+     *
+     * @return the number of instances asked to retire
+     */
+    std::size_t retire_instances(std::size_t count);
+
+    /**
+     * @brief Number of launched instances which were not asked to retire
+     */
+    std::size_t instance_count() const;
+
+    /**
+     * @brief Replace the default UtilizationAutoscalerPolicy; must be called before the Runnable is launched
+     */
+    void set_autoscaler_policy(std::unique_ptr<AutoscalerPolicy> policy);
+
     /**
      * @brief Access the const version of the Runnable
      */
@@ -165,9 +203,9 @@ class Runner
 
     /**
      * @brief State of running instances
-     * @return const std::vector<Instance>
+     * @return const std::deque<Instance>
      */
-    const std::vector<Instance>& instances() const;
+    const std::deque<Instance>& instances() const;
 
   protected:
     void enqueue(std::shared_ptr<Engines>, std::vector<std::shared_ptr<Context>>&&);
@@ -178,12 +216,38 @@ class Runner
     Runnable& runnable();
 
   private:
+    /**
+     * @brief Builds the engines and contexts of elastic instances, one for each of the given ranks
+     */
+    using instance_factory_t = std::function<std::pair<std::shared_ptr<Engines>, std::vector<std::shared_ptr<Context>>>(
+        const std::vector<std::size_t>& ranks)>;
+
     /**
      * @brief Advance the State of the Runner
      * @param new_state
      */
     void update_state(std::size_t launcher_id, State new_state);
 
+    // called by LaunchControl before launch; max_instances above the launched instances enables the autoscaler
+    void set_instance_factory(instance_factory_t factory,
+                              std::size_t max_instances,
+                              std::chrono::nanoseconds autoscale_interval);
+
+    // runs the Runnable on the engine of the instance
+    void launch(Instance& instance);
+
+    // samples the Runnable and applies the autoscaler policy at most once per interval; only called from rank 0
+    void autoscale(std::size_t queue_depth);
+
+    // stops adding instances and waits for the elastic ones to complete; called from rank 0 before shutdown
+    void await_elastic_instances();
+
+    // drops the engines and contexts of retired instances which have completed and frees their ranks for reuse
+    void release_retired_instances();
+
+    // total time the instances spent processing values, as reported by Context::scaling_tick
+    std::chrono::nanoseconds busy_time() const;
+
     // callback lambda executed on state change
     on_instance_state_change_t m_on_instance_state_change{nullptr};
 
@@ -198,13 +262,36 @@ class Runner
     std::unique_ptr<Runnable> m_runnable;
 
     // 1:1 mapping to contexts, but hold the runner specific states for each instance
-    mutable std::vector<Instance> m_instances;
+    // a deque, since elastic instances are appended while the launched ones hold references to their entries; the
+    // entries of completed retired instances are reset in place when add_instances reuses their ranks
+    mutable std::deque<Instance> m_instances;
 
     // simple bool to disable launching this runner/runnable
     bool m_can_run{true};
 
+    // elastic scaling; see add_instances
+    instance_factory_t m_instance_factory{nullptr};
+    std::size_t m_launched_instances{0};
+    std::size_t m_max_instances{0};
+    bool m_accepting_instances{false};
+    std::vector<std::size_t> m_elastic_ranks;
+    std::vector<std::size_t> m_retired_ranks;
+    std::vector<std::size_t> m_free_ranks;
+    std::chrono::nanoseconds m_retired_busy_time{0};
+
+    // autoscaler state, only touched by rank 0 once launched
+    std::unique_ptr<AutoscalerPolicy> m_autoscaler;
+    std::chrono::nanoseconds m_autoscale_interval{0};
+    std::chrono::steady_clock::time_point m_last_autoscale;
+    std::chrono::nanoseconds m_last_busy_time{0};
+
     mutable std::recursive_mutex m_mutex;
 
+    // serializes add_instances, which builds the engines of new instances without holding m_mutex
+    std::mutex m_scaling_mutex;
+
+    friend class Context;
+    friend class LaunchControl;
     friend class Launcher;
 };
 
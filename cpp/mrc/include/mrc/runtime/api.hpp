@@ -18,6 +18,7 @@
 #pragma once
 
 #include "mrc/codable/api.hpp"
+#include "mrc/memory/buffer_view.hpp"
 #include "mrc/pubsub/forward.hpp"
 
 #include <cstdint>
@@ -92,6 +93,20 @@ class IPartition
      */
     virtual std::unique_ptr<codable::ICodableStorage> make_codable_storage() = 0;
 
+    /**
+     * @brief Provides an IFlatCodableStorage object backed by the required resources from this partition.
+     */
+    virtual std::unique_ptr<codable::IFlatCodableStorage> make_flat_codable_storage() = 0;
+
+    /**
+     * @brief Provides read-only storage over the bytes produced by IFlatCodableStorage::finalize().
+     *
+     * The bytes are validated but not copied, so they must remain valid and unmodified for the lifetime of the returned
+     * object and must be aligned to at least 8 bytes. Throws MrcRuntimeError if the bytes are malformed.
+     */
+    virtual std::unique_ptr<codable::IDecodableStorage> make_flat_decodable_storage(
+        memory::const_buffer_view encoded) = 0;
+
   private:
     /**
      * @brief Provides an IPublisherService backed by resources on this partition.
@@ -23,6 +23,7 @@
 #include "mrc/edge/edge_writable.hpp"
 #include "mrc/engine/segment/ibuilder.hpp"  // IWYU pragma: export
 #include "mrc/exceptions/runtime_error.hpp"
+#include "mrc/metrics/node_metrics.hpp"
 #include "mrc/node/rx_node.hpp"
 #include "mrc/node/rx_sink.hpp"
 #include "mrc/node/rx_source.hpp"
@@ -252,6 +253,7 @@ class Builder final
     {
         DVLOG(10) << "forming segment edge between two segment objects";
         mrc::make_edge(source->object(), sink->object());
+        sink->add_upstream(source);
     }
 
     /**
@@ -273,6 +275,7 @@ class Builder final
             {
                 mrc::make_edge(source->object(),
                                sink->template writable_provider_typed<typename SourceNodeTypeT::source_type_t>());
+                sink->add_upstream(source);
                 return;
             }
         }
@@ -309,6 +312,7 @@ class Builder final
             {
                 mrc::make_edge(source->template writable_acceptor_typed<typename SinkNodeTypeT::sink_type_t>(),
                                sink->object());
+                sink->add_upstream(source);
                 return;
             }
         }
@@ -339,6 +343,11 @@ class Builder final
                            std::shared_ptr<segment::ObjectProperties> sink)
     {
         this->make_dynamic_edge<SourceNodeTypeT, SinkNodeTypeT>(*source, *sink);
+
+        if (source->is_writable_acceptor() && sink->is_writable_provider())
+        {
+            sink->add_upstream(source);
+        }
     }
 
     template <typename SourceNodeTypeT, typename SinkNodeTypeT = SourceNodeTypeT>
@@ -392,6 +401,11 @@ class Builder final
   private:
     using sp_segment_module_t = std::shared_ptr<mrc::modules::SegmentModule>;
 
+    // registers the standard node metrics and attaches their watchers, and those of the event tracer, to the sink and
+    // source of node
+    template <typename ObjectT>
+    void instrument_node(const std::string& name, ObjectT& node);
+
     std::string m_namespace_prefix;
     std::vector<std::string> m_namespace_stack{};
     std::vector<sp_segment_module_t> m_module_stack{};
@@ -418,6 +432,8 @@ std::shared_ptr<Object<ObjectT>> Builder::make_object(std::string name, std::uni
 
     if constexpr (std::is_base_of_v<runnable::Runnable, ObjectT>)
     {
+        instrument_node(name, *node);
+
         auto segment_name = m_backend.name() + "/" + name;
         auto segment_node = std::make_shared<Runnable<ObjectT>>(segment_name, std::move(node));
 
@@ -436,6 +452,32 @@ std::shared_ptr<Object<ObjectT>> Builder::make_object(std::string name, std::uni
     return segment_object;
 }
 
+template <typename ObjectT>
+void Builder::instrument_node(const std::string& name, ObjectT& node)
+{
+    auto node_metrics = m_backend.make_node_metrics(name);
+    auto trace_name   = m_backend.name() + "/" + name;
+
+    if constexpr (is_base_of_template<node::RxSinkBase, ObjectT>::value)
+    {
+        node.sink_set_trace_name(trace_name);
+        if (node_metrics)
+        {
+            node.sink_add_watcher(node_metrics->sink_watcher());
+            node_metrics->set_queue_depth_fn(node.channel_depth_fn());
+        }
+    }
+
+    if constexpr (is_base_of_template<node::RxSourceBase, ObjectT>::value)
+    {
+        node.source_set_trace_name(trace_name);
+        if (node_metrics)
+        {
+            node.source_add_watcher(node_metrics->source_watcher());
+        }
+    }
+}
+
 template <typename T>
 std::shared_ptr<Object<node::RxSinkBase<T>>> Builder::get_egress(std::string name)
 {
@@ -28,9 +28,12 @@
 #include "mrc/runnable/runnable.hpp"
 #include "mrc/segment/forward.hpp"
 
+#include <cstddef>
 #include <memory>
+#include <optional>
 #include <string>
 #include <type_traits>
+#include <vector>
 
 namespace mrc::segment {
 
@@ -73,6 +76,18 @@ struct ObjectProperties
 
     virtual runnable::LaunchOptions& launch_options()             = 0;
     virtual const runnable::LaunchOptions& launch_options() const = 0;
+
+    // Upstream objects connected to this object through the segment Builder; used to specialize edge channels at launch
+    virtual void add_upstream(const std::shared_ptr<ObjectProperties>& upstream) = 0;
+    virtual std::vector<std::shared_ptr<ObjectProperties>> upstreams() const     = 0;
+
+    // Operator fusion: a fusible object can run inline in the runnable of its single upstream instead of being launched
+    virtual bool is_fusible() const   = 0;
+    virtual bool fuse_with_upstream() = 0;
+
+    // Partition the object is launched on; resolved by the segment Builder from the placement of its launch options
+    virtual void set_launch_partition(std::size_t partition_id)  = 0;
+    virtual std::optional<std::size_t> launch_partition() const = 0;
 };
 
 inline ObjectProperties::~ObjectProperties() = default;
@@ -197,6 +212,44 @@ class Object : public virtual ObjectProperties
         return m_launch_options;
     }
 
+    void add_upstream(const std::shared_ptr<ObjectProperties>& upstream) final
+    {
+        m_upstreams.push_back(upstream);
+    }
+
+    std::vector<std::shared_ptr<ObjectProperties>> upstreams() const final
+    {
+        std::vector<std::shared_ptr<ObjectProperties>> upstreams;
+        for (const auto& weak_upstream : m_upstreams)
+        {
+            if (auto upstream = weak_upstream.lock())
+            {
+                upstreams.push_back(std::move(upstream));
+            }
+        }
+        return upstreams;
+    }
+
+    bool is_fusible() const override
+    {
+        return false;
+    }
+
+    bool fuse_with_upstream() override
+    {
+        return false;
+    }
+
+    void set_launch_partition(std::size_t partition_id) final
+    {
+        m_launch_partition = partition_id;
+    }
+
+    std::optional<std::size_t> launch_partition() const final
+    {
+        return m_launch_partition;
+    }
+
   protected:
     void set_name(const std::string& name);
 
@@ -205,6 +258,8 @@ class Object : public virtual ObjectProperties
 
     virtual ObjectT* get_object() const = 0;
     runnable::LaunchOptions m_launch_options;
+    std::vector<std::weak_ptr<ObjectProperties>> m_upstreams;
+    std::optional<std::size_t> m_launch_partition;
 };
 
 template <typename ObjectT>
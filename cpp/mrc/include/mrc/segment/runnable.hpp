@@ -17,6 +17,11 @@
 
 #pragma once
 
+#include "mrc/channel/buffered_channel.hpp"
+#include "mrc/channel/channel.hpp"
+#include "mrc/channel/spsc_channel.hpp"
+#include "mrc/node/forward.hpp"
+#include "mrc/node/sink_channel_owner.hpp"
 #include "mrc/runnable/launch_control.hpp"
 #include "mrc/runnable/launch_options.hpp"
 #include "mrc/runnable/launchable.hpp"
@@ -24,12 +29,14 @@
 #include "mrc/runnable/runnable.hpp"
 #include "mrc/segment/context.hpp"
 #include "mrc/segment/object.hpp"
+#include "mrc/type_traits.hpp"
 
 #include <glog/logging.h>
 
 #include <memory>
 #include <ostream>
 #include <utility>
+#include <variant>
 
 namespace mrc::segment {
 
@@ -52,10 +59,18 @@ class Runnable : public Object<NodeT>, public runnable::Launchable
         this->set_name(std::move(name));
     }
 
+    bool is_fusible() const final;
+    bool fuse_with_upstream() final;
+
   private:
     NodeT* get_object() const final;
     std::unique_ptr<runnable::Launcher> prepare_launcher(runnable::LaunchControl& launch_control) final;
 
+    // swap the default channel for a lock-free SpscChannel when this node is fed by exactly one single-engine
+    // runnable, a deeper channel when it is fed from another partition, and a channel local to its partition whenever
+    // it was placed
+    void select_sink_channel();
+
     std::unique_ptr<NodeT> m_node;
 };
 
@@ -71,6 +86,7 @@ std::unique_ptr<runnable::Launcher> Runnable<NodeT>::prepare_launcher(runnable::
     if constexpr (std::is_base_of_v<runnable::Runnable, NodeT>)
     {
         DVLOG(10) << "Preparing launcher for " << this->type_name() << " in segment";
+        select_sink_channel();
         return launch_control.prepare_launcher_with_wrapped_context<segment::Context>(this->launch_options(),
                                                                                       std::move(m_node),
                                                                                       this->name());
@@ -82,4 +98,83 @@ std::unique_ptr<runnable::Launcher> Runnable<NodeT>::prepare_launcher(runnable::
     }
 }
 
+template <typename NodeT>
+bool Runnable<NodeT>::is_fusible() const
+{
+    return static_cast<bool>(is_base_of_template<node::RxNode, NodeT>::value);
+}
+
+template <typename NodeT>
+bool Runnable<NodeT>::fuse_with_upstream()
+{
+    if constexpr (is_base_of_template<node::RxNode, NodeT>::value)
+    {
+        CHECK(m_node) << "cannot fuse " << this->name() << " after it has been launched";
+
+        if (m_node->run_inline())
+        {
+            DVLOG(10) << this->name() << " is fused into its upstream runnable";
+            return true;
+        }
+    }
+    return false;
+}
+
+template <typename NodeT>
+void Runnable<NodeT>::select_sink_channel()
+{
+    if constexpr (is_base_of_template<node::SinkChannelOwner, NodeT>::value)
+    {
+        using sink_type_t = typename NodeT::sink_type_t;
+
+        // a channel the user installed with set_channel is never swapped
+        if (!m_node->has_default_channel())
+        {
+            return;
+        }
+
+        auto upstreams = this->upstreams();
+
+        // an edge written from another partition gets a deeper buffer; the channel is constructed here, while the
+        // launcher is prepared on the partition of this node, so its buffer is first touched on the reader's numa node
+        const auto partition    = this->launch_partition();
+        bool crosses_partitions = false;
+        for (const auto& upstream : upstreams)
+        {
+            const auto upstream_partition = upstream->launch_partition();
+            crosses_partitions |= partition && upstream_partition && *partition != *upstream_partition;
+        }
+        const auto buffer_size = crosses_partitions ? channel::cross_partition_channel_size()
+                                                    : channel::default_channel_size();
+
+        auto is_single_engine = [](const runnable::LaunchOptions& options) {
+            // an elastic runnable may run more instances than it was launched with
+            return options.pe_count == 1 && options.engines_per_pe == 1 && options.max_instances <= 1;
+        };
+
+        // a lock-free channel requires the channel writer to be shared by exactly one upstream, and that upstream must
+        // be a single-engine runnable
+        if (channel::lock_free_edge_channels() && is_single_engine(this->launch_options()) && upstreams.size() == 1 &&
+            m_node->channel_writer_connection_count() == 1 && upstreams[0]->is_runnable() &&
+            is_single_engine(upstreams[0]->launch_options()))
+        {
+            if (m_node->replace_channel(std::make_unique<channel::SpscChannel<sink_type_t>>(buffer_size)))
+            {
+                DVLOG(10) << this->name() << " is using a lock-free spsc channel for its input edge";
+            }
+            return;
+        }
+
+        // the Builder allocated the default channel on the segment's partition; a placed node gets a new channel even
+        // if its edges stay on its partition, so it never reads from memory local to another numa node
+        const bool placed = !std::holds_alternative<std::monostate>(this->launch_options().placement);
+        if ((crosses_partitions || placed) &&
+            m_node->replace_channel(std::make_unique<channel::BufferedChannel<sink_type_t>>(buffer_size)))
+        {
+            DVLOG(10) << this->name() << " is using a channel of " << buffer_size << " values allocated on partition "
+                      << partition.value_or(0) << " for its input edge";
+        }
+    }
+}
+
 }  // namespace mrc::segment
@@ -0,0 +1,150 @@
+/**
+ * SPDX-FileCopyrightText: Copyright (c) 2022-2023, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <iosfwd>
+#include <string>
+
+/**
+ * Always-on event tracing.
+ *
+ * Events are appended to a fixed-size ring buffer owned by the recording thread, stamped with the CPU timestamp
+ * counter; once a buffer is full the oldest events are overwritten. Apart from creating the buffer of a thread on its
+ * first event, recording never locks or allocates, and while tracing is disabled it costs a single relaxed load, so the
+ * hooks stay compiled into production builds. Tracing starts disabled unless MRC_TRACE_EVENTS is set in the
+ * environment and can be toggled at any time with set_enabled().
+ *
+ * The progress engines of sinks and sources record a complete span for each channel read, each value handed to the
+ * node's operators and each channel write, carrying the start of the span themselves, so the spans of fibers which
+ * interleave on a thread are never mixed up. The fiber schedulers record an instant event per fiber switch.
+ *
+ * The buffers of all threads can be dumped at any time in the Chrome trace event format, which is read by
+ * chrome://tracing and https://ui.perfetto.dev.
+ */
+namespace mrc::tracing {
+
+enum class EventType : std::uint8_t
+{
+    node,
+    channel_read,
+    channel_write,
+    fiber_switch,
+};
+
+enum class Phase : std::uint8_t
+{
+    begin,
+    end,
+    instant,
+    complete,
+};
+
+namespace detail {
+
+extern std::atomic<bool> s_enabled;  // NOLINT(readability-identifier-naming)
+
+void record(EventType type, Phase phase, std::uint32_t name_id, std::uint64_t arg);
+
+// records into the buffer of the calling thread only if register_thread() created one
+void record_registered(EventType type, Phase phase, std::uint32_t name_id, std::uint64_t arg);
+
+// non-zero timestamp counter value
+std::uint64_t timestamp();
+
+void record_span(EventType type, std::uint32_t name_id, std::uint64_t started);
+
+}  // namespace detail
+
+inline bool is_enabled()
+{
+    return detail::s_enabled.load(std::memory_order_relaxed);
+}
+
+void set_enabled(bool enabled);
+
+/**
+ * @brief Number of events each thread's ring buffer holds; only applies to buffers created after the call
+ */
+void set_buffer_capacity(std::size_t events);
+
+/**
+ * @brief Returns a stable id for name, used to label recorded events. Takes a lock; intended to be called once per
+ * traced object rather than per event.
+ */
+std::uint32_t intern(const std::string& name);
+
+/**
+ * @brief Creates the ring buffer of the calling thread ahead of its first event. Fiber task queues register their
+ * threads when they start, so their schedulers never allocate or lock while picking the next fiber.
+ */
+void register_thread();
+
+/**
+ * @brief Appends an event to the calling thread's ring buffer if tracing is enabled
+ */
+inline void record(EventType type, Phase phase, std::uint32_t name_id, std::uint64_t arg = 0)
+{
+    if (is_enabled())
+    {
+        detail::record(type, phase, name_id, arg);
+    }
+}
+
+/**
+ * @brief Records a switch to fiber_id if tracing is enabled and the calling thread is registered; never allocates
+ */
+inline void record_fiber_switch(std::uint64_t fiber_id)
+{
+    if (is_enabled())
+    {
+        detail::record_registered(EventType::fiber_switch, Phase::instant, 0, fiber_id);
+    }
+}
+
+/**
+ * @brief Starts a span of name_id, which end_span records as a single complete event. Returns zero, and end_span then
+ * records nothing, if tracing is disabled or name_id is zero, i.e. the traced object was never named.
+ */
+inline std::uint64_t begin_span(std::uint32_t name_id)
+{
+    return (name_id != 0 && is_enabled()) ? detail::timestamp() : 0;
+}
+
+inline void end_span(EventType type, std::uint32_t name_id, std::uint64_t started)
+{
+    if (started != 0)
+    {
+        detail::record_span(type, name_id, started);
+    }
+}
+
+/**
+ * @brief Writes the events currently held by all ring buffers in the Chrome trace event (JSON) format. Safe to call
+ * while other threads are recording; events overwritten during the dump are skipped. Returns the number of events.
+ */
+std::size_t dump_chrome_trace(std::ostream& os);
+
+/**
+ * @brief Discards all recorded events, along with the buffers of threads which have exited
+ */
+void clear();
+
+}  // namespace mrc::tracing
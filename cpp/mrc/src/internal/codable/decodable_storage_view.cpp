@@ -27,10 +27,13 @@
 #include "internal/ucx/endpoint.hpp"
 #include "internal/ucx/remote_registration_cache.hpp"
 
+#include "mrc/codable/memory.hpp"
+#include "mrc/cuda/common.hpp"
 #include "mrc/memory/buffer_view.hpp"
 #include "mrc/memory/memory_kind.hpp"
 #include "mrc/protos/codable.pb.h"
 
+#include <cuda_runtime.h>
 #include <glog/logging.h>
 #include <ucp/api/ucp_def.h>
 
@@ -80,25 +83,83 @@ void DecodableStorageView::copy_from_buffer(const idx_t& idx, mrc::memory::buffe
 void DecodableStorageView::copy_from_registered_buffer(const idx_t& idx, mrc::memory::buffer_view& dst_view) const
 {
     const auto& remote = proto().descriptors().at(idx).remote_desc();
-    CHECK_LE(dst_view.bytes(), remote.bytes());
+
+    copy_from_remote_region(resources(),
+                            {remote.instance_id(),
+                             remote.address(),
+                             remote.bytes(),
+                             remote.memory_block_address(),
+                             remote.memory_block_size(),
+                             remote.remote_key(),
+                             mrc::codable::decode_memory_type(remote.memory_kind()),
+                             remote.should_cache()},
+                            dst_view);
+}
+
+void DecodableStorageView::copy_from_eager_buffer(const idx_t& idx, mrc::memory::buffer_view& dst_view) const
+{
+    const auto& eager_buffer = proto().descriptors().at(idx).eager_desc();
+    CHECK_LE(dst_view.bytes(), eager_buffer.data().size());
+
+    if (dst_view.kind() == mrc::memory::memory_kind::device)
+    {
+        LOG(FATAL) << "implement async device copies";
+    }
+
+    if (dst_view.kind() == mrc::memory::memory_kind::none)
+    {
+        LOG(WARNING) << "got a memory::kind::none";
+    }
+    std::memcpy(dst_view.data(), eager_buffer.data().data(), dst_view.bytes());
+}
+
+std::shared_ptr<mrc::memory::memory_resource> DecodableStorageView::host_memory_resource() const
+{
+    return resources().host().arena_memory_resource();
+}
+
+std::shared_ptr<mrc::memory::memory_resource> DecodableStorageView::device_memory_resource() const
+{
+    if (resources().device())
+    {
+        return resources().device()->arena_memory_resource();
+    }
+    return nullptr;
+}
+
+void copy_from_remote_region(resources::PartitionResources& resources,
+                             const RemoteRegion& remote,
+                             mrc::memory::buffer_view& dst_view)
+{
+    CHECK_LE(dst_view.bytes(), remote.bytes);
 
     // todo(ryan) - check locality, if we are on the same machine but a different instance, use direct method
-    if (resources().network()->instance_id() == remote.instance_id())
+    if (resources.network()->instance_id() == remote.instance_id)
     {
-        LOG(FATAL) << "implement local copy";
+        // the registered region lives in this process; read it directly into the destination
+        const auto* src_address = reinterpret_cast<const void*>(remote.address);
+        if (remote.memory_kind == mrc::memory::memory_kind::device ||
+            dst_view.kind() == mrc::memory::memory_kind::device)
+        {
+            MRC_CHECK_CUDA(cudaMemcpy(dst_view.data(), src_address, dst_view.bytes(), cudaMemcpyDefault));
+        }
+        else
+        {
+            std::memcpy(dst_view.data(), src_address, dst_view.bytes());
+        }
     }
     else
     {
-        LOG(INFO) << "performing rmda get ";
+        DVLOG(10) << "performing rdma get";
         bool cached_registration{false};
         ucp_rkey_h rkey;
         data_plane::Request request;
-        data_plane::Client& client = resources().network()->data_plane().client();
+        data_plane::Client& client = resources.network()->data_plane().client();
 
         // get endpoint to remote instance_id
-        auto ep = client.endpoint_shared(remote.instance_id());
+        auto ep = client.endpoint_shared(remote.instance_id);
 
-        const void* remote_address = reinterpret_cast<const void*>(remote.address());
+        const void* remote_address = reinterpret_cast<const void*>(remote.address);
 
         // determine if remote memory region is in the remote memory cache on this endpoint
         auto block = ep->registration_cache().lookup(remote_address);
@@ -106,61 +167,30 @@ void DecodableStorageView::copy_from_registered_buffer(const idx_t& idx, mrc::me
         // rkey from cache
         if (block)
         {
-            LOG(INFO) << "remote memory region in cache";
+            DVLOG(10) << "remote memory region in cache";
             rkey = block->remote_key_handle();
         }
         else
         {
             cached_registration = true;
             auto block          = ep->registration_cache().add_block(
-                reinterpret_cast<const void*>(remote.memory_block_address()),
-                remote.memory_block_size(),
-                remote.remote_key());
+                reinterpret_cast<const void*>(remote.memory_block_address),
+                remote.memory_block_size,
+                std::string(remote.remote_key));
             rkey = block.remote_key_handle();
         }
 
         // issue rdma get
-        client.async_get(dst_view.data(), dst_view.bytes(), *ep, remote.address(), rkey, request);
+        client.async_get(dst_view.data(), dst_view.bytes(), *ep, remote.address, rkey, request);
 
         // await and yield on get
         request.await_complete();
 
-        if (cached_registration && !remote.should_cache())
+        if (cached_registration && !remote.should_cache)
         {
-            ep->registration_cache().drop_block(reinterpret_cast<const void*>(remote.memory_block_address()));
+            ep->registration_cache().drop_block(reinterpret_cast<const void*>(remote.memory_block_address));
         }
     }
 }
 
-void DecodableStorageView::copy_from_eager_buffer(const idx_t& idx, mrc::memory::buffer_view& dst_view) const
-{
-    const auto& eager_buffer = proto().descriptors().at(idx).eager_desc();
-    CHECK_LE(dst_view.bytes(), eager_buffer.data().size());
-
-    if (dst_view.kind() == mrc::memory::memory_kind::device)
-    {
-        LOG(FATAL) << "implement async device copies";
-    }
-
-    if (dst_view.kind() == mrc::memory::memory_kind::none)
-    {
-        LOG(WARNING) << "got a memory::kind::none";
-    }
-    std::memcpy(dst_view.data(), eager_buffer.data().data(), dst_view.bytes());
-}
-
-std::shared_ptr<mrc::memory::memory_resource> DecodableStorageView::host_memory_resource() const
-{
-    return resources().host().arena_memory_resource();
-}
-
-std::shared_ptr<mrc::memory::memory_resource> DecodableStorageView::device_memory_resource() const
-{
-    if (resources().device())
-    {
-        return resources().device()->arena_memory_resource();
-    }
-    return nullptr;
-}
-
 }  // namespace mrc::internal::codable
@@ -20,9 +20,13 @@
 #include "internal/codable/storage_resources.hpp"
 
 #include "mrc/codable/api.hpp"
+#include "mrc/memory/memory_kind.hpp"
+#include "mrc/types.hpp"
 
 #include <cstddef>
+#include <cstdint>
 #include <memory>
+#include <string_view>
 
 namespace mrc::memory {
 class buffer_view;
@@ -31,6 +35,29 @@ struct memory_resource;
 
 namespace mrc::internal::codable {
 
+/**
+ * @brief Registered memory region described by a remote descriptor, independent of how the descriptor was serialized
+ */
+struct RemoteRegion
+{
+    InstanceID instance_id;
+    std::uint64_t address;
+    std::uint64_t bytes;
+    std::uint64_t memory_block_address;
+    std::uint64_t memory_block_size;
+    std::string_view remote_key;
+    mrc::memory::memory_kind memory_kind;
+    bool should_cache;
+};
+
+/**
+ * @brief Copy from a registered memory region into dst_view. Regions owned by this instance are copied directly, with
+ * cudaMemcpy when either side is device memory, regions owned by other instances are read with an RDMA get.
+ */
+void copy_from_remote_region(resources::PartitionResources& resources,
+                             const RemoteRegion& remote,
+                             mrc::memory::buffer_view& dst_view);
+
 /**
  * @brief Storage implements the IDecodableStorage interface for an EncodedObject/Storage
  */
@@ -0,0 +1,509 @@
+/**
+ * SPDX-FileCopyrightText: Copyright (c) 2022-2023, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "internal/codable/flat_storage.hpp"
+
+#include "internal/codable/decodable_storage_view.hpp"
+#include "internal/data_plane/resources.hpp"
+#include "internal/memory/device_resources.hpp"
+#include "internal/memory/host_resources.hpp"
+#include "internal/network/resources.hpp"
+#include "internal/resources/partition_resources.hpp"
+#include "internal/ucx/memory_block.hpp"
+#include "internal/ucx/registration_cache.hpp"
+#include "internal/ucx/resources.hpp"
+
+#include "mrc/codable/memory.hpp"
+#include "mrc/cuda/common.hpp"
+#include "mrc/exceptions/runtime_error.hpp"
+#include "mrc/memory/literals.hpp"
+#include "mrc/memory/memory_kind.hpp"
+
+#include <cuda_runtime.h>
+#include <glog/logging.h>
+#include <google/protobuf/any.pb.h>
+
+#include <cstring>
+#include <ostream>
+#include <string>
+#include <string_view>
+#include <utility>
+
+using namespace mrc::memory::literals;
+
+namespace mrc::internal::codable {
+
+namespace {
+
+std::size_t align_up(std::size_t value, std::size_t alignment)
+{
+    return (value + alignment - 1) & ~(alignment - 1);
+}
+
+// true if [offset, offset + bytes) lies within the first total_bytes bytes; immune to overflow
+bool in_bounds(std::uint64_t offset, std::uint64_t bytes, std::uint64_t total_bytes)
+{
+    return offset <= total_bytes && bytes <= total_bytes - offset;
+}
+
+void validate(bool condition, const char* what)
+{
+    if (!condition)
+    {
+        throw mrc::exceptions::MrcRuntimeError(std::string("malformed flat encoded object: ") + what);
+    }
+}
+
+}  // namespace
+
+// FlatStorageView
+
+FlatStorageView::~FlatStorageView() = default;
+
+const mrc::codable::protos::EncodedObject& FlatStorageView::proto() const
+{
+    std::lock_guard lock(m_proto_mutex);
+    const auto layout = get_layout();
+
+    // rebuilt only if more objects have been encoded since the last call
+    if (m_proto && static_cast<std::size_t>(m_proto->objects_size()) == layout.object_count &&
+        static_cast<std::size_t>(m_proto->descriptors_size()) == layout.descriptor_count)
+    {
+        return *m_proto;
+    }
+
+    m_proto = std::make_unique<mrc::codable::protos::EncodedObject>();
+
+    for (std::size_t i = 0; i < layout.object_count; ++i)
+    {
+        const auto& src = layout.objects[i];
+        auto* obj       = m_proto->add_objects();
+        obj->set_type_index_hash(src.type_index_hash);
+        obj->set_starting_descriptor_idx(src.starting_descriptor_idx);
+        obj->set_parent_object_idx(src.parent_object_idx);
+    }
+
+    for (std::size_t i = 0; i < layout.descriptor_count; ++i)
+    {
+        const auto& src  = layout.descriptors[i];
+        const auto* data = reinterpret_cast<const char*>(layout.base + src.offset);
+        const auto kind  = static_cast<mrc::memory::memory_kind>(src.memory_kind);
+        auto* desc       = m_proto->add_descriptors();
+
+        switch (src.kind)
+        {
+        case FlatDescriptorKind::eager:
+            desc->mutable_eager_desc()->set_data(data, src.bytes);
+            desc->mutable_eager_desc()->set_memory_kind(mrc::codable::encode_memory_type(kind));
+            break;
+        case FlatDescriptorKind::remote: {
+            auto* remote = desc->mutable_remote_desc();
+            remote->set_instance_id(src.instance_id);
+            remote->set_address(src.address);
+            remote->set_bytes(src.remote_bytes);
+            remote->set_memory_block_address(src.memory_block_address);
+            remote->set_memory_block_size(src.memory_block_size);
+            remote->set_memory_kind(mrc::codable::encode_memory_type(kind));
+            remote->set_remote_key(data, src.bytes);
+            remote->set_should_cache(src.should_cache != 0U);
+            break;
+        }
+        case FlatDescriptorKind::meta_data:
+            CHECK(desc->mutable_meta_data_desc()->mutable_meta_data()->ParseFromArray(data, src.bytes));
+            break;
+        }
+    }
+
+    return *m_proto;
+}
+
+FlatStorageView::obj_idx_t FlatStorageView::object_count() const
+{
+    return get_layout().object_count;
+}
+
+FlatStorageView::idx_t FlatStorageView::descriptor_count() const
+{
+    return get_layout().descriptor_count;
+}
+
+std::size_t FlatStorageView::type_index_hash_for_object(const obj_idx_t& object_idx) const
+{
+    const auto layout = get_layout();
+    CHECK_LT(object_idx, layout.object_count);
+    return layout.objects[object_idx].type_index_hash;
+}
+
+FlatStorageView::idx_t FlatStorageView::start_idx_for_object(const obj_idx_t& object_idx) const
+{
+    const auto layout = get_layout();
+    CHECK_LT(object_idx, layout.object_count);
+    return layout.objects[object_idx].starting_descriptor_idx;
+}
+
+std::optional<FlatStorageView::obj_idx_t> FlatStorageView::parent_obj_idx_for_object(const obj_idx_t& object_idx) const
+{
+    const auto layout = get_layout();
+    CHECK_LT(object_idx, layout.object_count);
+    auto parent_object_idx = layout.objects[object_idx].parent_object_idx;
+    if (parent_object_idx < 0)
+    {
+        return std::nullopt;
+    }
+    return parent_object_idx;
+}
+
+const FlatDescriptor& FlatStorageView::descriptor(const idx_t& idx) const
+{
+    const auto layout = get_layout();
+    CHECK_LT(idx, layout.descriptor_count);
+    return layout.descriptors[idx];
+}
+
+std::size_t FlatStorageView::buffer_size(const idx_t& idx) const
+{
+    const auto& desc = descriptor(idx);
+    return desc.kind == FlatDescriptorKind::remote ? desc.remote_bytes : desc.bytes;
+}
+
+void FlatStorageView::copy_from_buffer(const idx_t& idx, mrc::memory::buffer_view dst_view) const
+{
+    const auto layout = get_layout();
+    CHECK_LT(idx, layout.descriptor_count);
+    const auto& desc = layout.descriptors[idx];
+
+    if (desc.kind == FlatDescriptorKind::remote)
+    {
+        std::string_view remote_key(reinterpret_cast<const char*>(layout.base + desc.offset), desc.bytes);
+        copy_from_remote_region(resources(),
+                                {desc.instance_id,
+                                 desc.address,
+                                 desc.remote_bytes,
+                                 desc.memory_block_address,
+                                 desc.memory_block_size,
+                                 remote_key,
+                                 static_cast<mrc::memory::memory_kind>(desc.memory_kind),
+                                 desc.should_cache != 0U},
+                                dst_view);
+        return;
+    }
+
+    CHECK(desc.kind == FlatDescriptorKind::eager) << "descriptor " << idx << " not backed by a buffered resource";
+    CHECK_LE(dst_view.bytes(), desc.bytes);
+
+    if (dst_view.kind() == mrc::memory::memory_kind::device)
+    {
+        LOG(FATAL) << "implement async device copies";
+    }
+    std::memcpy(dst_view.data(), layout.base + desc.offset, dst_view.bytes());
+}
+
+std::shared_ptr<mrc::memory::memory_resource> FlatStorageView::host_memory_resource() const
+{
+    return resources().host().arena_memory_resource();
+}
+
+std::shared_ptr<mrc::memory::memory_resource> FlatStorageView::device_memory_resource() const
+{
+    if (resources().device())
+    {
+        return resources().device()->arena_memory_resource();
+    }
+    return nullptr;
+}
+
+// FlatCodableStorage
+
+FlatCodableStorage::FlatCodableStorage(resources::PartitionResources& resources) :
+  m_resources(resources),
+  m_bytes(sizeof(FlatHeader)),
+  m_data_end(sizeof(FlatHeader))
+{}
+
+FlatCodableStorage::~FlatCodableStorage() = default;
+
+mrc::memory::const_buffer_view FlatCodableStorage::finalize()
+{
+    std::lock_guard lock(m_mutex);
+
+    // drop the tables written by a previous call
+    m_bytes.resize(m_data_end);
+
+    const auto objects_offset     = align_up(m_data_end, alignof(FlatObject));
+    const auto objects_bytes      = m_objects.size() * sizeof(FlatObject);
+    const auto descriptors_offset = align_up(objects_offset + objects_bytes, alignof(FlatDescriptor));
+    const auto descriptors_bytes  = m_descriptors.size() * sizeof(FlatDescriptor);
+    const auto total_bytes        = descriptors_offset + descriptors_bytes;
+
+    m_bytes.resize(total_bytes);
+    if (objects_bytes > 0)
+    {
+        std::memcpy(m_bytes.data() + objects_offset, m_objects.data(), objects_bytes);
+    }
+    if (descriptors_bytes > 0)
+    {
+        std::memcpy(m_bytes.data() + descriptors_offset, m_descriptors.data(), descriptors_bytes);
+    }
+
+    FlatHeader header{};
+    header.magic              = FlatMagic;
+    header.version            = FlatVersion;
+    header.object_count       = m_objects.size();
+    header.descriptor_count   = m_descriptors.size();
+    header.objects_offset     = objects_offset;
+    header.descriptors_offset = descriptors_offset;
+    header.total_bytes        = total_bytes;
+    std::memcpy(m_bytes.data(), &header, sizeof(header));
+
+    return {m_bytes.data(), m_bytes.size(), mrc::memory::memory_kind::host};
+}
+
+FlatStorageView::Layout FlatCodableStorage::get_layout() const
+{
+    return {m_bytes.data(), m_objects.data(), m_objects.size(), m_descriptors.data(), m_descriptors.size()};
+}
+
+resources::PartitionResources& FlatCodableStorage::resources() const
+{
+    return m_resources;
+}
+
+std::uint64_t FlatCodableStorage::append_data(const void* data, std::size_t bytes, std::size_t alignment)
+{
+    const auto offset = align_up(m_data_end, alignment);
+    m_bytes.resize(offset + bytes);
+    if (bytes > 0)
+    {
+        std::memcpy(m_bytes.data() + offset, data, bytes);
+    }
+    m_data_end = offset + bytes;
+    return offset;
+}
+
+std::optional<FlatCodableStorage::idx_t> FlatCodableStorage::register_memory_view(mrc::memory::const_buffer_view view,
+                                                                                  bool force_register)
+{
+    CHECK(m_resources.network());
+    bool should_cache = true;
+    auto ucx_block    = m_resources.network()->data_plane().registration_cache().lookup(view.data());
+
+    if (!ucx_block && !force_register && view.bytes() < 64_KiB)
+    {
+        return std::nullopt;
+    }
+
+    if (!ucx_block)
+    {
+        // register memory
+        should_cache = false;
+        m_resources.network()->ucx().registration_cache().add_block(view.data(), view.bytes());
+        ucx_block = m_resources.network()->data_plane().registration_cache().lookup(view.data());
+        m_temporary_registrations.push_back(view);
+    }
+
+    const auto& keys = ucx_block->packed_remote_keys();
+
+    FlatDescriptor desc{};
+    desc.kind                 = FlatDescriptorKind::remote;
+    desc.memory_kind          = static_cast<std::uint8_t>(view.kind());
+    desc.should_cache         = should_cache ? 1 : 0;
+    desc.instance_id          = m_resources.network()->instance_id();
+    desc.address              = reinterpret_cast<std::uint64_t>(view.data());
+    desc.remote_bytes         = view.bytes();
+    desc.memory_block_address = reinterpret_cast<std::uint64_t>(ucx_block->data());
+    desc.memory_block_size    = ucx_block->bytes();
+    desc.bytes                = keys.size();
+    desc.offset               = append_data(keys.data(), keys.size(), 1);
+
+    auto count = descriptor_count();
+    m_descriptors.push_back(desc);
+    return count;
+}
+
+FlatCodableStorage::idx_t FlatCodableStorage::copy_to_eager_descriptor(mrc::memory::const_buffer_view view)
+{
+    CHECK(context_acquired());
+    CHECK(view.kind() != mrc::memory::memory_kind::device) << "eager descriptors must be host accessible";
+
+    FlatDescriptor desc{};
+    desc.kind        = FlatDescriptorKind::eager;
+    desc.memory_kind = static_cast<std::uint8_t>(mrc::memory::memory_kind::host);
+    desc.bytes       = view.bytes();
+    desc.offset      = append_data(view.data(), view.bytes(), FlatEagerAlignment);
+
+    auto count = descriptor_count();
+    m_descriptors.push_back(desc);
+    return count;
+}
+
+FlatCodableStorage::idx_t FlatCodableStorage::add_meta_data(const google::protobuf::Message& meta_data)
+{
+    CHECK(context_acquired());
+    google::protobuf::Any any;
+    CHECK(any.PackFrom(meta_data));
+    auto packed = any.SerializeAsString();
+
+    FlatDescriptor desc{};
+    desc.kind        = FlatDescriptorKind::meta_data;
+    desc.memory_kind = static_cast<std::uint8_t>(mrc::memory::memory_kind::host);
+    desc.bytes       = packed.size();
+    desc.offset      = append_data(packed.data(), packed.size(), 1);
+
+    auto count = descriptor_count();
+    m_descriptors.push_back(desc);
+    return count;
+}
+
+FlatCodableStorage::idx_t FlatCodableStorage::create_memory_buffer(std::size_t bytes)
+{
+    CHECK(context_acquired());
+    auto buffer = m_resources.host().make_buffer(bytes);
+    auto idx    = register_memory_view(buffer);
+    CHECK(idx);
+    m_buffers[*idx] = std::move(buffer);
+    return *idx;
+}
+
+void FlatCodableStorage::copy_to_buffer(idx_t buffer_idx, mrc::memory::const_buffer_view view)
+{
+    auto search = m_buffers.find(buffer_idx);
+    CHECK(search != m_buffers.end()) << "buffer_idx=" << buffer_idx << " was not created with create_buffer";
+
+    auto& dst = search->second;
+    CHECK_LE(view.bytes(), dst.bytes());
+
+    MRC_CHECK_CUDA(cudaMemcpy(dst.data(), view.data(), view.bytes(), cudaMemcpyDefault));
+}
+
+mrc::memory::buffer_view FlatCodableStorage::mutable_host_buffer_view(const idx_t& buffer_idx)
+{
+    const auto& desc = descriptor(buffer_idx);
+    const auto kind  = static_cast<mrc::memory::memory_kind>(desc.memory_kind);
+
+    if (desc.kind == FlatDescriptorKind::eager)
+    {
+        return {m_bytes.data() + desc.offset, desc.bytes, kind};
+    }
+
+    CHECK(desc.kind == FlatDescriptorKind::remote);
+    CHECK(kind == mrc::memory::memory_kind::host || kind == mrc::memory::memory_kind::pinned);
+    return {reinterpret_cast<void*>(desc.address), desc.remote_bytes, kind};
+}
+
+mrc::codable::protos::EncodedObject& FlatCodableStorage::mutable_proto()
+{
+    throw mrc::exceptions::MrcRuntimeError("FlatCodableStorage is not backed by a protos::EncodedObject");
+}
+
+FlatCodableStorage::obj_idx_t FlatCodableStorage::push_context(std::type_index type_index)
+{
+    std::lock_guard lock(m_mutex);
+    m_context_acquired = true;
+
+    auto initial_parent_object_idx = m_parent.value_or(-1);
+
+    FlatObject obj{};
+    obj.type_index_hash         = type_index.hash_code();
+    obj.starting_descriptor_idx = m_descriptors.size();
+    obj.parent_object_idx       = initial_parent_object_idx;
+    m_objects.push_back(obj);
+
+    m_parent = m_objects.size();
+
+    return initial_parent_object_idx;
+}
+
+void FlatCodableStorage::pop_context(obj_idx_t object_idx)
+{
+    std::lock_guard lock(m_mutex);
+    m_parent = object_idx;
+    if (object_idx == -1)
+    {
+        m_context_acquired = false;
+    }
+}
+
+bool FlatCodableStorage::context_acquired() const
+{
+    std::lock_guard lock(m_mutex);
+    return m_context_acquired;
+}
+
+// FlatDecodableStorage
+
+FlatDecodableStorage::FlatDecodableStorage(mrc::memory::const_buffer_view encoded,
+                                           resources::PartitionResources& resources) :
+  m_encoded(std::move(encoded)),
+  m_resources(resources)
+{
+    // the bytes may come off the wire, so every offset is checked before anything is read through it
+    const auto* base = static_cast<const std::byte*>(m_encoded.data());
+    validate(base != nullptr, "no data");
+    validate(reinterpret_cast<std::uintptr_t>(base) % alignof(FlatDescriptor) == 0, "misaligned");
+    validate(m_encoded.bytes() >= sizeof(FlatHeader), "truncated header");
+
+    const auto& header = *reinterpret_cast<const FlatHeader*>(base);
+    validate(header.magic == FlatMagic, "bad magic");
+    validate(header.version == FlatVersion, "unsupported version");
+    validate(header.total_bytes <= m_encoded.bytes(), "truncated");
+    validate(header.objects_offset % alignof(FlatObject) == 0 &&
+                 header.descriptors_offset % alignof(FlatDescriptor) == 0,
+             "misaligned tables");
+    validate(in_bounds(header.objects_offset, header.object_count * sizeof(FlatObject), header.total_bytes),
+             "object table out of bounds");
+    validate(in_bounds(header.descriptors_offset, header.descriptor_count * sizeof(FlatDescriptor), header.total_bytes),
+             "descriptor table out of bounds");
+
+    m_layout = {base,
+                reinterpret_cast<const FlatObject*>(base + header.objects_offset),
+                header.object_count,
+                reinterpret_cast<const FlatDescriptor*>(base + header.descriptors_offset),
+                header.descriptor_count};
+
+    for (std::size_t i = 0; i < m_layout.object_count; ++i)
+    {
+        const auto& obj = m_layout.objects[i];
+        validate(obj.starting_descriptor_idx >= 0 &&
+                     static_cast<std::size_t>(obj.starting_descriptor_idx) <= m_layout.descriptor_count,
+                 "object descriptor index out of range");
+        validate(obj.parent_object_idx < static_cast<std::int64_t>(m_layout.object_count),
+                 "parent object index out of range");
+    }
+
+    for (std::size_t i = 0; i < m_layout.descriptor_count; ++i)
+    {
+        const auto& desc = m_layout.descriptors[i];
+        validate(desc.kind == FlatDescriptorKind::eager || desc.kind == FlatDescriptorKind::remote ||
+                     desc.kind == FlatDescriptorKind::meta_data,
+                 "unknown descriptor kind");
+        validate(in_bounds(desc.offset, desc.bytes, header.total_bytes), "descriptor data out of bounds");
+    }
+}
+
+FlatDecodableStorage::~FlatDecodableStorage() = default;
+
+FlatStorageView::Layout FlatDecodableStorage::get_layout() const
+{
+    return m_layout;
+}
+
+resources::PartitionResources& FlatDecodableStorage::resources() const
+{
+    return m_resources;
+}
+
+}  // namespace mrc::internal::codable
@@ -0,0 +1,241 @@
+/**
+ * SPDX-FileCopyrightText: Copyright (c) 2022-2023, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include "internal/codable/storage_resources.hpp"
+
+#include "mrc/codable/api.hpp"
+#include "mrc/memory/buffer.hpp"
+#include "mrc/memory/buffer_view.hpp"
+#include "mrc/protos/codable.pb.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <typeindex>
+#include <vector>
+
+namespace google::protobuf {
+class Message;
+}  // namespace google::protobuf
+namespace mrc::internal::resources {
+class PartitionResources;  // IWYU pragma: keep
+}  // namespace mrc::internal::resources
+
+namespace mrc::internal::codable {
+
+/**
+ * Fixed layout of a flat encoded object. All offsets are relative to the start of the header and all integers are in
+ * host byte order, i.e. the format is only exchanged between instances of the same architecture.
+ *
+ *   [FlatHeader][eager data ...][FlatObject x object_count][FlatDescriptor x descriptor_count]
+ *
+ * Eager payloads are aligned to FlatEagerAlignment so they can be read in place.
+ */
+inline constexpr std::uint32_t FlatMagic          = 0x4643524d;  // "MRCF"
+inline constexpr std::uint32_t FlatVersion        = 1;
+inline constexpr std::size_t FlatEagerAlignment = 16;
+
+struct FlatHeader
+{
+    std::uint32_t magic;
+    std::uint32_t version;
+    std::uint32_t object_count;
+    std::uint32_t descriptor_count;
+    std::uint64_t objects_offset;
+    std::uint64_t descriptors_offset;
+    std::uint64_t total_bytes;
+    std::uint64_t reserved;
+};
+
+struct FlatObject
+{
+    std::uint64_t type_index_hash;
+    std::int32_t starting_descriptor_idx;
+    std::int32_t parent_object_idx;
+};
+
+enum class FlatDescriptorKind : std::uint8_t
+{
+    eager,
+    remote,
+    meta_data,
+};
+
+struct FlatDescriptor
+{
+    // eager and meta_data: the payload; remote: the packed remote keys
+    std::uint64_t offset;
+    std::uint64_t bytes;
+
+    // remote only
+    std::uint64_t instance_id;
+    std::uint64_t address;
+    std::uint64_t remote_bytes;
+    std::uint64_t memory_block_address;
+    std::uint64_t memory_block_size;
+
+    FlatDescriptorKind kind;
+    std::uint8_t memory_kind;
+    std::uint8_t should_cache;
+    std::uint8_t padding[5];
+};
+
+static_assert(sizeof(FlatHeader) % FlatEagerAlignment == 0);
+static_assert(sizeof(FlatObject) == 16);
+static_assert(sizeof(FlatDescriptor) == 64);
+
+/**
+ * @brief FlatStorageView implements IStorage and IDecodableStorage by reading the fixed layout in place.
+ *
+ * Unlike StorageView there is no protobuf to parse; the object and descriptor tables are indexed directly. proto() is
+ * still available for callers which require a protos::EncodedObject, but it is built on demand.
+ */
+class FlatStorageView : public virtual mrc::codable::IDecodableStorage, public IStorageResources
+{
+  public:
+    ~FlatStorageView() override;
+
+    const mrc::codable::protos::EncodedObject& proto() const final;
+
+    obj_idx_t object_count() const final;
+
+    idx_t descriptor_count() const final;
+
+    std::size_t type_index_hash_for_object(const obj_idx_t& object_idx) const final;
+
+    idx_t start_idx_for_object(const obj_idx_t& object_idx) const final;
+
+    std::optional<obj_idx_t> parent_obj_idx_for_object(const obj_idx_t& object_idx) const final;
+
+  protected:
+    struct Layout
+    {
+        const std::byte* base;
+        const FlatObject* objects;
+        std::size_t object_count;
+        const FlatDescriptor* descriptors;
+        std::size_t descriptor_count;
+    };
+
+    void copy_from_buffer(const idx_t& idx, mrc::memory::buffer_view dst_view) const final;
+
+    std::size_t buffer_size(const idx_t& idx) const final;
+
+    std::shared_ptr<mrc::memory::memory_resource> host_memory_resource() const final;
+
+    std::shared_ptr<mrc::memory::memory_resource> device_memory_resource() const final;
+
+    const FlatDescriptor& descriptor(const idx_t& idx) const;
+
+  private:
+    // pointers into the backing storage; only valid until the storage is next modified
+    virtual Layout get_layout() const = 0;
+
+    mutable std::mutex m_proto_mutex;
+    mutable std::unique_ptr<mrc::codable::protos::EncodedObject> m_proto;
+};
+
+/**
+ * @brief FlatCodableStorage implements both the IEncodableStorage and the IDecodableStorage interfaces on top of a
+ * single contiguous buffer in the flat layout.
+ *
+ * It is a drop-in alternative to CodableStorage for high-rate, small payloads: encoding appends to one buffer instead
+ * of building protobuf messages, and the bytes returned by finalize() can be decoded with FlatDecodableStorage without
+ * a parse step.
+ */
+class FlatCodableStorage final : public mrc::codable::IFlatCodableStorage, public FlatStorageView
+{
+  public:
+    FlatCodableStorage(resources::PartitionResources& resources);
+    ~FlatCodableStorage() override;
+
+    /**
+     * @brief Write the object and descriptor tables and the header; returns a view of the complete encoding. The view
+     * is invalidated if more objects are encoded.
+     */
+    mrc::memory::const_buffer_view finalize() final;
+
+  private:
+    mrc::codable::protos::EncodedObject& mutable_proto() final;
+
+    bool context_acquired() const final;
+
+    obj_idx_t push_context(std::type_index type_index) final;
+
+    void pop_context(obj_idx_t object_idx) final;
+
+    std::optional<idx_t> register_memory_view(mrc::memory::const_buffer_view view, bool force_register = false) final;
+
+    idx_t copy_to_eager_descriptor(mrc::memory::const_buffer_view view) final;
+
+    idx_t add_meta_data(const google::protobuf::Message& meta_data) final;
+
+    idx_t create_memory_buffer(std::size_t bytes) final;
+
+    void copy_to_buffer(idx_t buffer_idx, mrc::memory::const_buffer_view view) final;
+
+    mrc::memory::buffer_view mutable_host_buffer_view(const idx_t& buffer_idx) final;
+
+    Layout get_layout() const final;
+
+    resources::PartitionResources& resources() const final;
+
+    // appends bytes to the data section at the given alignment and returns their offset
+    std::uint64_t append_data(const void* data, std::size_t bytes, std::size_t alignment);
+
+    resources::PartitionResources& m_resources;
+    std::vector<std::byte> m_bytes;
+    std::size_t m_data_end;
+    std::vector<FlatObject> m_objects;
+    std::vector<FlatDescriptor> m_descriptors;
+    std::map<idx_t, mrc::memory::buffer> m_buffers;
+    std::vector<mrc::memory::const_buffer_view> m_temporary_registrations;
+    std::optional<obj_idx_t> m_parent{std::nullopt};
+    bool m_context_acquired{false};
+    mutable std::mutex m_mutex;
+};
+
+/**
+ * @brief Read-only storage over the bytes produced by FlatCodableStorage::finalize(); publicly constructed through
+ * IPartition::make_flat_decodable_storage.
+ *
+ * The header and the bounds of every table entry are validated on construction, throwing MrcRuntimeError if the bytes
+ * are malformed; nothing is copied or parsed. The bytes must remain valid and unmodified for the lifetime of this
+ * object and must be aligned to at least 8 bytes.
+ */
+class FlatDecodableStorage final : public FlatStorageView
+{
+  public:
+    FlatDecodableStorage(mrc::memory::const_buffer_view encoded, resources::PartitionResources& resources);
+    ~FlatDecodableStorage() override;
+
+  private:
+    Layout get_layout() const final;
+
+    resources::PartitionResources& resources() const final;
+
+    mrc::memory::const_buffer_view m_encoded;
+    Layout m_layout;
+    resources::PartitionResources& m_resources;
+};
+
+}  // namespace mrc::internal::codable
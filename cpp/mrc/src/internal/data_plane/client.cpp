@@ -33,7 +33,6 @@
 #include "mrc/channel/buffered_channel.hpp"
 #include "mrc/channel/channel.hpp"
 #include "mrc/edge/edge_builder.hpp"
-#include "mrc/memory/literals.hpp"
 #include "mrc/node/rx_sink.hpp"
 #include "mrc/protos/codable.pb.h"
 #include "mrc/runnable/launch_control.hpp"
@@ -57,8 +56,6 @@
 
 namespace mrc::internal::data_plane {
 
-using namespace mrc::memory::literals;
-
 Client::Client(resources::PartitionResourceBase& base,
                ucx::Resources& ucx,
                control_plane::client::ConnectionsManager& connections_manager,
@@ -128,6 +125,9 @@ void Client::async_recv(void* addr,
     request.m_request = ucp_tag_recv_nbx(worker.handle(), addr, bytes, tag, mask, &params);
     CHECK(request.m_request);
     CHECK(!UCS_PTR_IS_ERR(request.m_request));
+
+    // the request completes when the data plane progress engine progresses the worker
+    worker.wake();
 }
 
 void Client::async_p2p_recv(void* addr, std::size_t bytes, std::uint64_t tag, Request& request)
@@ -159,6 +159,8 @@ void Client::async_send(void* addr,
     request.m_request = ucp_tag_send_nbx(endpoint.handle(), addr, bytes, tag, &send_params);
     CHECK(request.m_request);
     CHECK(!UCS_PTR_IS_ERR(request.m_request));
+
+    endpoint.worker().wake();
 }
 
 void Client::async_p2p_send(void* addr,
@@ -192,6 +194,8 @@ void Client::async_get(void* addr,
     request.m_request = ucp_get_nbx(ep.handle(), addr, bytes, remote_addr, rkey, &params);
     CHECK(request.m_request);
     CHECK(!UCS_PTR_IS_ERR(request.m_request));
+
+    ep.worker().wake();
 }
 
 void Client::async_get(void* addr,
@@ -243,6 +247,8 @@ void Client::async_am_send(std::uint32_t id,
     request.m_request = ucp_am_send_nbx(endpoint.handle(), id, header, header_length, nullptr, 0, &params);
     CHECK(request.m_request);
     CHECK(!UCS_PTR_IS_ERR(request.m_request));
+
+    endpoint.worker().wake();
 }
 
 void Client::issue_remote_descriptor(RemoteDescriptorMessage&& msg)
@@ -260,25 +266,18 @@ void Client::issue_remote_descriptor(RemoteDescriptorMessage&& msg)
 
     auto msg_length = proto.ByteSizeLong();
 
-    // todo(ryan) - parameterize mrc::data_plane::client::max_remote_descriptor_eager_size
-    if (msg_length <= 1_MiB)
-    {
-        auto buffer = m_transient_pool.await_buffer(msg_length);
-        CHECK(proto.SerializeToArray(buffer.data(), buffer.bytes()));
+    auto buffer = m_transient_pool.await_buffer(msg_length);
+    CHECK(proto.SerializeToArray(buffer.data(), buffer.bytes()));
 
-        // the message fits into the size of the preposted recvs issued by the data plane
-        msg.tag |= TAG_EGR_MSG;
+    // messages which fit into the size of the preposted recvs issued by the data plane are sent eagerly, larger
+    // messages are probed for by the server and received into a buffer of their exact size
+    msg.tag |= (msg_length <= TAG_EGR_MAX_BYTES ? TAG_EGR_MSG : TAG_RND_MSG);
 
-        Request request;
-        async_send(buffer.data(), buffer.bytes(), msg.tag, *msg.endpoint, request);
+    Request request;
+    async_send(buffer.data(), buffer.bytes(), msg.tag, *msg.endpoint, request);
 
-        // await and yield the userspace thread until completed
-        CHECK(request.await_complete());
-    }
-    else
-    {
-        LOG(FATAL) << "implement the rendez-vous path (nb_probe) on the server side";
-    }
+    // await and yield the userspace thread until completed
+    CHECK(request.await_complete());
 }
 
 node::WritableProvider<RemoteDescriptorMessage>& Client::remote_descriptor_channel()
@@ -19,16 +19,19 @@
 
 #include "internal/data_plane/tags.hpp"
 #include "internal/runnable/resources.hpp"
+#include "internal/system/system.hpp"
+#include "internal/ucx/adaptive_progress.hpp"
 #include "internal/ucx/common.hpp"
 #include "internal/ucx/resources.hpp"
 #include "internal/ucx/worker.hpp"
 
 #include "mrc/core/task_queue.hpp"
 #include "mrc/edge/edge_builder.hpp"
-#include "mrc/memory/literals.hpp"
 #include "mrc/node/generic_source.hpp"
 #include "mrc/node/operators/router.hpp"
 #include "mrc/node/writable_entrypoint.hpp"
+#include "mrc/options/options.hpp"
+#include "mrc/options/progress_engine.hpp"
 #include "mrc/runnable/context.hpp"
 #include "mrc/runnable/launch_control.hpp"
 #include "mrc/runnable/launch_options.hpp"
@@ -44,10 +47,12 @@
 #include <ucp/api/ucp_def.h>
 #include <ucs/type/status.h>
 
+#include <algorithm>
+#include <chrono>
 #include <cstddef>
 #include <cstdint>
-#include <cstdlib>
 #include <map>
+#include <memory>
 #include <ostream>
 #include <utility>
 
@@ -55,19 +60,55 @@ namespace mrc::internal::data_plane {
 
 namespace {
 
-void zero_bytes_completion_handler(void* request,
-                                   ucs_status_t status,
-                                   const ucp_tag_recv_info_t* msg_info,
-                                   void* user_data)
+// slots per slab of the recv slab pool
+constexpr std::size_t RecvSlotsPerSlab = 16;
+
+void pre_post_recv(detail::PrePostedRecvInfo* info);
+
+memory::TransientBuffer acquire_recv_buffer(detail::PrePostedRecvs& recvs)
 {
-    if (status != UCS_OK)
+    auto buffer = recvs.slab->try_acquire();
+    if (buffer.data() == nullptr)
     {
-        LOG(FATAL) << "zero_bytes_completion_handler observed " << ucs_status_string(status);
+        // every slot is held downstream; the transient pool never blocks the network thread
+        buffer = recvs.pool->await_buffer(recvs.slab->slot_size());
     }
-    ucp_request_free(request);
+    return buffer;
+}
+
+void post_recvs(detail::PrePostedRecvs& recvs, std::size_t count)
+{
+    for (std::size_t i = 0; i < count; i++)
+    {
+        auto& info   = recvs.infos.emplace_back();
+        info.worker  = recvs.worker;
+        info.channel = recvs.channel;
+        info.recvs   = &recvs;
+        info.buffer  = acquire_recv_buffer(recvs);
+        pre_post_recv(&info);
+    }
+    recvs.posted_count.store(recvs.infos.size(), std::memory_order_relaxed);
 }
 
-static void pre_post_recv(detail::PrePostedRecvInfo* info);
+void on_pre_posted_recv_completion(detail::PrePostedRecvs& recvs)
+{
+    auto now = std::chrono::steady_clock::now();
+    if (now - recvs.window_start > recvs.growth_window)
+    {
+        recvs.window_start       = now;
+        recvs.window_completions = 0;
+    }
+
+    // every pre-posted recv was consumed within the window, so messages are likely arriving unexpected
+    if (++recvs.window_completions >= recvs.infos.size() && recvs.infos.size() < recvs.max_count)
+    {
+        auto count = std::min(recvs.infos.size(), recvs.max_count - recvs.infos.size());
+        DVLOG(10) << "data_plane server: growing pre-posted recvs from " << recvs.infos.size() << " to "
+                  << recvs.infos.size() + count;
+        post_recvs(recvs, count);
+        recvs.window_completions = 0;
+    }
+}
 
 void pre_posted_recv_callback(void* request, ucs_status_t status, const ucp_tag_recv_info_t* msg_info, void* user_data)
 {
@@ -84,14 +125,17 @@ void pre_posted_recv_callback(void* request, ucs_status_t status, const ucp_tag_
         DCHECK_LE(length, info->buffer.bytes());
         memory::TransientBuffer buffer(info->buffer.data(), length, info->buffer);
 
+        // hand the slot over to the shallow copy; it is recycled once released downstream
+        info->buffer.release();
+
         // write tag to channel - create a shallow copy of the transient buffer with received buffer size
         info->channel->await_write(std::make_pair(tag, std::move(buffer)));
 
-        // create a new transient buffer
-        info->buffer = info->pool->await_buffer(info->buffer.bytes());
-
-        // repost recv
+        // repost recv with a fresh slot
+        info->buffer = acquire_recv_buffer(*info->recvs);
         pre_post_recv(info);
+
+        on_pre_posted_recv_completion(*info->recvs);
     }
     else if (status == UCS_ERR_CANCELED)
     {
@@ -118,14 +162,36 @@ void pre_post_recv(detail::PrePostedRecvInfo* info)
     CHECK(!UCS_PTR_IS_ERR(info->request));
 }
 
-}  // namespace
+struct RendezvousRecv
+{
+    rxcpp::subscriber<network_event_t>* subscriber;
+    std::uint64_t tag;
+    memory::TransientBuffer buffer;
+    std::size_t* in_flight;
+};
 
-using namespace mrc::memory::literals;
+void rendezvous_recv_callback(void* request, ucs_status_t status, const ucp_tag_recv_info_t* msg_info, void* user_data)
+{
+    DCHECK(user_data);
+    std::unique_ptr<RendezvousRecv> recv(static_cast<RendezvousRecv*>(user_data));
+    if (status != UCS_OK)
+    {
+        LOG(FATAL) << "data_plane: rendezvous_recv_callback failed with status: " << ucs_status_string(status);
+    }
+    ucp_request_free(request);
+
+    --(*recv->in_flight);
+    recv->subscriber->on_next(std::make_pair(recv->tag, std::move(recv->buffer)));
+}
+
+}  // namespace
 
 class DataPlaneServerWorker final : public node::GenericSource<network_event_t>
 {
   public:
-    DataPlaneServerWorker(ucx::Worker& worker);
+    DataPlaneServerWorker(ucx::Worker& worker,
+                          memory::TransientPool& transient_pool,
+                          const ProgressEngineOptions& options);
 
   private:
     void data_source(rxcpp::subscriber<network_event_t>& s) final;
@@ -135,11 +201,15 @@ class DataPlaneServerWorker final : public node::GenericSource<network_event_t>
                        const ucp_tag_recv_info_t& msg_info);
 
     ucx::Worker& m_worker;
+    memory::TransientPool& m_transient_pool;
+    const ProgressEngineOptions m_options;
+
+    // only messages which did not match a pre-posted recv are probed
+    ucp_tag_t m_tag{TAG_RND_MSG};
+    ucp_tag_t m_tag_mask{TAG_MSG_MASK};
 
-    // modify these to adjust the tag matching
-    // 0/0 is the equivalent of match all tags
-    ucp_tag_t m_tag{0};
-    ucp_tag_t m_tag_mask{0};
+    // rendezvous recvs issued but not yet completed
+    std::size_t m_in_flight{0};
 };
 
 Server::Server(resources::PartitionResourceBase& provider,
@@ -151,7 +221,11 @@ Server::Server(resources::PartitionResourceBase& provider,
   m_ucx(ucx),
   m_host(host),
   m_instance_id(instance_id),
-  m_transient_pool(transient_pool)
+  m_transient_pool(transient_pool),
+  m_recv_slab(std::make_unique<memory::SlabPool>(TAG_EGR_MAX_BYTES,
+                                                 RecvSlotsPerSlab,
+                                                 2 * m_max_pre_posted_recv_count / RecvSlotsPerSlab,
+                                                 m_host.registered_memory_resource()))
 {}
 
 Server::~Server()
@@ -167,18 +241,17 @@ void Server::do_service_start()
             // this recv has no recv payload, we simply write the tag to the channel
             m_prepost_channel = std::make_unique<node::WritableEntrypoint<network_event_t>>();
 
-            m_pre_posted_recv_info.resize(m_pre_posted_recv_count);
-            for (auto& info : m_pre_posted_recv_info)
-            {
-                info.worker  = m_ucx.worker().handle();
-                info.channel = m_prepost_channel.get();
-                info.pool    = &m_transient_pool;
-                info.buffer  = m_transient_pool.await_buffer(1_MiB);
-                pre_post_recv(&info);
-            }
+            m_pre_posted_recvs.worker       = m_ucx.worker().handle();
+            m_pre_posted_recvs.channel      = m_prepost_channel.get();
+            m_pre_posted_recvs.slab         = m_recv_slab.get();
+            m_pre_posted_recvs.pool         = &m_transient_pool;
+            m_pre_posted_recvs.max_count    = m_max_pre_posted_recv_count;
+            m_pre_posted_recvs.window_start = std::chrono::steady_clock::now();
+            post_recvs(m_pre_posted_recvs, m_pre_posted_recv_count);
 
             // source for ucx tag recvs with data
-            auto progress_engine = std::make_unique<DataPlaneServerWorker>(m_ucx.worker());
+            auto progress_engine = std::make_unique<DataPlaneServerWorker>(
+                m_ucx.worker(), m_transient_pool, system().options().progress_engine());
 
             // router for ucx tag recvs with data
             m_deserialize_source = std::make_shared<node::TaggedRouter<PortAddress, memory::TransientBuffer>>();
@@ -207,11 +280,18 @@ void Server::do_service_stop()
 {
     DVLOG(10) << "data_plane server: stop issued";
 
+    // the network thread may be parked on the worker's event fd
+    m_ucx.worker().wake();
+
     m_ucx.network_task_queue()
         .enqueue([this] {
             // we need to cancel all preposted recvs before shutting down the progress engine
             DVLOG(10) << "data_plane server: cancelling all outstanding pre-posted recvs";
-            for (auto& info : m_pre_posted_recv_info)
+
+            // no more recvs may be added while they are being cancelled
+            m_pre_posted_recvs.max_count = m_pre_posted_recvs.infos.size();
+
+            for (auto& info : m_pre_posted_recvs.infos)
             {
                 if (info.request != nullptr)
                 {
@@ -257,46 +337,70 @@ node::TaggedRouter<PortAddress, memory::TransientBuffer>& Server::deserialize_so
     return *m_deserialize_source;
 }
 
+void Server::set_pre_post_growth_window(std::chrono::steady_clock::duration window)
+{
+    m_ucx.network_task_queue()
+        .enqueue([this, window] {
+            m_pre_posted_recvs.growth_window = window;
+        })
+        .get();
+}
+
+std::size_t Server::pre_posted_recv_count() const
+{
+    return m_pre_posted_recvs.posted_count.load(std::memory_order_relaxed);
+}
+
 // NetworkEventProgressEngine
 
-DataPlaneServerWorker::DataPlaneServerWorker(ucx::Worker& worker) : m_worker(worker) {}
+DataPlaneServerWorker::DataPlaneServerWorker(ucx::Worker& worker,
+                                             memory::TransientPool& transient_pool,
+                                             const ProgressEngineOptions& options) :
+  m_worker(worker),
+  m_transient_pool(transient_pool),
+  m_options(options)
+{}
 
 void DataPlaneServerWorker::data_source(rxcpp::subscriber<network_event_t>& s)
 {
     ucp_tag_message_h msg;
     ucp_tag_recv_info_t msg_info;
-    std::uint32_t backoff = 1;
 
     DVLOG(10) << "starting data plane server progress engine loop";
 
-    // the progress loop has tag_probe_nb disabled
-    // this should be re-enabled to accept tagged messages that have payloads
-    // larger than the pre-posted recv buffers
+    ucx::AdaptiveProgress progress(m_worker, m_options);
 
+    // eager messages complete the pre-posted recvs while the worker is progressed, messages larger than the
+    // pre-posted recv buffers are probed for and received into a buffer of their exact size
     while (true)
     {
-        for (;;)
+        bool active = false;
+
+        if (!s.is_subscribed())
         {
-            // msg = ucp_tag_probe_nb(m_worker->handle(), m_tag, m_tag_mask, 1, &msg_info);
-            if (!s.is_subscribed())
+            // the subscriber is only referenced by in-flight rendezvous recvs until they complete
+            if (m_in_flight == 0)
             {
                 DVLOG(10) << "exiting data plane server progress engine loop";
                 return;
             }
-            // if (msg != nullptr)
-            // {
-            //     break;
-            // }
-            while (m_worker.progress() != 0U)
+        }
+        else
+        {
+            msg = ucp_tag_probe_nb(m_worker.handle(), m_tag, m_tag_mask, 1, &msg_info);
+            if (msg != nullptr)
             {
-                backoff = 1;
+                on_tagged_msg(s, msg, msg_info);
+                active = true;
             }
+        }
 
-            boost::this_fiber::yield();
+        while (m_worker.progress() != 0U)
+        {
+            active = true;
         }
 
-        // on_tagged_msg(s, msg, msg_info);
-        // backoff = 1;
+        progress.wait(active);
     }
 }
 
@@ -305,47 +409,38 @@ void DataPlaneServerWorker::on_tagged_msg(rxcpp::subscriber<network_event_t>& su
                                           const ucp_tag_recv_info_t& msg_info)
 {
     ucp_request_param_t params;
-    params.op_attr_mask = UCP_OP_ATTR_FIELD_CALLBACK;
-    params.cb.recv      = zero_bytes_completion_handler;
-    params.user_data    = nullptr;
-
-    // receive buffer
-    void* recv_addr        = nullptr;
-    std::size_t recv_bytes = 0;
 
     auto msg_type = decode_tag_msg(msg_info.sender_tag);
 
     switch (msg_type)
     {
     case TAG_RND_MSG: {
-        params.op_attr_mask = UCP_OP_ATTR_FIELD_CALLBACK |   // recv_completion_handler
+        params.op_attr_mask = UCP_OP_ATTR_FIELD_CALLBACK |   // rendezvous_recv_callback
                               UCP_OP_ATTR_FIELD_USER_DATA |  // user_data
-                              UCP_OP_ATTR_FIELD_RECV_INFO |  // not sure if this is needed
                               UCP_OP_ATTR_FLAG_NO_IMM_CMPL;  // force the completion handler to be used
 
-        // todo(#139) - replace malloc with an unexpected receive / transactional memory_resource for
-        // ultra fast allocation
-        // in that work create a struct InFlightEncodedObject and allocate msg_info.length +
-        // sizeof(InFightEncodedObject) + alignment, and pass the starting pointer of that block to the user_data void*
-        // of the callback. Then unpack the struct and blob in the callback. The pointer to the subscriber is part of
-        // the InFlightEncodedObject which will remove the thread local storage pointer we are doing now.
-
-        recv_bytes       = msg_info.length;
-        recv_addr        = std::malloc(recv_bytes);
-        params.user_data = recv_addr;
-        // params.cb.recv   = recv_completion_handler;
+        // the transient pool serves payloads larger than its blocks directly from its registered memory resource
+        auto* recv = new RendezvousRecv{&subscriber,
+                                        decode_user_bits(msg_info.sender_tag),
+                                        m_transient_pool.await_buffer(msg_info.length),
+                                        &m_in_flight};
+
+        params.cb.recv   = rendezvous_recv_callback;
+        params.user_data = recv;
+
+        void* request =
+            ucp_tag_msg_recv_nbx(m_worker.handle(), recv->buffer.data(), recv->buffer.bytes(), msg, &params);
+        if (UCS_PTR_IS_ERR(request))
+        {
+            LOG(FATAL) << "ucp_tag_msg_recv_nbx for rendezvous message failed";
+        }
+        ++m_in_flight;
         break;
     }
 
     default:
         LOG(FATAL) << "unknown network event received: " << msg_info.sender_tag;
     };
-
-    void* status = ucp_tag_msg_recv_nbx(m_worker.handle(), recv_addr, recv_bytes, msg, &params);
-    if (UCS_PTR_IS_ERR(status))
-    {
-        LOG(FATAL) << "ucp_tag_msg_recv_nbx for 0-byte event failed";
-    }
 }
 
 }  // namespace mrc::internal::data_plane
@@ -17,6 +17,7 @@
 
 #pragma once
 
+#include "internal/memory/slab_pool.hpp"
 #include "internal/memory/transient_pool.hpp"
 #include "internal/resources/partition_resources_base.hpp"
 #include "internal/service.hpp"
@@ -27,11 +28,13 @@
 
 #include <ucp/api/ucp_def.h>
 
+#include <atomic>
+#include <chrono>
 #include <cstddef>
 #include <cstdint>
+#include <deque>
 #include <memory>
 #include <utility>
-#include <vector>
 
 // IWYU pragma: no_forward_declare mrc::node::WritableEntrypoint
 
@@ -75,13 +78,40 @@ namespace mrc::internal::data_plane {
 using network_event_t = std::pair<std::uint64_t, memory::TransientBuffer>;
 
 namespace detail {
+struct PrePostedRecvs;
+
 struct PrePostedRecvInfo
 {
     ucp_worker_h worker;
     node::WritableEntrypoint<network_event_t>* channel;
     void* request;
     memory::TransientBuffer buffer;
+    PrePostedRecvs* recvs;
+};
+
+/**
+ * @brief State shared by the pre-posted eager recvs of a Server
+ *
+ * Recv buffers are slots of a registered SlabPool; a slot is recycled once the TransientBuffer emitted for it is
+ * released downstream. When every pre-posted recv completes within a single growth window the number of pre-posted
+ * recvs is doubled, up to max_count. Only accessed from the network thread which progresses the ucx worker.
+ */
+struct PrePostedRecvs
+{
+    ucp_worker_h worker;
+    node::WritableEntrypoint<network_event_t>* channel;
+    memory::SlabPool* slab;
     memory::TransientPool* pool;
+    std::size_t max_count;
+
+    // deque so the infos passed to ucx as user_data are not moved when more recvs are posted
+    std::deque<PrePostedRecvInfo> infos;
+    std::atomic_size_t posted_count{0};
+
+    // the recvs are doubled when all of them complete within this window
+    std::chrono::steady_clock::duration growth_window{std::chrono::milliseconds(1)};
+    std::chrono::steady_clock::time_point window_start;
+    std::size_t window_completions{0};
 };
 }  // namespace detail
 
@@ -99,6 +129,16 @@ class Server final : public Service, public resources::PartitionResourceBase
 
     node::TaggedRouter<PortAddress, memory::TransientBuffer>& deserialize_source();
 
+    /**
+     * @brief Number of eager recvs currently pre-posted; grows under load up to max_pre_posted_recv_count
+     */
+    std::size_t pre_posted_recv_count() const;
+
+    /**
+     * @brief Window within which every pre-posted recv must complete for their number to grow, 1ms by default
+     */
+    void set_pre_post_growth_window(std::chrono::steady_clock::duration window);
+
   private:
     void do_service_start() final;
     void do_service_await_live() final;
@@ -107,6 +147,7 @@ class Server final : public Service, public resources::PartitionResourceBase
     void do_service_await_join() final;
 
     const std::size_t m_pre_posted_recv_count{16};
+    const std::size_t m_max_pre_posted_recv_count{256};
 
     // ucx resources
     ucx::Resources& m_ucx;
@@ -116,6 +157,10 @@ class Server final : public Service, public resources::PartitionResourceBase
     // transient memory pool
     memory::TransientPool& m_transient_pool;
 
+    // registered recv buffers for the pre-posted eager recvs; holds twice the maximum number of pre-posted recvs, so
+    // every recv can be re-posted into a slot while as many received buffers are still held downstream
+    std::unique_ptr<memory::SlabPool> m_recv_slab;
+
     // deserialization nodes will connect to this source wtih their port id
     // the source for this router is the private GenericSoruce of this object
     std::shared_ptr<node::TaggedRouter<PortAddress, memory::TransientBuffer>> m_deserialize_source;
@@ -125,7 +170,7 @@ class Server final : public Service, public resources::PartitionResourceBase
     std::unique_ptr<node::WritableEntrypoint<network_event_t>> m_prepost_channel;
 
     // pre-posted recv state
-    std::vector<detail::PrePostedRecvInfo> m_pre_posted_recv_info;
+    detail::PrePostedRecvs m_pre_posted_recvs;
 
     // runner for the ucx progress engine event source
     std::unique_ptr<mrc::runnable::Runner> m_progress_engine;
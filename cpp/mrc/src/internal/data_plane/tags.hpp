@@ -19,6 +19,7 @@
 
 #include <ucp/api/ucp.h>
 
+#include <cstddef>
 #include <cstdint>
 #include <stdexcept>
 #include <tuple>
@@ -32,6 +33,10 @@ static constexpr ucp_tag_t TAG_EGR_MSG  = 0x4000000000000000;  // leading 4 bits
 static constexpr ucp_tag_t TAG_P2P_MSG  = 0x2000000000000000;  // leading 4 bits are 0010  // NOLINT
 static constexpr ucp_tag_t TAG_UKN_MSG  = 0x1000000000000000;  // leading 4 bits are 0001  // NOLINT
 
+// eager messages are received into the pre-posted recv buffers of the data plane server, larger messages are
+// sent as TAG_RND_MSG and received into a buffer sized by the server once the message has been probed
+static constexpr std::size_t TAG_EGR_MAX_BYTES = 1UL << 20;  // 1 MiB  // NOLINT
+
 static constexpr ucp_tag_t TAG_CTRL_MASK = 0xFFFF000000000000;  // 48-bits  // NOLINT
 static constexpr ucp_tag_t TAG_USER_MASK = 0x0000FFFFFFFFFFFF;  // 48-bits  // NOLINT
 
@@ -0,0 +1,88 @@
+/**
+ * SPDX-FileCopyrightText: Copyright (c) 2022-2023, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "internal/memory/arena_metrics.hpp"
+
+#include "mrc/memory/resources/arena_resource.hpp"
+#include "mrc/memory/resources/memory_resource.hpp"
+
+#include <spdlog/sinks/basic_file_sink.h>
+
+#include <functional>
+#include <string>
+#include <utility>
+
+namespace mrc::internal::memory {
+
+namespace {
+
+// the pools of both host and device resources adapt the type-erased registered resource
+using pool_resource_t = mrc::memory::arena_resource<std::shared_ptr<mrc::memory::memory_resource>>;
+
+void make_stats_gauge(metrics::Registry& registry,
+                      std::string name,
+                      const metrics::Registry::labels_t& labels,
+                      std::weak_ptr<pool_resource_t> weak_pool,
+                      std::function<double(const mrc::memory::arena_stats&)> value_fn)
+{
+    registry.make_callback_gauge(std::move(name),
+                                 labels,
+                                 [weak_pool = std::move(weak_pool), value_fn = std::move(value_fn)] {
+                                     auto pool = weak_pool.lock();
+                                     return pool ? value_fn(pool->stats()) : 0.0;
+                                 });
+}
+
+}  // namespace
+
+void register_arena_metrics(metrics::Registry& registry,
+                            const metrics::Registry::labels_t& labels,
+                            const std::shared_ptr<mrc::memory::memory_resource>& resource)
+{
+    auto pool = std::dynamic_pointer_cast<pool_resource_t>(resource);
+    if (!pool)
+    {
+        return;
+    }
+
+    make_stats_gauge(registry, "mrc_memory_pool_cache_hit_ratio", labels, pool, [](const auto& stats) {
+        return stats.hit_rate();
+    });
+    make_stats_gauge(registry, "mrc_memory_pool_lock_contention_ratio", labels, pool, [](const auto& stats) {
+        return stats.contention();
+    });
+    make_stats_gauge(registry, "mrc_memory_pool_fragmentation_ratio", labels, pool, [](const auto& stats) {
+        return stats.fragmentation();
+    });
+    make_stats_gauge(registry, "mrc_memory_pool_size_bytes", labels, pool, [](const auto& stats) {
+        return static_cast<double>(stats.current_size);
+    });
+    make_stats_gauge(registry, "mrc_memory_pool_free_bytes", labels, pool, [](const auto& stats) {
+        return static_cast<double>(stats.free_bytes);
+    });
+
+    registry.set_help("mrc_memory_pool_cache_hit_ratio",
+                      "fraction of small allocations served from the per-thread caches of a memory pool");
+    registry.set_help("mrc_memory_pool_lock_contention_ratio",
+                      "fraction of acquisitions of the global lock of a memory pool which waited for another thread");
+    registry.set_help("mrc_memory_pool_fragmentation_ratio",
+                      "fraction of the free bytes of a memory pool outside its largest free block");
+    registry.set_help("mrc_memory_pool_size_bytes", "bytes a memory pool has allocated from upstream");
+    registry.set_help("mrc_memory_pool_free_bytes", "bytes in the free blocks of the global arena of a memory pool");
+}
+
+}  // namespace mrc::internal::memory
@@ -0,0 +1,40 @@
+/**
+ * SPDX-FileCopyrightText: Copyright (c) 2022-2023, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include "mrc/metrics/registry.hpp"
+
+#include <memory>
+
+namespace mrc::memory {
+struct memory_resource;
+}  // namespace mrc::memory
+
+namespace mrc::internal::memory {
+
+/**
+ * @brief Publishes the cache hit rate, global lock contention, fragmentation and size of an arena_resource as callback
+ * gauges. Does nothing if resource is not an arena, i.e. when the memory pool is disabled.
+ *
+ * The gauges only hold a weak reference to the arena and read zero once it has been destroyed.
+ */
+void register_arena_metrics(metrics::Registry& registry,
+                            const metrics::Registry::labels_t& labels,
+                            const std::shared_ptr<mrc::memory::memory_resource>& resource);
+
+}  // namespace mrc::internal::memory
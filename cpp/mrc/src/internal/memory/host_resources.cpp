@@ -18,19 +18,24 @@
 #include "internal/memory/host_resources.hpp"
 
 #include "internal/memory/callback_adaptor.hpp"
+#include "internal/memory/numa_memory_resource.hpp"
 #include "internal/runnable/resources.hpp"
 #include "internal/system/host_partition.hpp"
+#include "internal/system/partitions.hpp"
 #include "internal/system/system.hpp"
 #include "internal/ucx/registation_callback_builder.hpp"
 
 #include "mrc/core/task_queue.hpp"
 #include "mrc/memory/adaptors.hpp"
+#include "mrc/memory/literals.hpp"
 #include "mrc/memory/resources/arena_resource.hpp"
+#include "mrc/memory/resources/host/huge_page_memory_resource.hpp"
 #include "mrc/memory/resources/host/malloc_memory_resource.hpp"
 #include "mrc/memory/resources/host/pinned_memory_resource.hpp"
 #include "mrc/memory/resources/logging_resource.hpp"
 #include "mrc/memory/resources/memory_resource.hpp"
 #include "mrc/options/options.hpp"
+#include "mrc/options/placement.hpp"
 #include "mrc/options/resources.hpp"
 #include "mrc/types.hpp"
 #include "mrc/utils/bytes_to_string.hpp"
@@ -48,8 +53,36 @@
 #include <utility>
 #include <vector>
 
+using namespace mrc::memory::literals;
+
 namespace mrc::internal::memory {
 
+namespace {
+
+std::shared_ptr<mrc::memory::memory_resource> make_huge_page_resource(const MemoryPoolOptions& opts, bool prefault)
+{
+    using huge_page_resource_t = mrc::memory::huge_page_memory_resource;
+
+    switch (opts.huge_pages())
+    {
+    case HugePages::Transparent:
+        return std::make_shared<huge_page_resource_t>(huge_page_resource_t::huge_page_2mib, false, prefault);
+    case HugePages::Explicit2MiB:
+        return std::make_shared<huge_page_resource_t>(huge_page_resource_t::huge_page_2mib, true, prefault);
+    case HugePages::Explicit1GiB:
+        return std::make_shared<huge_page_resource_t>(huge_page_resource_t::huge_page_1gib, true, prefault);
+    case HugePages::Disabled:
+        break;
+    }
+    LOG(FATAL) << "huge pages are disabled";
+    return nullptr;
+}
+
+// without a pool, host buffers come straight from malloc; only those large enough to own whole pages are bound
+constexpr std::size_t NumaBindMinBytes = 1_MiB;
+
+}  // namespace
+
 HostResources::HostResources(runnable::Resources& runnable, ucx::RegistrationCallbackBuilder&& callbacks) :
   system::HostPartitionProvider(runnable)
 {
@@ -58,11 +91,51 @@ HostResources::HostResources(runnable::Resources& runnable, ucx::RegistrationCal
             // logging prefix
             std::stringstream prefix;
 
-            // construct raw memory_resource from malloc or pinned if device(s) present
+            const auto& resource_opts = system().options().resources();
+            const auto& pool_opts     = resource_opts.host_memory_pool();
+            const bool per_numa_node  = system().partitions().cpu_strategy() == PlacementStrategy::PerNumaNode;
+
+            // construct raw memory_resource from malloc or pinned if device(s) present; when partitioned per numa node,
+            // host memory is bound to the partition's numa node(s) rather than left to first-touch placement. Each
+            // NumaMemoryResource allocation is a separate mapping, so it is only used as the upstream of the arena
+            const bool pool = resource_opts.enable_host_memory_pool();
             if (host_partition().device_partition_ids().empty())
             {
-                m_system = std::make_shared<mrc::memory::malloc_memory_resource>();
-                prefix << "malloc";
+                if (pool && pool_opts.huge_pages() != HugePages::Disabled)
+                {
+                    // pages must be bound before they are faulted in, so the binding adaptor does the prefaulting
+                    m_system = make_huge_page_resource(pool_opts, pool_opts.prefault() && !per_numa_node);
+                    prefix << "huge_pages";
+
+                    if (per_numa_node)
+                    {
+                        m_system = mrc::memory::make_shared_resource<NumaBindingAdaptor>(std::move(m_system),
+                                                                                         system().topology(),
+                                                                                         host_partition().numa_set(),
+                                                                                         0,
+                                                                                         pool_opts.prefault());
+                        prefix << "+numa[" << host_partition().numa_set().str() << "]";
+                    }
+                }
+                else if (per_numa_node && pool)
+                {
+                    m_system = std::make_shared<NumaMemoryResource>(system().topology(), host_partition().numa_set());
+                    prefix << "numa[" << host_partition().numa_set().str() << "]";
+                }
+                else if (per_numa_node)
+                {
+                    m_system = mrc::memory::make_shared_resource<NumaBindingAdaptor>(
+                        std::make_shared<mrc::memory::malloc_memory_resource>(),
+                        system().topology(),
+                        host_partition().numa_set(),
+                        NumaBindMinBytes);
+                    prefix << "malloc+numa[" << host_partition().numa_set().str() << "]";
+                }
+                else
+                {
+                    m_system = std::make_shared<mrc::memory::malloc_memory_resource>();
+                    prefix << "malloc";
+                }
             }
             else
             {
@@ -86,7 +159,7 @@ HostResources::HostResources(runnable::Resources& runnable, ucx::RegistrationCal
             }
 
             // adapt to arena
-            if (system().options().resources().enable_host_memory_pool())
+            if (pool)
             {
                 const auto& opts = system().options().resources().host_memory_pool();
 
@@ -0,0 +1,94 @@
+/**
+ * SPDX-FileCopyrightText: Copyright (c) 2022-2023, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "internal/memory/numa_memory_resource.hpp"
+
+#include "internal/system/topology.hpp"
+
+#include <glog/logging.h>
+#include <hwloc.h>
+
+#include <cerrno>
+#include <new>
+#include <utility>
+
+namespace mrc::internal::memory {
+
+NumaMemoryResource::NumaMemoryResource(const system::Topology& topology, NumaSet numa_set) :
+  m_topology(topology),
+  m_numa_set(std::move(numa_set))
+{
+    CHECK_GT(m_numa_set.weight(), 0) << "a NumaMemoryResource requires at least one NUMA node";
+}
+
+const NumaSet& NumaMemoryResource::numa_set() const
+{
+    return m_numa_set;
+}
+
+void* NumaMemoryResource::do_allocate(std::size_t bytes)
+{
+    if (bytes == 0)
+    {
+        return nullptr;
+    }
+
+    void* ptr = hwloc_alloc_membind(
+        m_topology.handle(), bytes, &m_numa_set.bitmap(), HWLOC_MEMBIND_BIND, HWLOC_MEMBIND_BYNODESET);
+
+    // ENOSYS / EXDEV: the OS does not support binding (e.g. inside some containers); first-touch is all we can do
+    if (ptr == nullptr && errno != ENOMEM)
+    {
+        LOG_FIRST_N(WARNING, 1) << "unable to bind host memory to numa nodes " << m_numa_set.str()
+                                << "; falling back to unbound allocations";  // NOLINT
+        ptr = hwloc_alloc(m_topology.handle(), bytes);
+    }
+
+    if (ptr == nullptr)
+    {
+        throw std::bad_alloc();
+    }
+
+    return ptr;
+}
+
+void NumaMemoryResource::do_deallocate(void* ptr, std::size_t bytes)
+{
+    CHECK_HWLOC(hwloc_free(m_topology.handle(), ptr, bytes));
+}
+
+mrc::memory::memory_kind NumaMemoryResource::do_kind() const
+{
+    return mrc::memory::memory_kind::host;
+}
+
+void bind_to_numa_set(const system::Topology& topology, const NumaSet& numa_set, void* ptr, std::size_t bytes)
+{
+    auto rc = hwloc_set_area_membind(topology.handle(),
+                                     ptr,
+                                     bytes,
+                                     &numa_set.bitmap(),
+                                     HWLOC_MEMBIND_BIND,
+                                     HWLOC_MEMBIND_BYNODESET | HWLOC_MEMBIND_MIGRATE);
+    if (rc != 0)
+    {
+        LOG_FIRST_N(WARNING, 1) << "unable to bind host memory to numa nodes " << numa_set.str()
+                                << "; pages are placed on first touch";  // NOLINT
+    }
+}
+
+}  // namespace mrc::internal::memory
@@ -0,0 +1,128 @@
+/**
+ * SPDX-FileCopyrightText: Copyright (c) 2022-2023, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include "mrc/core/bitmap.hpp"
+#include "mrc/memory/adaptors.hpp"
+#include "mrc/memory/memory_kind.hpp"
+#include "mrc/memory/resources/host/huge_page_memory_resource.hpp"
+#include "mrc/memory/resources/memory_resource.hpp"
+
+#include <unistd.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <utility>
+
+namespace mrc::internal::system {
+class Topology;
+}  // namespace mrc::internal::system
+
+namespace mrc::internal::memory {
+
+/**
+ * @brief Host memory_resource whose pages are bound to a set of NUMA nodes via hwloc.
+ *
+ * Unlike malloc, placement does not depend on which thread first touches the pages. Each allocation is a separate
+ * mapping rounded up to the page size, so the resource is meant to be the upstream of a pool such as the arena.
+ * If the OS cannot bind memory, allocations fall back to unbound pages and a warning is logged once.
+ *
+ * The Topology must outlive the resource.
+ */
+class NumaMemoryResource final : public mrc::memory::memory_resource
+{
+  public:
+    NumaMemoryResource(const system::Topology& topology, NumaSet numa_set);
+
+    const NumaSet& numa_set() const;
+
+  private:
+    void* do_allocate(std::size_t bytes) final;
+    void do_deallocate(void* ptr, std::size_t bytes) final;
+    mrc::memory::memory_kind do_kind() const final;
+
+    const system::Topology& m_topology;
+    const NumaSet m_numa_set;
+};
+
+/**
+ * @brief Binds [ptr, ptr + bytes) to the NUMA nodes in numa_set, migrating pages which were already faulted in.
+ * Logs a warning once if the OS cannot bind memory.
+ */
+void bind_to_numa_set(const system::Topology& topology, const NumaSet& numa_set, void* ptr, std::size_t bytes);
+
+/**
+ * @brief Adaptor which binds the allocations of an upstream host resource, e.g. huge_page_memory_resource or malloc, to
+ * a set of NUMA nodes.
+ *
+ * Only the whole pages inside an allocation of at least min_bytes are bound. Over malloc, small allocations share their
+ * pages with other allocations and are left to first-touch placement by the partition's threads, and large ones are
+ * bound without turning every allocation into a separate mapping.
+ *
+ * A memory policy only places pages faulted in after it is set, so the upstream must not prefault its allocations;
+ * with prefault, the adaptor faults the pages in itself once they are bound.
+ */
+template <typename UpstreamT>
+class NumaBindingAdaptor final : public mrc::memory::adaptor<UpstreamT>
+{
+  public:
+    NumaBindingAdaptor(UpstreamT upstream,
+                       const system::Topology& topology,
+                       NumaSet numa_set,
+                       std::size_t min_bytes = 0,
+                       bool prefault         = false) :
+      mrc::memory::adaptor<UpstreamT>(std::move(upstream)),
+      m_topology(topology),
+      m_numa_set(std::move(numa_set)),
+      m_min_bytes(min_bytes),
+      m_prefault(prefault)
+    {}
+
+  private:
+    void* do_allocate(std::size_t bytes) final
+    {
+        void* ptr = this->resource().allocate(bytes);
+        if (ptr != nullptr && bytes >= m_min_bytes)
+        {
+            const auto page_size = static_cast<std::uintptr_t>(sysconf(_SC_PAGESIZE));
+            const auto begin     = (reinterpret_cast<std::uintptr_t>(ptr) + page_size - 1) & ~(page_size - 1);
+            const auto end       = (reinterpret_cast<std::uintptr_t>(ptr) + bytes) & ~(page_size - 1);
+            if (begin < end)
+            {
+                bind_to_numa_set(m_topology, m_numa_set, reinterpret_cast<void*>(begin), end - begin);  // NOLINT
+            }
+        }
+        if (ptr != nullptr && m_prefault)
+        {
+            mrc::memory::huge_page_memory_resource::touch(ptr, bytes);
+        }
+        return ptr;
+    }
+
+    void do_deallocate(void* ptr, std::size_t bytes) final
+    {
+        this->resource().deallocate(ptr, bytes);
+    }
+
+    const system::Topology& m_topology;
+    const NumaSet m_numa_set;
+    const std::size_t m_min_bytes;
+    const bool m_prefault;
+};
+
+}  // namespace mrc::internal::memory
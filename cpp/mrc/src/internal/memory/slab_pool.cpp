@@ -0,0 +1,238 @@
+/**
+ * SPDX-FileCopyrightText: Copyright (c) 2022-2023, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "internal/memory/slab_pool.hpp"
+
+#include "mrc/memory/buffer.hpp"
+#include "mrc/memory/resources/memory_resource.hpp"
+
+#include <glog/logging.h>
+
+#include <algorithm>
+#include <cstddef>
+#include <mutex>
+#include <new>
+#include <utility>
+#include <vector>
+
+namespace mrc::internal::memory {
+
+struct SlabPool::State
+{
+    State(std::size_t slot_size,
+          std::size_t slots_per_slab,
+          std::size_t max_slabs,
+          std::shared_ptr<mrc::memory::memory_resource> mr) :
+      slot_size(slot_size),
+      slots_per_slab(slots_per_slab),
+      max_slabs(max_slabs),
+      mr(std::move(mr))
+    {}
+
+    ~State()
+    {
+        for (auto* block : free_blocks)
+        {
+            ::operator delete(block);
+        }
+    }
+
+    // requires the lock
+    bool grow()
+    {
+        if (slabs.size() >= max_slabs)
+        {
+            return false;
+        }
+
+        auto& slab = slabs.emplace_back(slot_size * slots_per_slab, mr);
+        auto* addr = static_cast<std::byte*>(slab.data());
+
+        // push in reverse so slots are handed out in address order
+        for (std::size_t i = slots_per_slab; i > 0; --i)
+        {
+            free_slots.push_back(addr + (i - 1) * slot_size);
+        }
+        return true;
+    }
+
+    void release(const void* slot)
+    {
+        std::lock_guard<decltype(mutex)> lock(mutex);
+        free_slots.push_back(static_cast<std::byte*>(const_cast<void*>(slot)));
+        --in_use;
+    }
+
+    // control blocks all have the same size, so they are recycled rather than returned to the heap
+    void* allocate_block(std::size_t bytes)
+    {
+        {
+            std::lock_guard<decltype(mutex)> lock(mutex);
+            if (bytes == block_size && !free_blocks.empty())
+            {
+                auto* block = free_blocks.back();
+                free_blocks.pop_back();
+                return block;
+            }
+            if (block_size == 0)
+            {
+                block_size = bytes;
+            }
+        }
+        return ::operator new(bytes);
+    }
+
+    void deallocate_block(void* block, std::size_t bytes)
+    {
+        {
+            std::lock_guard<decltype(mutex)> lock(mutex);
+            if (bytes == block_size)
+            {
+                free_blocks.push_back(block);
+                return;
+            }
+        }
+        ::operator delete(block);
+    }
+
+    const std::size_t slot_size;
+    const std::size_t slots_per_slab;
+    const std::size_t max_slabs;
+    const std::shared_ptr<mrc::memory::memory_resource> mr;
+
+    mutable std::mutex mutex;
+    std::vector<mrc::memory::buffer> slabs;
+    std::vector<std::byte*> free_slots;
+    std::size_t in_use{0};
+    std::size_t high_water{0};
+
+    std::size_t block_size{0};
+    std::vector<void*> free_blocks;
+};
+
+/**
+ * @brief Allocates the shared_ptr control block of each slot from the free blocks of the pool; the allocator stored in
+ * the control block keeps the pool state alive until the control block itself has been returned
+ */
+template <typename T>
+class SlabPool::ControlBlockAllocator
+{
+  public:
+    using value_type = T;
+
+    explicit ControlBlockAllocator(std::shared_ptr<State> state) : m_state(std::move(state)) {}
+
+    template <typename U>
+    ControlBlockAllocator(const ControlBlockAllocator<U>& other) : m_state(other.m_state)
+    {}
+
+    T* allocate(std::size_t count)
+    {
+        return static_cast<T*>(m_state->allocate_block(count * sizeof(T)));
+    }
+
+    void deallocate(T* block, std::size_t count)
+    {
+        m_state->deallocate_block(block, count * sizeof(T));
+    }
+
+    template <typename U>
+    bool operator==(const ControlBlockAllocator<U>& other) const
+    {
+        return m_state == other.m_state;
+    }
+
+    template <typename U>
+    bool operator!=(const ControlBlockAllocator<U>& other) const
+    {
+        return !(*this == other);
+    }
+
+  private:
+    template <typename U>
+    friend class ControlBlockAllocator;
+
+    std::shared_ptr<State> m_state;
+};
+
+SlabPool::SlabPool(std::size_t slot_size,
+                   std::size_t slots_per_slab,
+                   std::size_t max_slabs,
+                   std::shared_ptr<mrc::memory::memory_resource> mr)
+{
+    CHECK_GT(slot_size, 0);
+    CHECK_GT(slots_per_slab, 0);
+    CHECK_GT(max_slabs, 0);
+    CHECK(mr);
+
+    // keep every slot as aligned as the slab itself
+    constexpr std::size_t alignment = alignof(std::max_align_t);
+    slot_size                       = (slot_size + alignment - 1) / alignment * alignment;
+
+    m_state = std::make_shared<State>(slot_size, slots_per_slab, max_slabs, std::move(mr));
+}
+
+SlabPool::~SlabPool() = default;
+
+TransientBuffer SlabPool::try_acquire()
+{
+    std::byte* slot = nullptr;
+    {
+        std::lock_guard<decltype(m_state->mutex)> lock(m_state->mutex);
+        if (m_state->free_slots.empty() && !m_state->grow())
+        {
+            return {};
+        }
+        slot = m_state->free_slots.back();
+        m_state->free_slots.pop_back();
+        m_state->high_water = std::max(m_state->high_water, ++m_state->in_use);
+    }
+
+    // the allocator held by the control block outlives the deleter, so the deleter does not need its own reference
+    std::shared_ptr<const void> backing(
+        slot,
+        [state = m_state.get()](const void* ptr) {
+            state->release(ptr);
+        },
+        ControlBlockAllocator<std::byte>(m_state));
+    return {slot, m_state->slot_size, std::move(backing)};
+}
+
+std::size_t SlabPool::slot_size() const
+{
+    return m_state->slot_size;
+}
+
+std::size_t SlabPool::capacity() const
+{
+    std::lock_guard<decltype(m_state->mutex)> lock(m_state->mutex);
+    return m_state->slabs.size() * m_state->slots_per_slab;
+}
+
+std::size_t SlabPool::slots_in_use() const
+{
+    std::lock_guard<decltype(m_state->mutex)> lock(m_state->mutex);
+    return m_state->in_use;
+}
+
+std::size_t SlabPool::high_water_slots() const
+{
+    std::lock_guard<decltype(m_state->mutex)> lock(m_state->mutex);
+    return m_state->high_water;
+}
+
+}  // namespace mrc::internal::memory
@@ -0,0 +1,93 @@
+/**
+ * SPDX-FileCopyrightText: Copyright (c) 2022-2023, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include "internal/memory/transient_pool.hpp"
+
+#include "mrc/utils/macros.hpp"
+
+#include <cstddef>
+#include <memory>
+
+namespace mrc::memory {
+struct memory_resource;
+}  // namespace mrc::memory
+
+namespace mrc::internal::memory {
+
+/**
+ * @brief Fixed-size slot allocator carving equally sized buffers out of a small number of large slabs
+ *
+ * Slabs are allocated lazily from the memory resource, up to max_slabs, and are never returned to it while the pool or
+ * any buffer handed out by it is alive. When backed by a registered memory resource every slot is pre-registered, so
+ * handing out a slot costs a free-list pop and never touches the allocator or the registration cache.
+ *
+ * Slots are handed out as TransientBuffers; a slot returns to the free list when the last TransientBuffer referencing
+ * it, including any shallow copy of it, is released. Slots may be released from any thread. The reference count
+ * control blocks of released slots are recycled as well, so steady-state acquisition does not allocate.
+ */
+class SlabPool
+{
+  public:
+    SlabPool(std::size_t slot_size,
+             std::size_t slots_per_slab,
+             std::size_t max_slabs,
+             std::shared_ptr<mrc::memory::memory_resource> mr);
+    ~SlabPool();
+
+    DELETE_COPYABILITY(SlabPool);
+    DELETE_MOVEABILITY(SlabPool);
+
+    /**
+     * @brief Acquire a slot of slot_size() bytes.
+     *
+     * @return TransientBuffer - empty, i.e. data() == nullptr, if every slot of max_slabs slabs is in use
+     */
+    TransientBuffer try_acquire();
+
+    /**
+     * @brief Size in bytes of each slot
+     */
+    std::size_t slot_size() const;
+
+    /**
+     * @brief Number of slots in the slabs allocated so far
+     */
+    std::size_t capacity() const;
+
+    /**
+     * @brief Number of slots currently referenced by a TransientBuffer
+     */
+    std::size_t slots_in_use() const;
+
+    /**
+     * @brief Maximum value slots_in_use() has reached
+     */
+    std::size_t high_water_slots() const;
+
+  private:
+    struct State;
+
+    template <typename T>
+    class ControlBlockAllocator;
+
+    // shared with the deleters of the outstanding slots, which may outlive the pool
+    std::shared_ptr<State> m_state;
+};
+
+}  // namespace mrc::internal::memory
@@ -17,22 +17,96 @@
 
 #include "internal/memory/transient_pool.hpp"
 
+#include "mrc/memory/resources/memory_resource.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <functional>
 #include <ostream>
+#include <thread>
 
 #define MRC_DEBUG 1
 
 namespace mrc::internal::memory {
 
-TransientBuffer::TransientBuffer(void* addr, std::size_t bytes, mrc::data::SharedReusable<mrc::memory::buffer> buffer) :
+struct TransientPool::Metrics
+{
+    void acquire(std::size_t bytes)
+    {
+        auto in_use = bytes_in_use.fetch_add(bytes, std::memory_order_relaxed) + bytes;
+        auto high   = high_water_bytes.load(std::memory_order_relaxed);
+        while (in_use > high && !high_water_bytes.compare_exchange_weak(high, in_use, std::memory_order_relaxed)) {}
+    }
+
+    void release(std::size_t bytes)
+    {
+        bytes_in_use.fetch_sub(bytes, std::memory_order_relaxed);
+    }
+
+    std::atomic_size_t bytes_in_use{0};
+    std::atomic_size_t high_water_bytes{0};
+    std::atomic_size_t large_allocations{0};
+    std::atomic_size_t overflow_blocks{0};
+};
+
+/**
+ * @brief Keeps a block, or a large allocation, alive while any region or TransientBuffer references it and accounts
+ * for it in the pool metrics. Either a pooled block, which returns to the pool on destruction, or an owned buffer.
+ */
+class TransientPool::Lease
+{
+  public:
+    Lease(mrc::data::SharedReusable<mrc::memory::buffer> pooled, std::shared_ptr<Metrics> metrics) :
+      m_bytes(pooled->bytes()),
+      m_pooled(std::move(pooled)),
+      m_metrics(std::move(metrics))
+    {
+        m_metrics->acquire(m_bytes);
+    }
+
+    Lease(mrc::memory::buffer owned, std::shared_ptr<Metrics> metrics) :
+      m_bytes(owned.bytes()),
+      m_owned(std::move(owned)),
+      m_metrics(std::move(metrics))
+    {
+        m_metrics->acquire(m_bytes);
+    }
+
+    ~Lease()
+    {
+        m_metrics->release(m_bytes);
+    }
+
+    DELETE_COPYABILITY(Lease);
+    DELETE_MOVEABILITY(Lease);
+
+    void* data() const
+    {
+        return const_cast<void*>(m_owned.bytes() != 0 ? m_owned.data() : m_pooled->data());
+    }
+
+    std::size_t bytes() const
+    {
+        return m_bytes;
+    }
+
+  private:
+    const std::size_t m_bytes;
+    mrc::data::SharedReusable<mrc::memory::buffer> m_pooled;
+    mrc::memory::buffer m_owned;
+    std::shared_ptr<Metrics> m_metrics;
+};
+
+TransientBuffer::TransientBuffer(void* addr, std::size_t bytes, std::shared_ptr<const void> backing) :
   m_addr(addr),
   m_bytes(bytes),
-  m_buffer(std::move(buffer))
+  m_backing(std::move(backing))
 {}
 
 TransientBuffer::TransientBuffer(void* addr, std::size_t bytes, const TransientBuffer& buffer) :
   m_addr(addr),
   m_bytes(bytes),
-  m_buffer(buffer.m_buffer)
+  m_backing(buffer.m_backing)
 {
     auto* c = static_cast<std::byte*>(addr);
     auto* b = static_cast<std::byte*>(const_cast<void*>(buffer.data()));
@@ -50,14 +124,14 @@ TransientBuffer::~TransientBuffer()
 TransientBuffer::TransientBuffer(TransientBuffer&& other) noexcept :
   m_addr(std::exchange(other.m_addr, nullptr)),
   m_bytes(std::exchange(other.m_bytes, 0UL)),
-  m_buffer(std::move(other.m_buffer))
+  m_backing(std::move(other.m_backing))
 {}
 
 TransientBuffer& TransientBuffer::operator=(TransientBuffer&& other) noexcept
 {
-    m_addr   = std::exchange(other.m_addr, nullptr);
-    m_bytes  = std::exchange(other.m_bytes, 0UL);
-    m_buffer = std::move(other.m_buffer);
+    m_addr    = std::exchange(other.m_addr, nullptr);
+    m_bytes   = std::exchange(other.m_bytes, 0UL);
+    m_backing = std::move(other.m_backing);
     return *this;
 }
 
@@ -82,8 +156,28 @@ void TransientBuffer::release()
     {
         m_addr  = nullptr;
         m_bytes = 0;
-        m_buffer.release();
+        m_backing.reset();
+    }
+}
+
+void* TransientPool::Region::try_bump(std::size_t bytes, std::size_t alignment)
+{
+    void* addr       = m_addr;
+    std::size_t size = m_remaining;
+    if (m_backing == nullptr || std::align(alignment, bytes, addr, size) == nullptr)
+    {
+        return nullptr;
     }
+    m_addr      = static_cast<std::byte*>(addr) + bytes;
+    m_remaining = size - bytes;
+    return addr;
+}
+
+void TransientPool::Region::reset(void* addr, std::size_t bytes, std::shared_ptr<const void> backing)
+{
+    m_addr      = static_cast<std::byte*>(addr);
+    m_remaining = bytes;
+    m_backing   = std::move(backing);
 }
 
 TransientPool::TransientPool(std::size_t block_size,
@@ -91,38 +185,169 @@ TransientPool::TransientPool(std::size_t block_size,
                              std::shared_ptr<mrc::memory::memory_resource> mr,
                              std::size_t capacity) :
   m_block_size(block_size),
-  m_pool(mrc::data::ReusablePool<mrc::memory::buffer>::create(capacity))
+  m_mr(std::move(mr)),
+  m_pool(mrc::data::ReusablePool<mrc::memory::buffer>::create(capacity)),
+  m_metrics(std::make_shared<Metrics>())
 {
     CHECK(m_pool);
+    CHECK(m_mr);
     CHECK_LT(block_count, capacity);
     for (int i = 0; i < block_count; i++)
     {
-        m_pool->emplace(block_size, mr);
+        m_pool->emplace(block_size, m_mr);
+    }
+
+    // a request of a given class always fits into a freshly refilled region of that class
+    m_chunk_sizes  = {block_size / 16, block_size / 4, block_size};
+    m_class_limits = {block_size / 256, block_size / 16, block_size};
+
+    auto shard_count = std::clamp<std::size_t>(std::thread::hardware_concurrency(), 1, 16);
+    for (std::size_t i = 0; i < shard_count; i++)
+    {
+        m_shards.push_back(std::make_unique<Shard>());
     }
 }
 
-TransientBuffer TransientPool::await_buffer(std::size_t bytes)
+TransientPool::~TransientPool() = default;
+
+std::size_t TransientPool::block_size() const
 {
-    if (bytes > m_block_size)  // todo(#54) [[unlikely]]
+    return m_block_size;
+}
+
+std::size_t TransientPool::size_class(std::size_t bytes) const
+{
+    std::size_t size_class = 0;
+    while (bytes > m_class_limits[size_class])
     {
-        LOG(ERROR) << "requesting allocation larger than max_size";
-        throw std::bad_alloc{};
+        ++size_class;
     }
+    return size_class;
+}
+
+TransientPool::Shard& TransientPool::local_shard()
+{
+    auto hash = std::hash<std::thread::id>{}(std::this_thread::get_id());
+    return *m_shards[hash % m_shards.size()];
+}
+
+TransientBuffer TransientPool::await_buffer(std::size_t bytes, std::size_t alignment)
+{
+    CHECK(alignment != 0 && (alignment & (alignment - 1)) == 0) << "alignment must be a power of two";
+
+    // worst case padding is alignment - 1 bytes
+    auto padded = bytes + alignment - 1;
+    if (padded > m_block_size)  // todo(#54) [[unlikely]]
+    {
+        return allocate_large(bytes, alignment);
+    }
+
+    auto size_class = this->size_class(padded);
+    auto& shard     = local_shard();
+
+    std::lock_guard<decltype(shard.m_mutex)> lock(shard.m_mutex);
+    auto& region = shard.m_regions[size_class];
+
+    void* addr = region.try_bump(bytes, alignment);
+    if (addr == nullptr)
+    {
+        refill(size_class, region);
+        addr = region.try_bump(bytes, alignment);
+        CHECK(addr);
+    }
+
+    shard.m_allocations++;
+    shard.m_allocated_bytes += bytes;
+
+    return {addr, bytes, region.m_backing};
+}
+
+void TransientPool::refill(std::size_t size_class, Region& region)
+{
+    // drop the reference to the exhausted region first so its block can return to the pool
+    region.reset(nullptr, 0, nullptr);
+
+    if (size_class == SizeClassCount - 1)
+    {
+        acquire_block(region);
+        return;
+    }
+
+    const auto chunk_size = m_chunk_sizes[size_class];
+
+    std::lock_guard<decltype(m_carver_mutex)> lock(m_carver_mutex);
+    auto& carver = m_carvers[size_class];
+
+    void* addr = carver.try_bump(chunk_size, 1);
+    if (addr == nullptr)
+    {
+        carver.reset(nullptr, 0, nullptr);
+        acquire_block(carver);
+        addr = carver.try_bump(chunk_size, 1);
+        CHECK(addr);
+    }
+    region.reset(addr, chunk_size, carver.m_backing);
+}
+
+void TransientPool::acquire_block(Region& region)
+{
+    std::shared_ptr<Lease> lease;
+
+    mrc::data::Reusable<mrc::memory::buffer> item;
+    if (m_pool->try_item(item))
+    {
+        lease = std::make_shared<Lease>(mrc::data::SharedReusable<mrc::memory::buffer>(std::move(item)),
+                                                 m_metrics);
+    }
+    else
+    {
+        // every pooled block is still referenced; growing is preferred over blocking the caller
+        m_metrics->overflow_blocks.fetch_add(1, std::memory_order_relaxed);
+        lease = std::make_shared<Lease>(mrc::memory::buffer(m_block_size, m_mr), m_metrics);
+    }
+
+    auto* addr = lease->data();
+    auto bytes = lease->bytes();
+    region.reset(addr, bytes, std::move(lease));
+}
+
+TransientBuffer TransientPool::allocate_large(std::size_t bytes, std::size_t alignment)
+{
+    m_metrics->large_allocations.fetch_add(1, std::memory_order_relaxed);
+
+    auto lease = std::make_shared<Lease>(mrc::memory::buffer(bytes + alignment - 1, m_mr), m_metrics);
+
+    void* addr       = lease->data();
+    std::size_t size = lease->bytes();
+    CHECK(std::align(alignment, bytes, addr, size));
+
+    {
+        auto& shard = local_shard();
+        std::lock_guard<decltype(shard.m_mutex)> lock(shard.m_mutex);
+        shard.m_allocations++;
+        shard.m_allocated_bytes += bytes;
+    }
+
+    return {addr, bytes, std::move(lease)};
+}
+
+TransientPoolStats TransientPool::stats() const
+{
+    TransientPoolStats stats;
 
-    if (m_remaining < bytes)
+    for (const auto& shard : m_shards)
     {
-        auto buffer = m_pool->await_item();
-        m_addr      = static_cast<std::byte*>(buffer->data());
-        m_remaining = buffer->bytes();
-        m_buffer    = std::move(buffer);
+        std::lock_guard<decltype(shard->m_mutex)> lock(shard->m_mutex);
+        stats.allocations += shard->m_allocations;
+        stats.allocated_bytes += shard->m_allocated_bytes;
     }
 
-    // align + bytes
-    void* addr = m_addr;
-    m_addr += bytes;
-    m_remaining -= bytes;
+    stats.large_allocations = m_metrics->large_allocations.load(std::memory_order_relaxed);
+    stats.overflow_blocks   = m_metrics->overflow_blocks.load(std::memory_order_relaxed);
+    stats.bytes_in_use      = m_metrics->bytes_in_use.load(std::memory_order_relaxed);
+    stats.high_water_bytes  = m_metrics->high_water_bytes.load(std::memory_order_relaxed);
 
-    return {addr, bytes, m_buffer};
+    return stats;
 }
 
 }  // namespace mrc::internal::memory
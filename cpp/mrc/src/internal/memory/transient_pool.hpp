@@ -23,10 +23,13 @@
 
 #include <glog/logging.h>
 
+#include <array>
 #include <cstddef>
 #include <memory>
+#include <mutex>
 #include <new>
 #include <utility>
+#include <vector>
 
 namespace mrc::memory {
 struct memory_resource;
@@ -35,7 +38,7 @@ struct memory_resource;
 namespace mrc::internal::memory {
 
 /**
- * @brief A short-lived buffer based on a portion of a data::SharedResable<memory::buffer>
+ * @brief A short-lived buffer based on a portion of a block owned by a TransientPool
  *
  * @see TransientPool for more details.
  */
@@ -48,9 +51,9 @@ class TransientBuffer
      *
      * @param addr - starting address of the buffer
      * @param bytes - number of bytes allocated to this buffer starting at addr
-     * @param buffer - reference counted holder to the SharedReusable, this is held for reference counting only
+     * @param backing - reference counted holder of the memory backing addr, this is held for reference counting only
      */
-    TransientBuffer(void* addr, std::size_t bytes, mrc::data::SharedReusable<mrc::memory::buffer> buffer);
+    TransientBuffer(void* addr, std::size_t bytes, std::shared_ptr<const void> backing);
     TransientBuffer(void* addr, std::size_t bytes, const TransientBuffer& buffer);
 
     TransientBuffer() = default;
@@ -80,7 +83,7 @@ class TransientBuffer
   private:
     void* m_addr{nullptr};
     std::size_t m_bytes{0};
-    mrc::data::SharedReusable<mrc::memory::buffer> m_buffer;
+    std::shared_ptr<const void> m_backing;
 };
 
 /**
@@ -96,7 +99,7 @@ class Transient final : private TransientBuffer
     template <typename... ArgsT>
     Transient(TransientBuffer&& buffer, ArgsT&&... args) : TransientBuffer(std::move(buffer))
     {
-        CHECK_LE(sizeof(T) + alignof(T), bytes());
+        CHECK_LE(sizeof(T), bytes());
         void* addr       = data();
         std::size_t size = bytes();
         CHECK(std::align(alignof(T), sizeof(T), addr, size));
@@ -151,17 +154,43 @@ class Transient final : private TransientBuffer
     T* m_data;
 };
 
+/**
+ * @brief Snapshot of the counters of a TransientPool
+ */
+struct TransientPoolStats
+{
+    /// number of buffers handed out
+    std::size_t allocations{0};
+    /// number of bytes handed out, excluding alignment padding
+    std::size_t allocated_bytes{0};
+    /// number of requests larger than a block which were served directly by the memory resource
+    std::size_t large_allocations{0};
+    /// number of blocks allocated from the memory resource because every pooled block was in flight
+    std::size_t overflow_blocks{0};
+    /// bytes of blocks and large allocations currently held by live buffers or by the bump regions
+    std::size_t bytes_in_use{0};
+    /// maximum value bytes_in_use has reached
+    std::size_t high_water_bytes{0};
+};
+
 /**
  * @brief ReusablePool of memory::buffers that are used as reusable reference-counted monotonic memory resources
  *
  * TransientPool is a ReusablePool of memory::buffers from which smaller buffers are allocated similar to a monotonic
  * memory resource, i.e. pointer pushing stack; however the TransientBuffer or Transient<T> object pull from the pool
- * hold a SharedReusable<memory::buffer> which keeps the entire monotonic stack from returning to the resuable pool
- * until all objects created on a given stack are deallocated.
+ * hold a reference to their block which keeps the entire monotonic stack from returning to the resuable pool until all
+ * objects created on a given stack are deallocated.
  *
  * Allocation of Transisent object should be incredibly fast; even faster than the Reusable/SharedResuable on which they
  * are based, since a single Reusable<memory::buffer> might back 10s-1000s of allocations dependending on size.
  *
+ * The pool is safe to use from multiple threads. Each thread bumps into the regions of its own shard, chosen by
+ * hashing the thread id, so concurrent callers only contend when they hash to the same shard. Every shard keeps one
+ * region per size class: small and medium requests are bumped from chunks carved out of a shared block, while
+ * requests up to a full block are bumped from a region which owns a whole block, so small objects do not pin large
+ * blocks and vice versa. Requests larger than a block are allocated directly from the memory resource, as are
+ * additional blocks when every pooled block is still in flight; neither path blocks the caller.
+ *
  * It is critical that all Transient object allocated from a pool have similar life cycles
  */
 class TransientPool
@@ -172,20 +201,24 @@ class TransientPool
                   std::shared_ptr<mrc::memory::memory_resource> mr,
                   std::size_t capacity = 64);
 
+    ~TransientPool();
+
+    DELETE_COPYABILITY(TransientPool);
+    DELETE_MOVEABILITY(TransientPool);
+
     /**
-     * @brief Acquire a TransientBuffer of size bytes.
+     * @brief Acquire a TransientBuffer of size bytes whose starting address is a multiple of alignment.
      *
-     * Acquiring this object may block and yield the calling fiber.
+     * Acquiring this object never blocks; the memory resource is used directly when the pool is exhausted.
      *
      * @param bytes
+     * @param alignment - must be a power of two
      * @return TransientBuffer
      */
-    TransientBuffer await_buffer(std::size_t bytes);
+    TransientBuffer await_buffer(std::size_t bytes, std::size_t alignment = alignof(std::max_align_t));
 
     /**
-     * @brief Acquire a Transient<T> constructed from a TransientBuffer.
-     *
-     * Acquiring this object may block and yield the calling fiber.
+     * @brief Acquire a Transient<T> constructed from a TransientBuffer aligned for T.
      *
      * @tparam T
      * @return Transient<T>
@@ -193,16 +226,63 @@ class TransientPool
     template <typename T, typename... ArgsT>
     Transient<T> await_object(ArgsT&&... args)
     {
-        auto buffer = await_buffer(sizeof(T) + alignof(T));
+        auto buffer = await_buffer(sizeof(T), alignof(T));
         return Transient<T>(std::move(buffer), std::forward<ArgsT>(args)...);
     }
 
+    /**
+     * @brief Size in bytes of the pooled blocks; larger requests bypass the pool
+     */
+    std::size_t block_size() const;
+
+    TransientPoolStats stats() const;
+
   private:
+    struct Metrics;
+    class Lease;
+
+    // small and medium requests are bumped from chunks of a block, large requests from a whole block
+    static constexpr std::size_t SizeClassCount = 3;
+
+    struct Region
+    {
+        void* try_bump(std::size_t bytes, std::size_t alignment);
+        void reset(void* addr, std::size_t bytes, std::shared_ptr<const void> backing);
+
+        std::byte* m_addr{nullptr};
+        std::size_t m_remaining{0};
+        std::shared_ptr<const void> m_backing;
+    };
+
+    struct alignas(64) Shard
+    {
+        std::mutex m_mutex;
+        std::array<Region, SizeClassCount> m_regions;
+        std::size_t m_allocations{0};
+        std::size_t m_allocated_bytes{0};
+    };
+
+    std::size_t size_class(std::size_t bytes) const;
+    Shard& local_shard();
+
+    void refill(std::size_t size_class, Region& region);
+    void acquire_block(Region& region);
+    TransientBuffer allocate_large(std::size_t bytes, std::size_t alignment);
+
     const std::size_t m_block_size;
+    const std::shared_ptr<mrc::memory::memory_resource> m_mr;
     const std::shared_ptr<mrc::data::ReusablePool<mrc::memory::buffer>> m_pool;
-    std::byte* m_addr{nullptr};
-    std::size_t m_remaining{0};
-    mrc::data::SharedReusable<mrc::memory::buffer> m_buffer;
+    const std::shared_ptr<Metrics> m_metrics;
+
+    // upper bound of a request and size of the region refill of each size class
+    std::array<std::size_t, SizeClassCount> m_class_limits;
+    std::array<std::size_t, SizeClassCount> m_chunk_sizes;
+
+    std::vector<std::unique_ptr<Shard>> m_shards;
+
+    // blocks shared by all shards from which the small and medium chunks are carved
+    std::mutex m_carver_mutex;
+    std::array<Region, SizeClassCount> m_carvers;
 };
 
 }  // namespace mrc::internal::memory
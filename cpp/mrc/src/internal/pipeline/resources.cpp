@@ -17,16 +17,66 @@
 
 #include "internal/pipeline/resources.hpp"
 
+#include "internal/memory/arena_metrics.hpp"
+#include "internal/memory/device_resources.hpp"
+#include "internal/memory/host_resources.hpp"
+#include "internal/resources/manager.hpp"
+#include "internal/resources/partition_resources.hpp"
+#include "internal/system/partition.hpp"
+#include "internal/system/system.hpp"
+
+#include "mrc/metrics/exporter.hpp"
 #include "mrc/metrics/registry.hpp"
+#include "mrc/options/metrics.hpp"
+#include "mrc/options/options.hpp"
 
 #include <glog/logging.h>
 
+#include <cstddef>
+#include <string>
+
 namespace mrc::internal::pipeline {
 
 Resources::Resources(resources::Manager& resources) :
   m_resources(resources),
   m_metrics_registry(std::make_unique<metrics::Registry>())
-{}
+{
+    // host resources are shared by the partitions of a host partition, so their gauges are registered once per host
+    // partition; registering the same labels again replaces the gauge
+    for (std::size_t i = 0; i < m_resources.partition_count(); ++i)
+    {
+        auto& partition = m_resources.partition(i);
+        memory::register_arena_metrics(
+            *m_metrics_registry,
+            {{"memory", "host"}, {"partition", std::to_string(partition.partition().host_partition_id())}},
+            partition.host().arena_memory_resource());
+
+        if (partition.device())
+        {
+            memory::register_arena_metrics(*m_metrics_registry,
+                                           {{"memory", "device"}, {"partition", std::to_string(i)}},
+                                           partition.device()->arena_memory_resource());
+        }
+    }
+
+    const auto& options = m_resources.system().options().metrics();
+
+    if (options.export_port() == 0 && options.export_path().empty())
+    {
+        return;
+    }
+
+    m_metrics_exporter = std::make_unique<metrics::Exporter>(*m_metrics_registry);
+
+    if (options.export_port() != 0)
+    {
+        m_metrics_exporter->serve(options.export_address(), options.export_port());
+    }
+    if (!options.export_path().empty())
+    {
+        m_metrics_exporter->write_periodically(options.export_path(), options.export_interval());
+    }
+}
 
 Resources::~Resources() = default;
 
@@ -20,6 +20,7 @@
 #include <memory>
 
 namespace mrc::metrics {
+class Exporter;
 class Registry;
 }  // namespace mrc::metrics
 
@@ -41,6 +42,9 @@ class Resources
   private:
     resources::Manager& m_resources;
     std::unique_ptr<metrics::Registry> m_metrics_registry;
+
+    // publishes the registry when an export port or path is configured; declared last so it is stopped first
+    std::unique_ptr<metrics::Exporter> m_metrics_exporter;
 };
 
 }  // namespace mrc::internal::pipeline
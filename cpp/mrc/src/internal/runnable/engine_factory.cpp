@@ -25,6 +25,7 @@
 
 #include "mrc/constants.hpp"
 #include "mrc/core/bitmap.hpp"
+#include "mrc/core/fiber_meta_data.hpp"
 #include "mrc/exceptions/runtime_error.hpp"
 #include "mrc/runnable/engine_factory.hpp"
 #include "mrc/runnable/launch_options.hpp"
@@ -55,9 +56,11 @@ class FiberEngineFactory : public ::mrc::runnable::EngineFactory
     std::shared_ptr<::mrc::runnable::Engines> build_engines(const LaunchOptions& launch_options) final
     {
         std::lock_guard<decltype(m_mutex)> lock(m_mutex);
-        return std::make_shared<FiberEngines>(launch_options,
-                                              get_next_n_queues(launch_options.pe_count),
-                                              MRC_DEFAULT_FIBER_PRIORITY);
+
+        FiberMetaData meta{MRC_DEFAULT_FIBER_PRIORITY};
+        meta.steal_group = steal_group();
+
+        return std::make_shared<FiberEngines>(launch_options, get_next_n_queues(launch_options.pe_count), meta);
     }
 
     ::mrc::runnable::EngineType backend() const final
@@ -67,6 +70,13 @@ class FiberEngineFactory : public ::mrc::runnable::EngineFactory
 
   private:
     virtual std::vector<std::reference_wrapper<core::FiberTaskQueue>> get_next_n_queues(std::size_t count) = 0;
+
+    // steal group of the factory's pool, if engine fibers may migrate between its threads
+    virtual std::uint32_t steal_group() const
+    {
+        return 0;
+    }
+
     std::mutex m_mutex;
 };
 
@@ -77,7 +87,7 @@ class ReusableFiberEngineFactory final : public FiberEngineFactory
 {
   public:
     ReusableFiberEngineFactory(const system::Resources& system_resources, const CpuSet& cpu_set) :
-      m_pool(system_resources.make_fiber_pool(cpu_set))
+      m_pool(system_resources.make_fiber_pool(cpu_set, true))
     {}
     ~ReusableFiberEngineFactory() final = default;
 
@@ -95,6 +105,13 @@ class ReusableFiberEngineFactory final : public FiberEngineFactory
     }
 
   private:
+    // engines share the threads of a reusable pool, so they are allowed to balance across them; dedicated
+    // (single use) pools keep each engine on its own thread
+    std::uint32_t steal_group() const final
+    {
+        return m_pool.steal_group();
+    }
+
     std::size_t next()
     {
         auto n = m_offset++;
@@ -49,6 +49,10 @@ class FiberEngines final : public Engines
 
     FiberEngines(::mrc::runnable::LaunchOptions launch_options, system::FiberPool& pool, const FiberMetaData& meta);
 
+    FiberEngines(::mrc::runnable::LaunchOptions launch_options,
+                 std::vector<std::reference_wrapper<core::FiberTaskQueue>>&& task_queues,
+                 const FiberMetaData& meta);
+
     FiberEngines(::mrc::runnable::LaunchOptions launch_options,
                  std::vector<std::reference_wrapper<core::FiberTaskQueue>>&& task_queues,
                  int priority = MRC_DEFAULT_FIBER_PRIORITY);
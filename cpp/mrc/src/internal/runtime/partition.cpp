@@ -18,6 +18,7 @@
 #include "internal/runtime/partition.hpp"
 
 #include "internal/codable/codable_storage.hpp"
+#include "internal/codable/flat_storage.hpp"
 #include "internal/network/resources.hpp"
 #include "internal/pubsub/publisher_round_robin.hpp"
 #include "internal/pubsub/subscriber_service.hpp"
@@ -84,4 +85,15 @@ std::unique_ptr<mrc::codable::ICodableStorage> Partition::make_codable_storage()
     return std::make_unique<codable::CodableStorage>(m_resources);
 }
 
+std::unique_ptr<mrc::codable::IFlatCodableStorage> Partition::make_flat_codable_storage()
+{
+    return std::make_unique<codable::FlatCodableStorage>(m_resources);
+}
+
+std::unique_ptr<mrc::codable::IDecodableStorage> Partition::make_flat_decodable_storage(
+    mrc::memory::const_buffer_view encoded)
+{
+    return std::make_unique<codable::FlatDecodableStorage>(encoded, m_resources);
+}
+
 }  // namespace mrc::internal::runtime
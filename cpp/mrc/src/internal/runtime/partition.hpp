@@ -26,7 +26,9 @@
 #include <string>
 
 namespace mrc::codable {
+class IDecodableStorage;
 struct ICodableStorage;
+struct IFlatCodableStorage;
 }  // namespace mrc::codable
 namespace mrc::internal::resources {
 class PartitionResources;
@@ -55,6 +57,11 @@ class Partition final : public mrc::runtime::IPartition
 
     std::unique_ptr<mrc::codable::ICodableStorage> make_codable_storage() final;
 
+    std::unique_ptr<mrc::codable::IFlatCodableStorage> make_flat_codable_storage() final;
+
+    std::unique_ptr<mrc::codable::IDecodableStorage> make_flat_decodable_storage(
+        mrc::memory::const_buffer_view encoded) final;
+
   private:
     std::shared_ptr<mrc::pubsub::IPublisherService> make_publisher_service(
         const std::string& name,
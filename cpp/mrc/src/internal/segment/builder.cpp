@@ -18,13 +18,21 @@
 #include "internal/segment/builder.hpp"
 
 #include "internal/pipeline/resources.hpp"
+#include "internal/resources/manager.hpp"
 #include "internal/segment/definition.hpp"
+#include "internal/segment/placement.hpp"
+#include "internal/system/system.hpp"
 
 #include "mrc/core/addresses.hpp"
 #include "mrc/engine/segment/ibuilder.hpp"
 #include "mrc/exceptions/runtime_error.hpp"
 #include "mrc/metrics/counter.hpp"
+#include "mrc/metrics/node_metrics.hpp"
 #include "mrc/metrics/registry.hpp"
+#include "mrc/options/engine_groups.hpp"
+#include "mrc/options/metrics.hpp"
+#include "mrc/options/options.hpp"
+#include "mrc/runnable/launch_options.hpp"
 #include "mrc/segment/egress_port.hpp"   // IWYU pragma: keep
 #include "mrc/segment/ingress_port.hpp"  // IWYU pragma: keep
 #include "mrc/segment/initializers.hpp"
@@ -33,18 +41,33 @@
 #include <glog/logging.h>
 
 #include <exception>
+#include <map>
+#include <memory>
 #include <ostream>
+#include <string>
 #include <utility>
+#include <vector>
 
 namespace mrc::internal::segment {
 
+namespace {
+
+bool is_single_engine(const runnable::LaunchOptions& options)
+{
+    // an elastic runnable may run more instances than it was launched with
+    return options.pe_count == 1 && options.engines_per_pe == 1 && options.max_instances <= 1;
+}
+
+}  // namespace
+
 Builder::Builder(std::shared_ptr<const Definition> segdef,
                  SegmentRank rank,
                  pipeline::Resources& resources,
                  std::size_t default_partition_id) :
   m_definition(std::move(segdef)),
   m_resources(resources),
-  m_default_partition_id(default_partition_id)
+  m_default_partition_id(default_partition_id),
+  m_rank(rank)
 {
     auto address = segment_address_encode(definition().id(), rank);
 
@@ -79,6 +102,13 @@ Builder::Builder(std::shared_ptr<const Definition> segdef,
         // Rethrow after logging
         std::rethrow_exception(std::current_exception());
     }
+
+    resolve_placements();
+
+    if (m_resources.resources().system().options().engine_factories().fuse_operator_chains())
+    {
+        fuse_operator_chains();
+    }
 }
 
 const std::string& Builder::name() const
@@ -163,6 +193,102 @@ const std::map<std::string, std::shared_ptr<mrc::runnable::Launchable>>& Builder
 {
     return m_nodes;
 }
+const std::map<std::string, std::string>& Builder::fused_nodes() const
+{
+    return m_fused_nodes;
+}
+
+std::size_t Builder::launch_partition(const std::string& name) const
+{
+    auto search = m_objects.find(name);
+    CHECK(search != m_objects.end()) << "unable to find segment object with name " << name;
+    return search->second->launch_partition().value_or(m_default_partition_id);
+}
+
+void Builder::resolve_placements()
+{
+    const auto& partitions = m_resources.resources().system().partitions();
+
+    for (const auto& [name, object] : m_objects)
+    {
+        if (!object->is_runnable())
+        {
+            object->set_launch_partition(m_default_partition_id);
+            continue;
+        }
+
+        const auto partition_id = resolve_placement(object->launch_options().placement,
+                                                    partitions,
+                                                    m_default_partition_id);
+        if (partition_id != m_default_partition_id)
+        {
+            DVLOG(10) << "segment " << this->name() << ": placing " << name << " on partition " << partition_id;
+        }
+        object->set_launch_partition(partition_id);
+    }
+}
+
+void Builder::fuse_operator_chains()
+{
+    // map the objects of the launchable nodes back to their names; ports are not nodes and never take part in fusion
+    std::map<const ::mrc::segment::ObjectProperties*, std::string> node_names;
+    for (const auto& [name, node] : m_nodes)
+    {
+        node_names[m_objects.at(name).get()] = name;
+    }
+
+    // a node which absorbed its downstream may itself be fused into its upstream, in which case the whole chain is
+    // executed by the head of the chain
+    auto host_of = [this](std::string name) {
+        for (auto search = m_fused_nodes.find(name); search != m_fused_nodes.end(); search = m_fused_nodes.find(name))
+        {
+            name = search->second;
+        }
+        return name;
+    };
+
+    // map iteration order is not topological; chains are resolved through host_of once all links are fused
+    std::vector<std::string> fused;
+    for (const auto& [name, node] : m_nodes)
+    {
+        auto& object = *m_objects.at(name);
+        if (!object.is_fusible() || !is_single_engine(object.launch_options()))
+        {
+            continue;
+        }
+
+        auto upstreams = object.upstreams();
+        if (upstreams.size() != 1)
+        {
+            continue;
+        }
+
+        const auto& upstream = *upstreams[0];
+        auto upstream_name   = node_names.find(&upstream);
+        if (upstream_name == node_names.end() || !is_single_engine(upstream.launch_options()) ||
+            upstream.launch_options().engine_factory_name != object.launch_options().engine_factory_name ||
+            upstream.launch_partition() != object.launch_partition())
+        {
+            continue;
+        }
+
+        // fails if other writers share the input edge, e.g. edges formed outside of the segment builder
+        if (!object.fuse_with_upstream())
+        {
+            continue;
+        }
+
+        m_fused_nodes[name] = upstream_name->second;
+        fused.push_back(name);
+    }
+
+    for (const auto& name : fused)
+    {
+        DVLOG(10) << "segment " << this->name() << ": fused node " << name << " into " << host_of(name);
+        m_nodes.erase(name);
+    }
+}
+
 std::function<void(std::int64_t)> Builder::make_throughput_counter(const std::string& name)
 {
     auto counter = m_resources.metrics_registry().make_throughput_counter(name);
@@ -170,4 +296,16 @@ std::function<void(std::int64_t)> Builder::make_throughput_counter(const std::st
         counter.increment(ticks);
     };
 }
+
+std::shared_ptr<metrics::NodeMetrics> Builder::make_node_metrics(const std::string& name)
+{
+    if (!m_resources.resources().system().options().metrics().node_metrics())
+    {
+        return nullptr;
+    }
+
+    return std::make_shared<metrics::NodeMetrics>(
+        m_resources.metrics_registry(),
+        metrics::Registry::labels_t{{"segment", this->name()}, {"rank", std::to_string(m_rank)}, {"node", name}});
+}
 }  // namespace mrc::internal::segment
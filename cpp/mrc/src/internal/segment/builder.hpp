@@ -29,6 +29,9 @@
 namespace mrc::internal::pipeline {
 class Resources;
 }  // namespace mrc::internal::pipeline
+namespace mrc::metrics {
+class NodeMetrics;
+}  // namespace mrc::metrics
 namespace mrc::runnable {
 struct Launchable;
 }  // namespace mrc::runnable
@@ -56,6 +59,12 @@ class Builder final
     const std::map<std::string, std::shared_ptr<mrc::segment::EgressPortBase>>& egress_ports() const;
     const std::map<std::string, std::shared_ptr<mrc::segment::IngressPortBase>>& ingress_ports() const;
 
+    // nodes fused into an upstream runnable, mapped to the name of that upstream
+    const std::map<std::string, std::string>& fused_nodes() const;
+
+    // partition a node or port is launched on, as resolved from the placement hint of its launch options
+    std::size_t launch_partition(const std::string& name) const;
+
   private:
     const std::string& name() const;
 
@@ -68,9 +77,18 @@ class Builder final
     std::shared_ptr<::mrc::segment::IngressPortBase> get_ingress_base(const std::string& name);
     std::shared_ptr<::mrc::segment::EgressPortBase> get_egress_base(const std::string& name);
 
+    // assigns every object the partition it is launched on; see runnable::LaunchOptions::placement
+    void resolve_placements();
+
+    // runs downstream RxNodes inline in the runnable of their upstream node; see EngineGroups::set_fuse_operator_chains
+    void fuse_operator_chains();
+
     // temporary metrics interface
     std::function<void(std::int64_t)> make_throughput_counter(const std::string& name);
 
+    // null if node metrics are disabled in the options
+    std::shared_ptr<metrics::NodeMetrics> make_node_metrics(const std::string& name);
+
     // definition
     std::shared_ptr<const Definition> m_definition;
 
@@ -80,12 +98,16 @@ class Builder final
     // only runnables
     std::map<std::string, std::shared_ptr<mrc::runnable::Launchable>> m_nodes;
 
+    // runnables removed from m_nodes by fuse_operator_chains
+    std::map<std::string, std::string> m_fused_nodes;
+
     // ingress/egress - these are also nodes/objects
     std::map<std::string, std::shared_ptr<::mrc::segment::IngressPortBase>> m_ingress_ports;
     std::map<std::string, std::shared_ptr<::mrc::segment::EgressPortBase>> m_egress_ports;
 
     pipeline::Resources& m_resources;
     const std::size_t m_default_partition_id;
+    const SegmentRank m_rank;
 
     friend IBuilder;
 };
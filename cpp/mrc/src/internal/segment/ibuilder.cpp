@@ -19,6 +19,8 @@
 
 #include "internal/segment/builder.hpp"
 
+#include "mrc/metrics/node_metrics.hpp"
+
 #include <glog/logging.h>
 
 #include <utility>
@@ -80,4 +82,10 @@ std::function<void(std::int64_t)> IBuilder::make_throughput_counter(const std::s
     return m_impl->make_throughput_counter(name);
 }
 
+std::shared_ptr<metrics::NodeMetrics> IBuilder::make_node_metrics(const std::string& name)
+{
+    CHECK(m_impl);
+    return m_impl->make_node_metrics(name);
+}
+
 }  // namespace mrc::internal::segment
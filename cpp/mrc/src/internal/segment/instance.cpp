@@ -114,27 +114,36 @@ void Instance::do_service_start()
         });
     };
 
+    // each launcher is prepared on the main thread of the partition it launches on, so channel buffers allocated while
+    // preparing it, e.g. for edges crossing partitions, are first touched on the numa node of that partition
+    auto prepare_launcher = [this](mrc::runnable::Launchable& launchable, const std::string& name) {
+        auto& runnable = m_resources.resources().partition(m_builder->launch_partition(name)).runnable();
+        return runnable.main()
+            .enqueue([&launchable, &runnable] {
+                return launchable.prepare_launcher(runnable.launch_control());
+            })
+            .get();
+    };
+
     for (const auto& [name, node] : m_builder->nodes())
     {
-        DVLOG(10) << info() << " constructing launcher for " << name;
-        m_launchers[name] = node->prepare_launcher(
-            m_resources.resources().partition(m_default_partition_id).runnable().launch_control());
+        DVLOG(10) << info() << " constructing launcher for " << name << " on partition "
+                  << m_builder->launch_partition(name);
+        m_launchers[name] = prepare_launcher(*node, name);
         apply_callback(m_launchers[name], name);
     }
 
     for (const auto& [name, node] : m_builder->egress_ports())
     {
         DVLOG(10) << info() << " constructing launcher egress port " << name;
-        m_egress_launchers[name] = node->prepare_launcher(
-            m_resources.resources().partition(m_default_partition_id).runnable().launch_control());
+        m_egress_launchers[name] = prepare_launcher(*node, name);
         apply_callback(m_egress_launchers[name], name);
     }
 
     for (const auto& [name, node] : m_builder->ingress_ports())
     {
         DVLOG(10) << info() << " constructing launcher ingress port " << name;
-        m_ingress_launchers[name] = node->prepare_launcher(
-            m_resources.resources().partition(m_default_partition_id).runnable().launch_control());
+        m_ingress_launchers[name] = prepare_launcher(*node, name);
         apply_callback(m_ingress_launchers[name], name);
     }
 
@@ -308,14 +317,16 @@ std::shared_ptr<manifold::Interface> Instance::create_manifold(const PortName& n
         auto search = m_builder->egress_ports().find(name);
         if (search != m_builder->egress_ports().end())
         {
-            return search->second->make_manifold(m_resources.resources().partition(m_default_partition_id).runnable());
+            return search->second->make_manifold(
+                m_resources.resources().partition(m_builder->launch_partition(name)).runnable());
         }
     }
     {
         auto search = m_builder->ingress_ports().find(name);
         if (search != m_builder->ingress_ports().end())
         {
-            return search->second->make_manifold(m_resources.resources().partition(m_default_partition_id).runnable());
+            return search->second->make_manifold(
+                m_resources.resources().partition(m_builder->launch_partition(name)).runnable());
         }
     }
     LOG(FATAL) << info() << " unable to match ingress or egress port name";
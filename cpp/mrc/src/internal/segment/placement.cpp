@@ -0,0 +1,104 @@
+/**
+ * SPDX-FileCopyrightText: Copyright (c) 2022-2023, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "internal/segment/placement.hpp"
+
+#include "internal/system/host_partition.hpp"
+#include "internal/system/partition.hpp"
+#include "internal/system/partitions.hpp"
+
+#include "mrc/core/bitmap.hpp"
+
+#include <glog/logging.h>
+
+#include <ostream>
+#include <variant>
+#include <vector>
+
+namespace mrc::internal::segment {
+
+std::size_t resolve_placement(const runnable::placement_hint_t& hint,
+                              const system::Partitions& partitions,
+                              std::size_t default_partition_id)
+{
+    const auto& flattened = partitions.flattened();
+    DCHECK_LT(default_partition_id, flattened.size());
+
+    if (const auto* placement = std::get_if<runnable::PartitionPlacement>(&hint))
+    {
+        if (placement->partition_id < flattened.size())
+        {
+            return placement->partition_id;
+        }
+        LOG(WARNING) << "placement on partition " << placement->partition_id << " requested, but only "
+                     << flattened.size() << " partitions exist; using partition " << default_partition_id;
+        return default_partition_id;
+    }
+
+    if (const auto* placement = std::get_if<runnable::NumaNodePlacement>(&hint))
+    {
+        auto on_node = [&](std::size_t partition_id) {
+            return flattened[partition_id].host().numa_set().is_set(static_cast<int>(placement->numa_id));
+        };
+
+        if (on_node(default_partition_id))
+        {
+            return default_partition_id;
+        }
+        for (std::size_t partition_id = 0; partition_id < flattened.size(); ++partition_id)
+        {
+            if (on_node(partition_id))
+            {
+                return partition_id;
+            }
+        }
+        LOG(WARNING) << "placement on numa node " << placement->numa_id
+                     << " requested, but no partition is on that node; using partition " << default_partition_id;
+        return default_partition_id;
+    }
+
+    if (const auto* placement = std::get_if<runnable::CpuSetPlacement>(&hint))
+    {
+        auto overlap = [&](std::size_t partition_id) {
+            return flattened[partition_id].host().cpu_set().set_intersect(placement->cpu_set).weight();
+        };
+
+        auto best         = default_partition_id;
+        auto best_overlap = overlap(default_partition_id);
+        for (std::size_t partition_id = 0; partition_id < flattened.size(); ++partition_id)
+        {
+            const auto partition_overlap = overlap(partition_id);
+            if (partition_overlap > best_overlap)
+            {
+                best         = partition_id;
+                best_overlap = partition_overlap;
+            }
+        }
+
+        if (best_overlap > 0)
+        {
+            return best;
+        }
+        LOG(WARNING) << "placement on cpus " << placement->cpu_set.str()
+                     << " requested, but no partition shares a cpu with them; using partition " << default_partition_id;
+        return default_partition_id;
+    }
+
+    return default_partition_id;
+}
+
+}  // namespace mrc::internal::segment
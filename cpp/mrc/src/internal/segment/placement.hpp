@@ -0,0 +1,41 @@
+/**
+ * SPDX-FileCopyrightText: Copyright (c) 2022-2023, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include "mrc/runnable/launch_options.hpp"
+
+#include <cstddef>
+
+namespace mrc::internal::system {
+class Partitions;
+}  // namespace mrc::internal::system
+
+namespace mrc::internal::segment {
+
+/**
+ * @brief Resolve the placement hint of a segment object to the id of the partition it is launched on.
+ *
+ * A NUMA node hint prefers default_partition_id if that partition is on the node, then the first partition on the node.
+ * A CpuSet hint picks the partition sharing the most cpus with the set, preferring default_partition_id on ties. Hints
+ * which no partition satisfies resolve to default_partition_id with a warning.
+ */
+std::size_t resolve_placement(const runnable::placement_hint_t& hint,
+                              const system::Partitions& partitions,
+                              std::size_t default_partition_id);
+
+}  // namespace mrc::internal::segment
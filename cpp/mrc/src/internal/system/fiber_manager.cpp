@@ -18,6 +18,7 @@
 #include "internal/system/fiber_manager.hpp"
 
 #include "internal/system/fiber_pool.hpp"
+#include "internal/system/fiber_work_stealing_scheduler.hpp"
 #include "internal/system/resources.hpp"
 #include "internal/system/system.hpp"
 #include "internal/system/topology.hpp"
@@ -27,12 +28,21 @@
 #include "mrc/options/fiber_pool.hpp"
 #include "mrc/options/options.hpp"
 
+#include <boost/smart_ptr/intrusive_ptr.hpp>
+
+#include <cstddef>
+#include <cstdint>
 #include <functional>
 #include <memory>
+#include <mutex>
+#include <utility>
+#include <vector>
 
 namespace mrc::internal::system {
 
-FiberManager::FiberManager(const Resources& resources) : m_cpu_set(resources.system().topology().cpu_set())
+FiberManager::FiberManager(const Resources& resources) :
+  m_cpu_set(resources.system().topology().cpu_set()),
+  m_work_stealing(resources.system().options().fiber_pool().enable_work_stealing())
 {
     auto cpu_count       = m_cpu_set.weight();
     const auto& options  = resources.system().options();
@@ -41,10 +51,16 @@ FiberManager::FiberManager(const Resources& resources) : m_cpu_set(resources.sys
     VLOG(1) << "creating fiber task queues on " << cpu_count << " threads";
     VLOG(1) << "thread_binding : " << (options.fiber_pool().enable_thread_binding() ? " TRUE" : "FALSE");
     VLOG(1) << "memory_binding : " << (options.fiber_pool().enable_memory_binding() ? " TRUE" : "FALSE");
+    VLOG(1) << "work_stealing  : " << (m_work_stealing ? " TRUE" : "FALSE");
+
+    for (std::uint32_t i = 0; i < topology.numa_count(); ++i)
+    {
+        m_numa_cpu_sets.push_back(topology.numa_cpuset(i));
+    }
 
     topology.cpu_set().for_each_bit([&](std::int32_t idx, std::int32_t cpu_id) {
         DVLOG(10) << "initializing fiber queue " << idx << " of " << cpu_count << " on cpu_id " << cpu_id;
-        m_queues[cpu_id] = std::make_unique<FiberTaskQueue>(resources, cpu_id);
+        m_queues[cpu_id] = std::make_unique<FiberTaskQueue>(resources, cpu_id, m_work_stealing);
     });
 }
 
@@ -54,20 +70,72 @@ FiberManager::~FiberManager()
     join();
 }
 
-FiberPool FiberManager::make_pool(CpuSet cpu_set) const
+FiberPool FiberManager::make_pool(CpuSet cpu_set, bool work_stealing) const
 {
     // valididate that cpu_set is a subset of topology->cpu_set()
     if (!m_cpu_set.contains(cpu_set))
     {
         throw exceptions::MrcRuntimeError("cpu_set must be a subset of the initial topology to create a fiber pool");
     }
+    std::uint32_t steal_group = 0;
+    if (work_stealing && m_work_stealing)
+    {
+        steal_group = form_steal_groups(cpu_set);
+    }
     auto cpus = cpu_set.vec();
     std::vector<std::reference_wrapper<FiberTaskQueue>> queues;
     for (auto& cpu : cpus)
     {
         queues.emplace_back(*m_queues.at(cpu));
     }
-    return {std::move(cpu_set), std::move(queues)};
+    return {std::move(cpu_set), std::move(queues), steal_group};
+}
+
+std::uint32_t FiberManager::form_steal_groups(const CpuSet& cpu_set) const
+{
+    std::lock_guard<decltype(m_steal_groups_mutex)> lock(m_steal_groups_mutex);
+
+    // every pool gets groups of its own, so fibers only migrate between the threads of the pool which launched them
+    const auto id = m_next_steal_group_id;
+    bool formed   = false;
+
+    for (const auto& numa_cpu_set : m_numa_cpu_sets)
+    {
+        std::vector<boost::intrusive_ptr<FiberWorkStealingScheduler>> members;
+        CpuSet group_cpu_set;
+
+        cpu_set.set_intersect(numa_cpu_set).for_each_bit([&](std::int32_t idx, std::int32_t cpu_id) {
+            auto* scheduler = m_queues.at(cpu_id)->work_stealing_scheduler();
+            CHECK(scheduler) << "fiber task queue on cpu_id " << cpu_id << " was not created with work stealing";
+            members.emplace_back(scheduler);
+            group_cpu_set.on(cpu_id);
+        });
+
+        if (members.size() < 2)
+        {
+            continue;
+        }
+
+        auto group = std::make_unique<FiberStealGroup>(id, std::move(members));
+        if (group->size() < static_cast<std::size_t>(group_cpu_set.weight()))
+        {
+            LOG(WARNING) << "some threads on cpus " << group_cpu_set << " already belong to "
+                         << FiberWorkStealingScheduler::MaxStealGroupsPerThread
+                         << " fiber steal groups; fibers will not migrate to or from them";
+        }
+
+        DVLOG(10) << "forming fiber steal group " << id << " on cpus " << group_cpu_set;
+        m_steal_groups.push_back(std::move(group));
+        formed = true;
+    }
+
+    if (!formed)
+    {
+        return 0;
+    }
+
+    ++m_next_steal_group_id;
+    return id;
 }
 
 void FiberManager::stop()
@@ -29,6 +29,7 @@
 #include <cstdint>
 #include <map>
 #include <memory>
+#include <mutex>
 #include <ostream>
 #include <type_traits>
 #include <utility>
@@ -36,6 +37,7 @@
 
 namespace mrc::internal::system {
 
+class FiberStealGroup;
 class Resources;
 
 class FiberManager final
@@ -48,7 +50,15 @@ class FiberManager final
     DELETE_MOVEABILITY(FiberManager)
 
     [[nodiscard]] FiberTaskQueue& task_queue(std::uint32_t cpu_id) const;
-    [[nodiscard]] FiberPool make_pool(CpuSet cpu_set) const;
+    /**
+     * @brief Creates a FiberPool over the task queues of cpu_set.
+     *
+     * If work_stealing is requested and FiberPoolOptions::enable_work_stealing is set, the threads of the pool which
+     * share a NUMA node are joined into a steal group of their own, allowing fibers launched with the pool's
+     * FiberPool::steal_group() on any of them to migrate between them. Pools sharing threads never steal each other's
+     * fibers.
+     */
+    [[nodiscard]] FiberPool make_pool(CpuSet cpu_set, bool work_stealing = false) const;
 
     template <class F>
     [[nodiscard]] auto enqueue_fiber(std::uint32_t queue_idx, const F& to_enqueue) const
@@ -107,7 +117,18 @@ class FiberManager final
     void stop();
     void join();
 
+    // returns the steal group id of the groups formed for cpu_set, or zero if none were formed
+    std::uint32_t form_steal_groups(const CpuSet& cpu_set) const;
+
     const CpuSet m_cpu_set;
+    const bool m_work_stealing;
+    std::vector<CpuSet> m_numa_cpu_sets;
+
+    // groups are formed lazily as pools are created and must outlive the task queues
+    mutable std::mutex m_steal_groups_mutex;
+    mutable std::vector<std::unique_ptr<FiberStealGroup>> m_steal_groups;
+    mutable std::uint32_t m_next_steal_group_id{1};
+
     std::map<std::uint32_t, std::unique_ptr<FiberTaskQueue>> m_queues;
 };
 
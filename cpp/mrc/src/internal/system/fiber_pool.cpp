@@ -25,14 +25,18 @@
 #include <glog/logging.h>
 
 #include <cstddef>
+#include <cstdint>
 #include <utility>
 #include <vector>
 
 namespace mrc::internal::system {
 
-FiberPool::FiberPool(CpuSet cpu_set, std::vector<std::reference_wrapper<FiberTaskQueue>>&& queues) :
+FiberPool::FiberPool(CpuSet cpu_set,
+                     std::vector<std::reference_wrapper<FiberTaskQueue>>&& queues,
+                     std::uint32_t steal_group) :
   m_cpu_set(std::move(cpu_set)),
-  m_queues(std::move(queues))
+  m_queues(std::move(queues)),
+  m_steal_group(steal_group)
 {}
 
 FiberPool::~FiberPool() = default;
@@ -53,4 +57,9 @@ core::FiberTaskQueue& FiberPool::task_queue(const std::size_t& index)
     return m_queues.at(index);
 }
 
+std::uint32_t FiberPool::steal_group() const
+{
+    return m_steal_group;
+}
+
 }  // namespace mrc::internal::system
@@ -35,7 +35,9 @@ class FiberTaskQueue;
 class FiberPool final : public core::FiberPool
 {
   public:
-    FiberPool(CpuSet cpu_set, std::vector<std::reference_wrapper<FiberTaskQueue>>&& queues);
+    FiberPool(CpuSet cpu_set,
+              std::vector<std::reference_wrapper<FiberTaskQueue>>&& queues,
+              std::uint32_t steal_group = 0);
     ~FiberPool() final;
 
     DELETE_COPYABILITY(FiberPool);
@@ -46,6 +48,12 @@ class FiberPool final : public core::FiberPool
 
     core::FiberTaskQueue& task_queue(const std::size_t& index) final;
 
+    /**
+     * @brief Steal group id to launch fibers with, see FiberMetaData::steal_group, so they may migrate between the
+     * threads of this pool; zero if the pool was created without work stealing.
+     */
+    std::uint32_t steal_group() const;
+
     template <typename ResourceT>
     void set_thread_local_resource(std::shared_ptr<ResourceT> resource)
     {
@@ -68,6 +76,7 @@ class FiberPool final : public core::FiberPool
   private:
     CpuSet m_cpu_set;
     std::vector<std::reference_wrapper<FiberTaskQueue>> m_queues;
+    std::uint32_t m_steal_group;
 };
 
 }  // namespace mrc::internal::system
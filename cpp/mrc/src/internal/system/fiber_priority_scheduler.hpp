@@ -17,11 +17,17 @@
 
 #pragma once
 
+#include "mrc/tracing/event_trace.hpp"
+
 #include <boost/fiber/all.hpp>
 #include <boost/fiber/scheduler.hpp>
 
+#include <cstdint>
+
 namespace mrc::internal::system {
 
+class FiberStealGroup;
+
 class FiberPriorityProps : public boost::fibers::fiber_properties
 {
   public:
@@ -45,8 +51,30 @@ class FiberPriorityProps : public boost::fibers::fiber_properties
         }
     }
 
+    std::uint32_t steal_group() const
+    {
+        return m_steal_group;
+    }
+
+    // Marks the fiber as free to migrate to another thread of the FiberPool with this steal group id; zero, the
+    // default, keeps the fiber on the thread which launched it. Only honored by the FiberWorkStealingScheduler.
+    void set_steal_group(std::uint32_t steal_group)
+    {
+        if (steal_group != m_steal_group)
+        {
+            m_steal_group = steal_group;
+            notify();
+        }
+    }
+
   private:
     int m_priority{0};
+    std::uint32_t m_steal_group{0};
+
+    // the group whose stealable count includes this fiber while it is queued; owned by FiberWorkStealingScheduler
+    FiberStealGroup* m_queued_group{nullptr};
+
+    friend class FiberWorkStealingScheduler;
 };
 
 class FiberPriorityScheduler : public boost::fibers::algo::algorithm_with_properties<FiberPriorityProps>
@@ -91,6 +119,7 @@ class FiberPriorityScheduler : public boost::fibers::algo::algorithm_with_proper
         }
         boost::fibers::context* ctx(&m_rqueue.front());
         m_rqueue.pop_front();
+        tracing::record_fiber_switch(reinterpret_cast<std::uintptr_t>(ctx));
         return ctx;
     }
 
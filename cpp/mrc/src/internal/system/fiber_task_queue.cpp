@@ -18,11 +18,13 @@
 #include "internal/system/fiber_task_queue.hpp"
 
 #include "internal/system/fiber_priority_scheduler.hpp"
+#include "internal/system/fiber_work_stealing_scheduler.hpp"
 #include "internal/system/resources.hpp"
 
 #include "mrc/core/bitmap.hpp"
 #include "mrc/core/fiber_meta_data.hpp"
 #include "mrc/core/task_queue.hpp"
+#include "mrc/tracing/event_trace.hpp"
 #include "mrc/types.hpp"
 
 #include <boost/fiber/channel_op_status.hpp>
@@ -30,6 +32,7 @@
 #include <boost/fiber/fiber.hpp>
 #include <boost/fiber/future/future.hpp>
 #include <boost/fiber/operations.hpp>
+#include <boost/fiber/scheduler.hpp>
 #include <glog/logging.h>
 
 #include <ostream>
@@ -39,9 +42,13 @@
 
 namespace mrc::internal::system {
 
-FiberTaskQueue::FiberTaskQueue(const Resources& resources, CpuSet cpu_affinity, std::size_t channel_size) :
+FiberTaskQueue::FiberTaskQueue(const Resources& resources,
+                               CpuSet cpu_affinity,
+                               bool work_stealing,
+                               std::size_t channel_size) :
   m_queue(channel_size),
   m_cpu_affinity(std::move(cpu_affinity)),
+  m_work_stealing(work_stealing),
   m_thread(resources.make_thread("fiberq", m_cpu_affinity, [this] {
       main();
   }))
@@ -68,8 +75,20 @@ boost::fibers::buffered_channel<core::FiberTaskQueue::task_pkg_t>& FiberTaskQueu
 
 void FiberTaskQueue::main()
 {
-    // enable priority scheduler
-    boost::fibers::use_scheduling_algorithm<FiberPriorityScheduler>();
+    // the schedulers trace fiber switches from pick_next, which must not allocate
+    tracing::register_thread();
+
+    if (m_work_stealing)
+    {
+        // keep a handle so the FiberManager can add this thread to a steal group after the queue is running
+        m_scheduler = new FiberWorkStealingScheduler();
+        boost::fibers::context::active()->get_scheduler()->set_algo(m_scheduler);
+    }
+    else
+    {
+        // enable priority scheduler
+        boost::fibers::use_scheduling_algorithm<FiberPriorityScheduler>();
+    }
 
     task_pkg_t task_pkg;
     while (true)
@@ -92,6 +111,17 @@ void FiberTaskQueue::main()
         boost::this_fiber::yield();
     }
 
+    if (m_scheduler)
+    {
+        // fibers left in our ready queue are detached from this thread; stop offering new ones to the group and run
+        // the remainder before the thread's dispatcher is allowed to exit
+        m_scheduler->leave_groups();
+        while (m_scheduler->stealable_count() != 0U)
+        {
+            boost::this_fiber::yield();
+        }
+    }
+
     VLOG(10) << *this << ": completed";
 }
 
@@ -100,12 +130,18 @@ void FiberTaskQueue::shutdown()
     m_queue.close();
 }
 
+FiberWorkStealingScheduler* FiberTaskQueue::work_stealing_scheduler() const
+{
+    return m_scheduler.get();
+}
+
 void FiberTaskQueue::launch(task_pkg_t&& pkg) const
 {
     // default is a post, not a dispatch, so the task is only enqueued with the fiber scheduler
     boost::fibers::fiber fiber(std::move(pkg.first));
     auto& props(fiber.properties<FiberPriorityProps>());
     props.set_priority(pkg.second.priority);
+    props.set_steal_group(pkg.second.steal_group);
     DVLOG(10) << *this << ": created fiber " << fiber.get_id() << " with priority " << pkg.second.priority;
     fiber.detach();
 }
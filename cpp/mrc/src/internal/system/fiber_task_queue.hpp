@@ -24,6 +24,7 @@
 #include "mrc/utils/macros.hpp"
 
 #include <boost/fiber/buffered_channel.hpp>
+#include <boost/smart_ptr/intrusive_ptr.hpp>
 
 #include <cstddef>
 #include <iosfwd>
@@ -31,12 +32,16 @@
 
 namespace mrc::internal::system {
 
+class FiberWorkStealingScheduler;
 class Resources;
 
 class FiberTaskQueue final : public core::FiberTaskQueue
 {
   public:
-    FiberTaskQueue(const Resources& resources, CpuSet cpu_affinity, std::size_t channel_size = 64);
+    FiberTaskQueue(const Resources& resources,
+                   CpuSet cpu_affinity,
+                   bool work_stealing       = false,
+                   std::size_t channel_size = 64);
     ~FiberTaskQueue() final;
 
     DELETE_COPYABILITY(FiberTaskQueue);
@@ -49,6 +54,12 @@ class FiberTaskQueue final : public core::FiberTaskQueue
 
     void shutdown();
 
+    /**
+     * @brief The work stealing scheduler driving this thread, or nullptr if the queue was created with the default
+     * FiberPriorityScheduler
+     */
+    FiberWorkStealingScheduler* work_stealing_scheduler() const;
+
     friend std::ostream& operator<<(std::ostream& os, const FiberTaskQueue& ftq);
 
   private:
@@ -59,6 +70,8 @@ class FiberTaskQueue final : public core::FiberTaskQueue
 
     boost::fibers::buffered_channel<task_pkg_t> m_queue;
     CpuSet m_cpu_affinity;
+    bool m_work_stealing;
+    boost::intrusive_ptr<FiberWorkStealingScheduler> m_scheduler;
     Thread m_thread;
 };
 
@@ -0,0 +1,401 @@
+/**
+ * SPDX-FileCopyrightText: Copyright (c) 2023, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "internal/system/fiber_work_stealing_scheduler.hpp"
+
+#include "mrc/tracing/event_trace.hpp"
+
+#include <boost/fiber/context.hpp>
+
+#include <algorithm>
+#include <bit>
+#include <cstdint>
+#include <random>
+#include <utility>
+
+namespace mrc::internal::system {
+
+namespace {
+
+std::size_t highest_bucket(std::uint64_t mask)
+{
+    return 63 - std::countl_zero(mask);
+}
+
+}  // namespace
+
+FiberStealGroup::FiberStealGroup(std::uint32_t id,
+                                 std::vector<boost::intrusive_ptr<FiberWorkStealingScheduler>> members) :
+  m_id(id)
+{
+    // a thread which already belongs to too many groups stays out of this one
+    for (auto& member : members)
+    {
+        if (member->join_group(*this))
+        {
+            m_members.push_back(std::move(member));
+        }
+    }
+}
+
+FiberStealGroup::~FiberStealGroup()
+{
+    for (auto& member : m_members)
+    {
+        member->leave_group(*this);
+    }
+}
+
+std::uint32_t FiberStealGroup::id() const
+{
+    return m_id;
+}
+
+std::size_t FiberStealGroup::size() const
+{
+    return m_members.size();
+}
+
+boost::fibers::context* FiberStealGroup::steal(const FiberWorkStealingScheduler* thief)
+{
+    static thread_local std::minstd_rand generator{std::random_device{}()};
+
+    const auto count = m_members.size();
+    const auto start = generator() % count;
+
+    for (std::size_t i = 0; i < count; ++i)
+    {
+        auto& victim = m_members[(start + i) % count];
+        if (victim.get() == thief)
+        {
+            continue;
+        }
+
+        auto* ctx = victim->steal(*this);
+        if (ctx != nullptr)
+        {
+            return ctx;
+        }
+    }
+
+    return nullptr;
+}
+
+void FiberStealGroup::notify_idle(const FiberWorkStealingScheduler* caller)
+{
+    // pairs with the increment in suspend_until; if no member is idle there is nobody to wake
+    if (m_idle_count.load() == 0)
+    {
+        return;
+    }
+
+    for (auto& member : m_members)
+    {
+        if (member.get() != caller && member->m_idle.load())
+        {
+            member->notify();
+            return;
+        }
+    }
+}
+
+void FiberWorkStealingScheduler::awakened(boost::fibers::context* ctx, FiberPriorityProps& props) noexcept
+{
+    // fibers of a steal group this thread belongs to are detached from this thread's scheduler so any member of the
+    // group can attach them in pick_next; everything else stays attached and is never handed out by steal()
+    FiberStealGroup* group = nullptr;
+    if (props.steal_group() != 0 && !ctx->is_context(boost::fibers::type::pinned_context))
+    {
+        group = find_group(props.steal_group());
+    }
+
+    // a context re-queued by property_change may already be detached
+    if (group != nullptr && ctx->get_scheduler() != nullptr)
+    {
+        ctx->detach();
+    }
+
+    {
+        std::lock_guard<std::mutex> lock(m_queue_mutex);
+        push(ctx, props.get_priority());
+        if (group != nullptr)
+        {
+            props.m_queued_group = group;
+            m_stealable_count.fetch_add(1);
+            group->m_stealable_count.fetch_add(1);
+        }
+    }
+
+    if (group != nullptr)
+    {
+        group->notify_idle(this);
+    }
+}
+
+void FiberWorkStealingScheduler::push(boost::fibers::context* ctx, int priority)
+{
+    const auto bucket = static_cast<std::size_t>(std::clamp(priority, MinPriority, MaxPriority) - MinPriority);
+    ctx->ready_link(m_buckets[bucket]);
+    m_bucket_mask |= std::uint64_t{1} << bucket;
+    m_ready_count.fetch_add(1, std::memory_order_relaxed);
+}
+
+void FiberWorkStealingScheduler::pop(boost::fibers::context* ctx)
+{
+    m_ready_count.fetch_sub(1, std::memory_order_relaxed);
+
+    auto& props = properties(ctx);
+    if (props.m_queued_group != nullptr)
+    {
+        props.m_queued_group->m_stealable_count.fetch_sub(1);
+        props.m_queued_group = nullptr;
+        m_stealable_count.fetch_sub(1);
+    }
+}
+
+FiberStealGroup* FiberWorkStealingScheduler::find_group(std::uint32_t id) const
+{
+    for (const auto& slot : m_groups)
+    {
+        auto* group = slot.load(std::memory_order_acquire);
+        if (group != nullptr && group->id() == id)
+        {
+            return group;
+        }
+    }
+    return nullptr;
+}
+
+boost::fibers::context* FiberWorkStealingScheduler::pick_next() noexcept
+{
+    boost::fibers::context* ctx = nullptr;
+
+    {
+        std::lock_guard<std::mutex> lock(m_queue_mutex);
+        while (m_bucket_mask != 0)
+        {
+            const auto bucket = highest_bucket(m_bucket_mask);
+            auto& queue       = m_buckets[bucket];
+            if (!queue.empty())
+            {
+                ctx = &queue.front();
+                queue.pop_front();
+                pop(ctx);
+            }
+            if (queue.empty())
+            {
+                m_bucket_mask &= ~(std::uint64_t{1} << bucket);
+            }
+            if (ctx != nullptr)
+            {
+                break;
+            }
+        }
+    }
+
+    for (std::size_t i = 0; ctx == nullptr && i < m_groups.size(); ++i)
+    {
+        auto* group = m_groups[i].load(std::memory_order_acquire);
+        if (group != nullptr)
+        {
+            ctx = group->steal(this);
+        }
+    }
+
+    if (ctx != nullptr && ctx->get_scheduler() == nullptr)
+    {
+        boost::fibers::context::active()->attach(ctx);
+    }
+
+    if (ctx != nullptr)
+    {
+        tracing::record_fiber_switch(reinterpret_cast<std::uintptr_t>(ctx));
+    }
+
+    return ctx;
+}
+
+boost::fibers::context* FiberWorkStealingScheduler::steal(const FiberStealGroup& group) noexcept
+{
+    if (m_stealable_count.load() == 0 || group.m_stealable_count.load() == 0)
+    {
+        return nullptr;
+    }
+
+    std::lock_guard<std::mutex> lock(m_queue_mutex);
+    for (auto mask = m_bucket_mask; mask != 0;)
+    {
+        const auto bucket = highest_bucket(mask);
+        mask &= ~(std::uint64_t{1} << bucket);
+
+        auto& queue = m_buckets[bucket];
+        for (auto it = queue.begin(); it != queue.end(); ++it)
+        {
+            if (properties(&*it).m_queued_group == &group)
+            {
+                auto* ctx = &*it;
+                queue.erase(it);
+                if (queue.empty())
+                {
+                    m_bucket_mask &= ~(std::uint64_t{1} << bucket);
+                }
+                pop(ctx);
+                return ctx;
+            }
+        }
+    }
+    return nullptr;
+}
+
+bool FiberWorkStealingScheduler::has_ready_fibers() const noexcept
+{
+    return m_ready_count.load(std::memory_order_relaxed) > 0;
+}
+
+void FiberWorkStealingScheduler::property_change(boost::fibers::context* ctx, FiberPriorityProps& props) noexcept
+{
+    {
+        std::lock_guard<std::mutex> lock(m_queue_mutex);
+
+        // 'ctx' might not be in our queue at all, e.g. it is running or was stolen by another thread. In that case
+        // the new properties take effect the next time it hits awakened().
+        if (!ctx->ready_is_linked())
+        {
+            return;
+        }
+
+        // the bit of a bucket this empties is cleared by the next pick_next
+        ctx->ready_unlink();
+        pop(ctx);
+    }
+
+    // re-add the context to the bucket for its new priority; this is also where a fiber which was just given a steal
+    // group is detached
+    awakened(ctx, props);
+}
+
+void FiberWorkStealingScheduler::suspend_until(std::chrono::steady_clock::time_point const& time_point) noexcept
+{
+    // the groups may change while we sleep; the idle counts are released on the groups they were taken on
+    std::array<FiberStealGroup*, MaxStealGroupsPerThread> groups{};
+    bool has_groups = false;
+    for (std::size_t i = 0; i < m_groups.size(); ++i)
+    {
+        groups[i] = m_groups[i].load(std::memory_order_acquire);
+        has_groups |= groups[i] != nullptr;
+    }
+
+    auto release_idle = [&]() {
+        for (auto* group : groups)
+        {
+            if (group != nullptr)
+            {
+                group->m_idle_count.fetch_sub(1);
+            }
+        }
+        m_idle.store(false);
+    };
+
+    if (has_groups)
+    {
+        // announce that we are idle before checking for work; notify_idle checks in the opposite order so either we
+        // see the new work here or the producer sees us idle and wakes us
+        m_idle.store(true);
+        bool has_stealable = false;
+        for (auto* group : groups)
+        {
+            if (group != nullptr)
+            {
+                group->m_idle_count.fetch_add(1);
+                has_stealable |= group->m_stealable_count.load() > 0;
+            }
+        }
+
+        if (has_stealable)
+        {
+            release_idle();
+            return;
+        }
+    }
+
+    {
+        std::unique_lock<std::mutex> lk(m_mtx);
+        if ((std::chrono::steady_clock::time_point::max)() == time_point)
+        {
+            m_cnd.wait(lk, [this]() {
+                return m_flag;
+            });
+        }
+        else
+        {
+            m_cnd.wait_until(lk, time_point, [this]() {
+                return m_flag;
+            });
+        }
+        m_flag = false;
+    }
+
+    if (has_groups)
+    {
+        release_idle();
+    }
+}
+
+void FiberWorkStealingScheduler::notify() noexcept
+{
+    std::unique_lock<std::mutex> lk(m_mtx);
+    m_flag = true;
+    lk.unlock();
+    m_cnd.notify_all();
+}
+
+bool FiberWorkStealingScheduler::join_group(FiberStealGroup& group)
+{
+    for (auto& slot : m_groups)
+    {
+        FiberStealGroup* expected = nullptr;
+        if (slot.compare_exchange_strong(expected, &group, std::memory_order_acq_rel))
+        {
+            return true;
+        }
+    }
+    return false;
+}
+
+void FiberWorkStealingScheduler::leave_group(FiberStealGroup& group)
+{
+    for (auto& slot : m_groups)
+    {
+        FiberStealGroup* expected = &group;
+        slot.compare_exchange_strong(expected, nullptr, std::memory_order_acq_rel);
+    }
+}
+
+void FiberWorkStealingScheduler::leave_groups()
+{
+    for (auto& slot : m_groups)
+    {
+        slot.store(nullptr, std::memory_order_release);
+    }
+}
+
+std::size_t FiberWorkStealingScheduler::stealable_count() const
+{
+    return m_stealable_count.load();
+}
+
+}  // namespace mrc::internal::system
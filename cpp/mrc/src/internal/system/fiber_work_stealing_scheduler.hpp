@@ -0,0 +1,168 @@
+/**
+ * SPDX-FileCopyrightText: Copyright (c) 2023, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include "internal/system/fiber_priority_scheduler.hpp"
+
+#include "mrc/utils/macros.hpp"
+
+#include <boost/fiber/all.hpp>
+#include <boost/fiber/scheduler.hpp>
+#include <boost/smart_ptr/intrusive_ptr.hpp>
+
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+#include <vector>
+
+namespace mrc::internal::system {
+
+class FiberWorkStealingScheduler;
+
+/**
+ * @brief Set of fiber schedulers, one per thread, which are allowed to steal ready fibers from one another.
+ *
+ * The FiberManager forms one group per NUMA node for each FiberPool created with work stealing, from the threads of
+ * the pool on that node. All groups of a pool share the pool's steal group id, and only fibers launched with that id
+ * are offered to the group, so a stolen fiber never leaves the CpuSet of the pool which launched it nor crosses a NUMA
+ * boundary. A thread shared by several pools is a member of one group per pool.
+ */
+class FiberStealGroup final
+{
+  public:
+    FiberStealGroup(std::uint32_t id, std::vector<boost::intrusive_ptr<FiberWorkStealingScheduler>> members);
+    ~FiberStealGroup();
+
+    DELETE_COPYABILITY(FiberStealGroup);
+    DELETE_MOVEABILITY(FiberStealGroup);
+
+    std::uint32_t id() const;
+    std::size_t size() const;
+
+  private:
+    // steal a ready fiber of this group from any member other than the thief; returns nullptr if none are available
+    boost::fibers::context* steal(const FiberWorkStealingScheduler* thief);
+
+    // wake one idle member so it may steal newly queued work from the caller
+    void notify_idle(const FiberWorkStealingScheduler* caller);
+
+    const std::uint32_t m_id;
+    std::vector<boost::intrusive_ptr<FiberWorkStealingScheduler>> m_members;
+
+    // fibers of this group queued on any member; a member only suspends while this is zero
+    std::atomic<std::size_t> m_stealable_count{0};
+    std::atomic<std::size_t> m_idle_count{0};
+
+    friend FiberWorkStealingScheduler;
+};
+
+/**
+ * @brief Priority fiber scheduler which can share work with the other threads of its FiberStealGroups.
+ *
+ * Ready fibers are kept in a fixed array of FIFO buckets, one per priority level, with a bitmask of the buckets which
+ * may hold fibers, so awakened() and pick_next() neither allocate nor depend on the number of ready fibers or
+ * priority levels in use. Priorities are clamped to [MinPriority, MaxPriority]. Fibers with higher priority values are
+ * preferred; fibers of equal priority are processed in round-robin fashion, matching FiberPriorityScheduler.
+ *
+ * Only fibers launched with the steal group id of a group this thread belongs to, see
+ * FiberPriorityProps::set_steal_group, are detached from this thread and offered to the other members of that group.
+ * Pinned contexts (the main and dispatcher fibers) and fibers which rely on thread local state, e.g. those enqueued
+ * directly on a FiberTaskQueue, always run on the thread which launched them. When the local queue is empty,
+ * pick_next() steals from a sibling before the thread suspends.
+ */
+class FiberWorkStealingScheduler final : public boost::fibers::algo::algorithm_with_properties<FiberPriorityProps>
+{
+  public:
+    static constexpr int MinPriority                     = -32;
+    static constexpr int MaxPriority                     = 31;
+    static constexpr std::size_t MaxStealGroupsPerThread = 8;
+
+    FiberWorkStealingScheduler()        = default;
+    ~FiberWorkStealingScheduler() final = default;
+
+    void awakened(boost::fibers::context* ctx, FiberPriorityProps& props) noexcept final;
+
+    boost::fibers::context* pick_next() noexcept final;
+
+    bool has_ready_fibers() const noexcept final;
+
+    void property_change(boost::fibers::context* ctx, FiberPriorityProps& props) noexcept final;
+
+    void suspend_until(std::chrono::steady_clock::time_point const& time_point) noexcept final;
+
+    void notify() noexcept final;
+
+    /**
+     * @brief Start sharing the fibers of group with its members. Called once the FiberManager forms the group; returns
+     * false if this thread already belongs to MaxStealGroupsPerThread groups.
+     */
+    bool join_group(FiberStealGroup& group);
+
+    /**
+     * @brief Stop stealing from, and offering fibers to, group. Fibers queued afterwards stay attached to this thread.
+     */
+    void leave_group(FiberStealGroup& group);
+
+    /**
+     * @brief Leave every group. Called by the owning thread before it shuts down.
+     */
+    void leave_groups();
+
+    /**
+     * @brief Number of fibers in the local queue which could still be stolen by another member of a group
+     */
+    std::size_t stealable_count() const;
+
+  private:
+    using rqueue_t = boost::fibers::scheduler::ready_queue_type;
+
+    static constexpr std::size_t PriorityLevels = MaxPriority - MinPriority + 1;
+    static_assert(PriorityLevels <= 64, "the bucket bitmask is a std::uint64_t");
+
+    // requires m_queue_mutex
+    void push(boost::fibers::context* ctx, int priority);
+    void pop(boost::fibers::context* ctx);
+
+    // the group with the given steal group id this thread belongs to, or nullptr
+    FiberStealGroup* find_group(std::uint32_t id) const;
+
+    // removes and returns the first context of group, highest priority first
+    boost::fibers::context* steal(const FiberStealGroup& group) noexcept;
+
+    // a set bit marks a bucket which may hold fibers; bits of buckets emptied by property_change are cleared lazily
+    std::array<rqueue_t, PriorityLevels> m_buckets;
+    std::uint64_t m_bucket_mask{0};
+    mutable std::mutex m_queue_mutex;
+    std::atomic<std::size_t> m_ready_count{0};
+    std::atomic<std::size_t> m_stealable_count{0};
+
+    std::array<std::atomic<FiberStealGroup*>, MaxStealGroupsPerThread> m_groups{};
+    std::atomic<bool> m_idle{false};
+
+    std::mutex m_mtx{};
+    std::condition_variable m_cnd{};
+    bool m_flag{false};
+
+    friend FiberStealGroup;
+};
+
+}  // namespace mrc::internal::system
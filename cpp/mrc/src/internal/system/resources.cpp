@@ -39,9 +39,9 @@ FiberTaskQueue& Resources::get_task_queue(std::uint32_t cpu_id) const
     return m_fiber_manager.task_queue(cpu_id);
 }
 
-FiberPool Resources::make_fiber_pool(const CpuSet& cpu_set) const
+FiberPool Resources::make_fiber_pool(const CpuSet& cpu_set, bool work_stealing) const
 {
-    return m_fiber_manager.make_pool(cpu_set);
+    return m_fiber_manager.make_pool(cpu_set, work_stealing);
 }
 
 void Resources::register_thread_local_initializer(const CpuSet& cpu_set, std::function<void()> initializer)
@@ -54,7 +54,7 @@ class Resources final : public SystemProvider
     template <typename CallableT>
     [[nodiscard]] Thread make_thread(std::string desc, CpuSet cpu_affinity, CallableT&& callable) const;
 
-    FiberPool make_fiber_pool(const CpuSet& cpu_set) const;
+    FiberPool make_fiber_pool(const CpuSet& cpu_set, bool work_stealing = false) const;
     FiberTaskQueue& get_task_queue(std::uint32_t cpu_id) const;
 
     template <typename ResourceT>
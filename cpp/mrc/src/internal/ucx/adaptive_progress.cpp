@@ -0,0 +1,79 @@
+/**
+ * SPDX-FileCopyrightText: Copyright (c) 2022-2023, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "internal/ucx/adaptive_progress.hpp"
+
+#include "internal/ucx/worker.hpp"
+
+#include <boost/fiber/operations.hpp>
+
+#include <algorithm>
+
+namespace mrc::internal::ucx {
+
+namespace {
+constexpr std::chrono::microseconds MinBackoff{1};
+}  // namespace
+
+AdaptiveProgress::AdaptiveProgress(Worker& worker, const ProgressEngineOptions& options) :
+  m_worker(worker),
+  m_options(options),
+  m_backoff(MinBackoff)
+{}
+
+void AdaptiveProgress::wait(bool active)
+{
+    // spin while events are arriving
+    if (active)
+    {
+        m_idle_polls = 0;
+        m_backoff    = MinBackoff;
+        boost::this_fiber::yield();
+        return;
+    }
+
+    if (m_idle_polls++ == 0)
+    {
+        m_idle_since = std::chrono::steady_clock::now();
+    }
+
+    if (m_idle_polls <= m_options.spin_count())
+    {
+        boost::this_fiber::yield();
+        return;
+    }
+
+    // parking blocks every fiber on this thread, hence the bounded timeout
+    const auto park_threshold = m_options.park_threshold();
+    if (park_threshold.count() > 0 && std::chrono::steady_clock::now() - m_idle_since >= park_threshold)
+    {
+        m_worker.park(m_options.park_timeout());
+        m_park_count++;
+        boost::this_fiber::yield();
+        return;
+    }
+
+    boost::this_fiber::sleep_for(m_backoff);
+    m_backoff = std::min(m_backoff * 2, m_options.max_backoff());
+}
+
+std::size_t AdaptiveProgress::park_count() const
+{
+    return m_park_count;
+}
+
+}  // namespace mrc::internal::ucx
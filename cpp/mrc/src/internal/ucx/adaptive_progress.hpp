@@ -0,0 +1,61 @@
+/**
+ * SPDX-FileCopyrightText: Copyright (c) 2022-2023, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include "mrc/options/progress_engine.hpp"
+
+#include <chrono>
+#include <cstddef>
+
+namespace mrc::internal::ucx {
+
+class Worker;
+
+/**
+ * @brief Hybrid spin/back-off/park waiting strategy for the loop of a ucx progress engine
+ *
+ * The progress engine calls wait() after every iteration of its loop, passing whether the iteration found any work.
+ * While work is found the caller only yields. After ProgressEngineOptions::spin_count() empty iterations the caller
+ * sleeps between iterations with an exponentially growing back-off. Once idle for park_threshold() the calling thread
+ * is parked on the worker's event fd until an event arrives, the worker is woken or park_timeout() expires.
+ *
+ * Must be called from the fiber which progresses the worker.
+ */
+class AdaptiveProgress
+{
+  public:
+    AdaptiveProgress(Worker& worker, const ProgressEngineOptions& options);
+
+    void wait(bool active);
+
+    /**
+     * @brief Number of times the calling thread was parked
+     */
+    std::size_t park_count() const;
+
+  private:
+    Worker& m_worker;
+    const ProgressEngineOptions m_options;
+
+    std::size_t m_idle_polls{0};
+    std::chrono::microseconds m_backoff;
+    std::chrono::steady_clock::time_point m_idle_since;
+    std::size_t m_park_count{0};
+};
+
+}  // namespace mrc::internal::ucx
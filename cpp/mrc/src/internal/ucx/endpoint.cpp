@@ -91,4 +91,10 @@ const RemoteRegistrationCache& Endpoint::registration_cache() const
     return *m_registration_cache;
 }
 
+const Worker& Endpoint::worker() const
+{
+    CHECK(m_worker);
+    return *m_worker;
+}
+
 }  // namespace mrc::internal::ucx
@@ -40,6 +40,8 @@ class Endpoint : public Primitive<ucp_ep_h>
     RemoteRegistrationCache& registration_cache();
     const RemoteRegistrationCache& registration_cache() const;
 
+    const Worker& worker() const;
+
   private:
     Handle<Worker> m_worker;
     std::unique_ptr<RemoteRegistrationCache> m_registration_cache;
@@ -29,11 +29,15 @@
 #include <ucs/type/status.h>       // for ucs_status_string, UCS_OK
 #include <ucs/type/thread_mode.h>  // for UCS_THREAD_MODE_MULTI
 
+#include <sys/epoll.h>
+#include <unistd.h>
+
 #include <cstring>  // for memset
 #include <memory>
 #include <ostream>    // for logging
 #include <stdexcept>  // for runtime_error
 #include <string>
+#include <thread>
 #include <utility>
 
 namespace mrc::internal::ucx {
@@ -59,10 +63,32 @@ Worker::Worker(Handle<Context> context) : m_context(std::move(context)), m_addre
         LOG(ERROR) << "ucp_worker_create failed: " << ucs_status_string(status);
         throw std::runtime_error("ucp_worker_create failed");
     }
+
+    int event_fd = -1;
+    status       = ucp_worker_get_efd(m_handle, &event_fd);
+    if (status != UCS_OK)
+    {
+        LOG(WARNING) << "ucp_worker_get_efd failed: " << ucs_status_string(status) << "; parking is disabled";
+        return;
+    }
+
+    m_epoll_fd = epoll_create1(EPOLL_CLOEXEC);
+    CHECK_GE(m_epoll_fd, 0) << "epoll_create1 failed";
+
+    epoll_event event;
+    std::memset(&event, 0, sizeof(event));
+    event.events  = EPOLLIN;
+    event.data.fd = event_fd;
+    CHECK_EQ(epoll_ctl(m_epoll_fd, EPOLL_CTL_ADD, event_fd, &event), 0) << "epoll_ctl failed";
 }
 
 Worker::~Worker()
 {
+    if (m_epoll_fd >= 0)
+    {
+        close(m_epoll_fd);
+    }
+
     release_address();
 
     VLOG(5) << "destroying ucp worker";
@@ -80,6 +106,35 @@ unsigned Worker::progress()
     return ucp_worker_progress(m_handle);
 }
 
+void Worker::park(std::chrono::milliseconds timeout)
+{
+    if (m_epoll_fd < 0)
+    {
+        std::this_thread::sleep_for(timeout);
+        return;
+    }
+
+    // an operation posted concurrently with parking may miss the flag; it is progressed once the timeout expires
+    m_parked.store(true);
+
+    // UCS_ERR_BUSY means events arrived since the last progress
+    if (ucp_worker_arm(m_handle) == UCS_OK)
+    {
+        epoll_event event;
+        epoll_wait(m_epoll_fd, &event, 1, static_cast<int>(timeout.count()));
+    }
+
+    m_parked.store(false, std::memory_order_relaxed);
+}
+
+void Worker::wake() const
+{
+    if (m_parked.load())
+    {
+        ucp_worker_signal(m_handle);
+    }
+}
+
 const std::string& Worker::address()
 {
     if (m_address_pointer == nullptr)
@@ -24,6 +24,8 @@
 
 #include <ucp/api/ucp_def.h>  // for ucp_worker_h, ucp_address_t
 
+#include <atomic>
+#include <chrono>
 #include <cstddef>  // for size_t
 #include <string>
 
@@ -39,6 +41,22 @@ class Worker : public Primitive<ucp_worker_h>
 
     unsigned progress();
 
+    /**
+     * @brief Block the calling thread until the worker has events to progress, wake() is called or timeout expires.
+     *
+     * Returns immediately if the worker has pending events; callers must progress the worker until progress() returns 0
+     * before parking.
+     */
+    void park(std::chrono::milliseconds timeout);
+
+    /**
+     * @brief Wake a thread blocked in park(); a relaxed load when no thread is parked. Thread-safe.
+     *
+     * Operations posted to the worker from threads other than the one progressing it should call wake() so they are
+     * not delayed by up to the park timeout.
+     */
+    void wake() const;
+
     const std::string& address();
     void release_address();
 
@@ -51,6 +69,10 @@ class Worker : public Primitive<ucp_worker_h>
     std::string m_address;
     ucp_address_t* m_address_pointer;
     std::size_t m_address_length;
+
+    // epoll set containing the worker's event fd, used to park
+    int m_epoll_fd{-1};
+    std::atomic_bool m_parked{false};
 };
 
 }  // namespace mrc::internal::ucx
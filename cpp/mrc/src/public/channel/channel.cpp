@@ -24,7 +24,9 @@
 
 namespace mrc::channel {
 
-static std::size_t s_default_channel_size = MRC_DEFAULT_BUFFERED_CHANNEL_SIZE;
+static std::size_t s_default_channel_size         = MRC_DEFAULT_BUFFERED_CHANNEL_SIZE;
+static std::size_t s_cross_partition_channel_size = 0;
+static bool s_lock_free_edge_channels             = true;
 
 std::size_t default_channel_size()
 {
@@ -40,6 +42,30 @@ void set_default_channel_size(std::size_t default_size)
     s_default_channel_size = default_size;
 }
 
+std::size_t cross_partition_channel_size()
+{
+    return s_cross_partition_channel_size == 0 ? 4 * s_default_channel_size : s_cross_partition_channel_size;
+}
+
+void set_cross_partition_channel_size(std::size_t size)
+{
+    if (size != 0 && (size < 2 || ((size & (size - 1)) != 0)))
+    {
+        throw std::invalid_argument("cross_partition_channel_size must be 0, or greater than 1 and a power of 2.");
+    }
+    s_cross_partition_channel_size = size;
+}
+
+bool lock_free_edge_channels()
+{
+    return s_lock_free_edge_channels;
+}
+
+void set_lock_free_edge_channels(bool enabled)
+{
+    s_lock_free_edge_channels = enabled;
+}
+
 ChannelBase::~ChannelBase() = default;
 
 }  // namespace mrc::channel
@@ -38,13 +38,28 @@
 
 #include "mrc/coroutines/thread_pool.hpp"
 
+#include <algorithm>
 #include <cstddef>
+#include <cstdint>
 #include <future>
 #include <iostream>
+#include <random>
 #include <stdexcept>
 
 namespace mrc::coroutines {
 
+namespace {
+
+// Consecutive tasks a worker may take from its LIFO slot before the slot is demoted to the local queue; bounds the
+// starvation of the local queue by coroutines which keep resuming one another
+constexpr std::uint32_t MaxLifoPolls = 3;
+
+// A worker checks the injection queue before its own queue every this many tasks so tasks scheduled from outside of
+// the pool are not starved by a busy local queue
+constexpr std::uint32_t InjectionInterval = 61;
+
+}  // namespace
+
 thread_local ThreadPool* ThreadPool::m_self{nullptr};
 thread_local std::size_t ThreadPool::m_thread_id{0};
 
@@ -98,6 +113,12 @@ ThreadPool::ThreadPool(Options opts) : m_opts(std::move(opts))
         m_opts.description = ss.str();
     }
 
+    m_workers.reserve(m_opts.thread_count);
+    for (uint32_t i = 0; i < m_opts.thread_count; ++i)
+    {
+        m_workers.emplace_back(std::make_unique<Worker>());
+    }
+
     m_threads.reserve(m_opts.thread_count);
 
     for (uint32_t i = 0; i < m_opts.thread_count; ++i)
@@ -132,7 +153,12 @@ auto ThreadPool::resume(std::coroutine_handle<> handle) noexcept -> void
     }
 
     m_size.fetch_add(1, std::memory_order::release);
-    schedule_impl(handle);
+
+    // a coroutine resumed from one of our executor threads runs next on that thread
+    if (push(handle, true))
+    {
+        wake_one();
+    }
 }
 
 auto ThreadPool::shutdown() noexcept -> void
@@ -160,34 +186,36 @@ auto ThreadPool::executor(std::stop_token stop_token, std::size_t idx) -> void
     m_self      = this;
     m_thread_id = idx;
 
+    auto& worker = *m_workers[idx];
+
+    // shutdown() requests a stop on every thread; wake this one if it is parked so it can drain and exit
+    std::stop_callback on_stop(stop_token, [this, &worker] {
+        unpark(worker);
+    });
+
     if (m_opts.on_thread_start_functor != nullptr)
     {
         m_opts.on_thread_start_functor(idx);
     }
 
-    while (!stop_token.stop_requested())
+    while (true)
     {
-        // Wait until the queue has operations to execute or shutdown has been requested.
-        while (true)
-        {
-            std::unique_lock<std::mutex> lk{m_wait_mutex};
-            m_wait_cv.wait(lk, stop_token, [this] {
-                return !m_queue.empty();
-            });
-            if (m_queue.empty())
-            {
-                lk.unlock();  // would happen on scope destruction, but being explicit/faster(?)
-                break;
-            }
-
-            auto handle = m_queue.front();
-            m_queue.pop_front();
-
-            lk.unlock();  // Not needed for processing the coroutine.
+        auto handle = next_handle(worker, idx);
 
+        if (handle != nullptr)
+        {
             handle.resume();
             m_size.fetch_sub(1, std::memory_order::release);
+            continue;
+        }
+
+        // all tasks which were reachable by this thread have completed
+        if (stop_token.stop_requested())
+        {
+            break;
         }
+
+        park(worker, stop_token);
     }
 
     if (m_opts.on_thread_stop_functor != nullptr)
@@ -203,12 +231,214 @@ auto ThreadPool::schedule_impl(std::coroutine_handle<> handle) noexcept -> void
         return;
     }
 
+    if (push(handle, false))
+    {
+        wake_one();
+    }
+}
+
+auto ThreadPool::push(std::coroutine_handle<> handle, bool lifo) noexcept -> bool
+{
+    auto* worker = current_worker();
+
+    if (worker == nullptr)
+    {
+        inject(handle);
+        return true;
+    }
+
+    // only the first coroutine resumed by the running task takes the slot; later ones queue behind it so a batch of
+    // resumptions, e.g. the waiters of an event, still runs in the order it was resumed
+    if (lifo && worker->lifo_slot.load(std::memory_order::relaxed) == nullptr)
     {
-        std::scoped_lock lk{m_wait_mutex};
-        m_queue.emplace_back(handle);
+        worker->lifo_slot.store(handle.address(), std::memory_order::relaxed);
+        return false;
     }
 
-    m_wait_cv.notify_one();
+    if (!worker->queue.push(handle))
+    {
+        inject(handle);
+    }
+
+    return true;
+}
+
+auto ThreadPool::inject(std::coroutine_handle<> handle) noexcept -> void
+{
+    std::scoped_lock lk{m_injection_mutex};
+    m_injection_queue.emplace_back(handle);
+    m_injection_size.fetch_add(1, std::memory_order::release);
+}
+
+auto ThreadPool::next_handle(Worker& worker, std::size_t idx) noexcept -> std::coroutine_handle<>
+{
+    if (++worker.tick % InjectionInterval == 0)
+    {
+        if (auto handle = pop_injected(worker); handle != nullptr)
+        {
+            return handle;
+        }
+    }
+
+    if (auto* address = worker.lifo_slot.exchange(nullptr, std::memory_order::relaxed); address != nullptr)
+    {
+        auto handle = std::coroutine_handle<>::from_address(address);
+        if (worker.lifo_polls < MaxLifoPolls)
+        {
+            ++worker.lifo_polls;
+            return handle;
+        }
+
+        if (!worker.queue.push(handle))
+        {
+            inject(handle);
+        }
+        wake_one();
+    }
+
+    worker.lifo_polls = 0;
+
+    if (auto handle = worker.queue.pop(); handle != nullptr)
+    {
+        return handle;
+    }
+
+    if (auto handle = pop_injected(worker); handle != nullptr)
+    {
+        return handle;
+    }
+
+    return steal(worker, idx);
+}
+
+auto ThreadPool::pop_injected(Worker& worker) noexcept -> std::coroutine_handle<>
+{
+    if (m_injection_size.load(std::memory_order::acquire) == 0)
+    {
+        return nullptr;
+    }
+
+    std::coroutine_handle<> handle{nullptr};
+    bool moved{false};
+
+    {
+        std::scoped_lock lk{m_injection_mutex};
+
+        if (m_injection_queue.empty())
+        {
+            return nullptr;
+        }
+
+        handle = m_injection_queue.front();
+        m_injection_queue.pop_front();
+
+        // take a fair share of the remaining tasks so the lock is not taken once per task
+        auto batch = std::min(m_injection_queue.size() / m_workers.size(), detail::WorkerQueue::Capacity / 2);
+        while (batch > 0 && worker.queue.push(m_injection_queue.front()))
+        {
+            m_injection_queue.pop_front();
+            moved = true;
+            --batch;
+        }
+
+        m_injection_size.store(m_injection_queue.size(), std::memory_order::release);
+    }
+
+    if (moved)
+    {
+        wake_one();
+    }
+
+    return handle;
+}
+
+auto ThreadPool::steal(Worker& worker, std::size_t idx) noexcept -> std::coroutine_handle<>
+{
+    static thread_local std::minstd_rand generator{std::random_device{}()};
+
+    const auto count = m_workers.size();
+    const auto start = generator() % count;
+
+    for (std::size_t i = 0; i < count; ++i)
+    {
+        const auto victim = (start + i) % count;
+        if (victim == idx)
+        {
+            continue;
+        }
+
+        auto handle = m_workers[victim]->queue.steal_into(worker.queue);
+        if (handle != nullptr)
+        {
+            // more than one task was stolen; let another idle thread help
+            if (!worker.queue.empty())
+            {
+                wake_one();
+            }
+            return handle;
+        }
+    }
+
+    return nullptr;
+}
+
+auto ThreadPool::park(Worker& worker, const std::stop_token& stop_token) noexcept -> void
+{
+    // announce that we are parking before the final check for work; producers publish work before checking the parked
+    // count, so either we see their work here or they see us parked and wake us
+    worker.parked.store(1, std::memory_order::seq_cst);
+    m_parked_count.fetch_add(1, std::memory_order::seq_cst);
+    std::atomic_thread_fence(std::memory_order::seq_cst);
+
+    bool has_work = stop_token.stop_requested() || m_injection_size.load(std::memory_order::acquire) > 0;
+    for (std::size_t i = 0; !has_work && i < m_workers.size(); ++i)
+    {
+        has_work = !m_workers[i]->queue.empty();
+    }
+
+    if (has_work)
+    {
+        unpark(worker);
+        return;
+    }
+
+    // returns once a waker has reset the flag
+    worker.parked.wait(1, std::memory_order::acquire);
+}
+
+auto ThreadPool::wake_one() noexcept -> void
+{
+    std::atomic_thread_fence(std::memory_order::seq_cst);
+
+    if (m_parked_count.load(std::memory_order::relaxed) == 0)
+    {
+        return;
+    }
+
+    for (auto& worker : m_workers)
+    {
+        std::uint32_t expected = 1;
+        if (worker->parked.compare_exchange_strong(expected, 0, std::memory_order::acq_rel))
+        {
+            m_parked_count.fetch_sub(1, std::memory_order::relaxed);
+            worker->parked.notify_one();
+            return;
+        }
+    }
+}
+
+auto ThreadPool::unpark(Worker& worker) noexcept -> void
+{
+    if (worker.parked.exchange(0, std::memory_order::acq_rel) == 1)
+    {
+        m_parked_count.fetch_sub(1, std::memory_order::relaxed);
+        worker.parked.notify_one();
+    }
+}
+
+auto ThreadPool::current_worker() noexcept -> Worker*
+{
+    return m_self == this ? m_workers[m_thread_id].get() : nullptr;
 }
 
 auto ThreadPool::from_current_thread() -> ThreadPool*
@@ -0,0 +1,106 @@
+/**
+ * SPDX-FileCopyrightText: Copyright (c) 2023, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "mrc/manifold/load_balancing_policy.hpp"
+
+#include <glog/logging.h>
+
+#include <cstddef>
+#include <memory>
+#include <random>
+
+namespace mrc::manifold {
+
+static LoadBalancingPolicyType s_default_load_balancing_policy = LoadBalancingPolicyType::LeastQueueDepth;
+
+std::size_t RoundRobinPolicy::select(std::size_t output_count, const queue_depth_fn_t& /*queue_depth*/)
+{
+    if (m_next >= output_count)
+    {
+        m_next = 0;
+    }
+    return m_next++;
+}
+
+std::size_t LeastQueueDepthPolicy::select(std::size_t output_count, const queue_depth_fn_t& queue_depth)
+{
+    if (m_start >= output_count)
+    {
+        m_start = 0;
+    }
+
+    auto best       = m_start;
+    auto best_depth = queue_depth(best);
+
+    for (std::size_t i = 1; i < output_count && best_depth > 0; ++i)
+    {
+        const auto idx   = (m_start + i) % output_count;
+        const auto depth = queue_depth(idx);
+        if (depth < best_depth)
+        {
+            best       = idx;
+            best_depth = depth;
+        }
+    }
+
+    m_start = best + 1;
+    return best;
+}
+
+PowerOfTwoChoicesPolicy::PowerOfTwoChoicesPolicy() : m_generator(std::random_device{}()) {}
+
+std::size_t PowerOfTwoChoicesPolicy::select(std::size_t output_count, const queue_depth_fn_t& queue_depth)
+{
+    if (output_count == 1)
+    {
+        return 0;
+    }
+
+    // two distinct samples: the second is drawn from the remaining outputs and shifted past the first
+    const auto first  = m_generator() % output_count;
+    auto second       = m_generator() % (output_count - 1);
+    second           += (second >= first) ? 1 : 0;
+
+    return queue_depth(second) < queue_depth(first) ? second : first;
+}
+
+std::unique_ptr<LoadBalancingPolicy> make_load_balancing_policy(LoadBalancingPolicyType type)
+{
+    switch (type)
+    {
+    case LoadBalancingPolicyType::RoundRobin:
+        return std::make_unique<RoundRobinPolicy>();
+    case LoadBalancingPolicyType::LeastQueueDepth:
+        return std::make_unique<LeastQueueDepthPolicy>();
+    case LoadBalancingPolicyType::PowerOfTwoChoices:
+        return std::make_unique<PowerOfTwoChoicesPolicy>();
+    }
+    LOG(FATAL) << "unknown load balancing policy";
+    return nullptr;
+}
+
+LoadBalancingPolicyType default_load_balancing_policy()
+{
+    return s_default_load_balancing_policy;
+}
+
+void set_default_load_balancing_policy(LoadBalancingPolicyType type)
+{
+    s_default_load_balancing_policy = type;
+}
+
+}  // namespace mrc::manifold
@@ -32,6 +32,13 @@ void codable_protocol<mrc::memory::buffer>::serialize(const memory::buffer& obj,
                                                       Encoder<memory::buffer>& encoded,
                                                       const EncodingOptions& opts)
 {
+    if (opts.force_copy())
+    {
+        auto index = encoded.create_memory_buffer(obj.bytes());
+        encoded.copy_to_buffer(index, obj);
+        return;
+    }
+
     auto idx = encoded.register_memory_view(obj);
     if (!idx)
     {
@@ -41,15 +48,34 @@ void codable_protocol<mrc::memory::buffer>::serialize(const memory::buffer& obj,
 
 memory::buffer codable_protocol<mrc::memory::buffer>::deserialize(const Decoder<memory::buffer>& encoded,
                                                                   std::size_t object_idx)
+{
+    mrc::memory::buffer buffer;
+    deserialize_into(encoded, object_idx, buffer);
+    return buffer;
+}
+
+void codable_protocol<mrc::memory::buffer>::deserialize_into(const Decoder<memory::buffer>& encoded,
+                                                             std::size_t object_idx,
+                                                             memory::buffer& dst)
 {
     DCHECK_EQ(std::type_index(typeid(memory::buffer)).hash_code(), encoded.type_index_hash_for_object(object_idx));
     auto idx   = encoded.start_idx_for_object(object_idx);
     auto bytes = encoded.buffer_size(idx);
 
-    mrc::memory::buffer buffer(bytes, encoded.host_memory_resource());
-    encoded.copy_from_buffer(idx, buffer);
+    if (bytes == 0)
+    {
+        dst.release();
+        return;
+    }
+
+    if (dst.empty() || dst.bytes() != bytes || dst.kind() != memory::memory_kind::host)
+    {
+        // move assignment does not free the previous allocation
+        dst.release();
+        dst = mrc::memory::buffer(bytes, encoded.host_memory_resource());
+    }
 
-    return std::move(buffer);
+    encoded.copy_from_buffer(idx, dst);
 }
 
 }  // namespace mrc::codable
@@ -1,5 +1,5 @@
 /**
- * SPDX-FileCopyrightText: Copyright (c) 2021-2023, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-FileCopyrightText: Copyright (c) 2022-2023, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
  * SPDX-License-Identifier: Apache-2.0
  *
  * Licensed under the Apache License, Version 2.0 (the "License");
@@ -17,20 +17,20 @@
 
 #include "mrc/metrics/counter.hpp"
 
-#include <prometheus/counter.h>
+#include <glog/logging.h>
 
-namespace mrc::metrics {
+#include <utility>
 
-Counter::Counter(prometheus::Counter* counter) : m_counter(counter) {}
+namespace mrc::metrics {
 
-void Counter::increment()
+Counter::Counter(std::shared_ptr<cells_t> cells) : m_cells(std::move(cells))
 {
-    m_counter->Increment();
+    CHECK(m_cells);
 }
 
-void Counter::increment(const std::size_t& ticks)
+std::uint64_t Counter::value() const
 {
-    m_counter->Increment(ticks);
+    return m_cells->sum();
 }
 
 }  // namespace mrc::metrics
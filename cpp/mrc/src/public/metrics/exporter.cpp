@@ -0,0 +1,274 @@
+/**
+ * SPDX-FileCopyrightText: Copyright (c) 2022-2023, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "mrc/metrics/exporter.hpp"
+
+#include "mrc/exceptions/runtime_error.hpp"
+#include "mrc/metrics/registry.hpp"
+#include "mrc/tracing/event_trace.hpp"
+
+#include <arpa/inet.h>
+#include <glog/logging.h>
+#include <netinet/in.h>
+#include <poll.h>
+#include <sys/socket.h>
+#include <sys/time.h>
+#include <unistd.h>
+
+#include <array>
+#include <cerrno>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <sstream>
+#include <utility>
+
+namespace mrc::metrics {
+
+namespace {
+
+// how often the server thread checks whether it has been stopped
+constexpr int PollTimeoutMs = 100;
+
+// requests for the metrics endpoint are a request line and a handful of headers
+constexpr std::size_t MaxRequestBytes = 8192;
+
+void send_all(int fd, const std::string& data)
+{
+    std::size_t sent = 0;
+    while (sent < data.size())
+    {
+        auto rc = ::send(fd, data.data() + sent, data.size() - sent, MSG_NOSIGNAL);
+        if (rc < 0 && errno == EINTR)
+        {
+            continue;
+        }
+        if (rc <= 0)
+        {
+            return;
+        }
+        sent += static_cast<std::size_t>(rc);
+    }
+}
+
+std::string http_response(const std::string& status, const std::string& content_type, const std::string& body)
+{
+    std::ostringstream ss;
+    ss << "HTTP/1.1 " << status << "\r\n"
+       << "Content-Type: " << content_type << "\r\n"
+       << "Content-Length: " << body.size() << "\r\n"
+       << "Connection: close\r\n\r\n"
+       << body;
+    return ss.str();
+}
+
+}  // namespace
+
+Exporter::Exporter(const Registry& registry) : m_registry(registry) {}
+
+Exporter::~Exporter()
+{
+    stop();
+}
+
+std::uint16_t Exporter::serve(const std::string& address, std::uint16_t port)
+{
+    CHECK(!m_server.joinable()) << "the metrics exporter is already serving";
+
+    sockaddr_in addr{};
+    addr.sin_family = AF_INET;
+    addr.sin_port   = htons(port);
+    if (::inet_pton(AF_INET, address.c_str(), &addr.sin_addr) != 1)
+    {
+        throw exceptions::MrcRuntimeError("invalid metrics export address: " + address);
+    }
+
+    m_listen_fd = ::socket(AF_INET, SOCK_STREAM | SOCK_CLOEXEC, 0);
+    if (m_listen_fd < 0)
+    {
+        throw exceptions::MrcRuntimeError(std::string("unable to create the metrics socket: ") + std::strerror(errno));
+    }
+
+    int reuse = 1;
+    ::setsockopt(m_listen_fd, SOL_SOCKET, SO_REUSEADDR, &reuse, sizeof(reuse));
+
+    socklen_t addr_len = sizeof(addr);
+    if (::bind(m_listen_fd, reinterpret_cast<sockaddr*>(&addr), sizeof(addr)) != 0 || ::listen(m_listen_fd, 16) != 0 ||
+        ::getsockname(m_listen_fd, reinterpret_cast<sockaddr*>(&addr), &addr_len) != 0)
+    {
+        auto error = std::string(std::strerror(errno));
+        ::close(m_listen_fd);
+        m_listen_fd = -1;
+        throw exceptions::MrcRuntimeError("unable to serve metrics on " + address + ":" + std::to_string(port) + ": " +
+                                          error);
+    }
+
+    const auto bound_port = ntohs(addr.sin_port);
+    VLOG(1) << "serving metrics at http://" << address << ":" << bound_port << "/metrics";
+
+    m_server = std::thread([this] {
+        serve_loop();
+    });
+    return bound_port;
+}
+
+void Exporter::write_periodically(std::string path, std::chrono::milliseconds interval)
+{
+    CHECK(!m_writer.joinable()) << "the metrics exporter is already writing a file";
+
+    m_writer = std::thread([this, path = std::move(path), interval] {
+        std::unique_lock<decltype(m_mutex)> lock(m_mutex);
+        while (m_running)
+        {
+            lock.unlock();
+            write(path);
+            lock.lock();
+            m_cv.wait_for(lock, interval, [this] {
+                return !m_running;
+            });
+        }
+        lock.unlock();
+
+        // the final values of a finished pipeline
+        write(path);
+    });
+}
+
+void Exporter::write(const std::string& path) const
+{
+    const auto tmp_path = path + ".tmp";
+    {
+        std::ofstream file(tmp_path, std::ios::out | std::ios::trunc);
+        file << m_registry.serialize();
+        if (!file)
+        {
+            LOG(WARNING) << "unable to write metrics to " << tmp_path;
+            return;
+        }
+    }
+
+    std::error_code ec;
+    std::filesystem::rename(tmp_path, path, ec);
+    if (ec)
+    {
+        LOG(WARNING) << "unable to replace " << path << ": " << ec.message();
+    }
+}
+
+void Exporter::stop()
+{
+    {
+        std::lock_guard<decltype(m_mutex)> lock(m_mutex);
+        m_running = false;
+    }
+    m_cv.notify_all();
+
+    if (m_server.joinable())
+    {
+        m_server.join();
+    }
+    if (m_writer.joinable())
+    {
+        m_writer.join();
+    }
+    if (m_listen_fd >= 0)
+    {
+        ::close(m_listen_fd);
+        m_listen_fd = -1;
+    }
+}
+
+void Exporter::serve_loop()
+{
+    pollfd pfd{};
+    pfd.fd     = m_listen_fd;
+    pfd.events = POLLIN;
+
+    while (m_running)
+    {
+        if (::poll(&pfd, 1, PollTimeoutMs) <= 0 || (pfd.revents & POLLIN) == 0)
+        {
+            continue;
+        }
+
+        int fd = ::accept4(m_listen_fd, nullptr, nullptr, SOCK_CLOEXEC);
+        if (fd < 0)
+        {
+            continue;
+        }
+
+        handle_connection(fd);
+        ::close(fd);
+    }
+}
+
+void Exporter::handle_connection(int fd) const
+{
+    // a slow or idle client must not stall the scrape loop
+    timeval timeout{};
+    timeout.tv_sec = 1;
+    ::setsockopt(fd, SOL_SOCKET, SO_RCVTIMEO, &timeout, sizeof(timeout));
+
+    std::string request;
+    std::array<char, 1024> buffer{};
+    while (request.find("\r\n\r\n") == std::string::npos && request.size() < MaxRequestBytes)
+    {
+        auto rc = ::recv(fd, buffer.data(), buffer.size(), 0);
+        if (rc < 0 && errno == EINTR)
+        {
+            continue;
+        }
+        if (rc <= 0)
+        {
+            break;
+        }
+        request.append(buffer.data(), static_cast<std::size_t>(rc));
+    }
+
+    // request line: METHOD SP PATH SP VERSION
+    std::istringstream request_line(request.substr(0, request.find("\r\n")));
+    std::string method;
+    std::string path;
+    request_line >> method >> path;
+
+    if (method != "GET")
+    {
+        send_all(fd, http_response("405 Method Not Allowed", "text/plain", "only GET is supported\n"));
+        return;
+    }
+    if (path == "/metrics" || path == "/")
+    {
+        send_all(fd, http_response("200 OK", "text/plain; version=0.0.4; charset=utf-8", m_registry.serialize()));
+    }
+    else if (path == "/trace")
+    {
+        std::ostringstream trace;
+        tracing::dump_chrome_trace(trace);
+        send_all(fd, http_response("200 OK", "application/json", trace.str()));
+    }
+    else if (path == "/trace/enable" || path == "/trace/disable")
+    {
+        tracing::set_enabled(path == "/trace/enable");
+        send_all(fd, http_response("200 OK", "text/plain", tracing::is_enabled() ? "enabled\n" : "disabled\n"));
+    }
+    else
+    {
+        send_all(fd, http_response("404 Not Found", "text/plain", "metrics are served at /metrics\n"));
+    }
+}
+
+}  // namespace mrc::metrics
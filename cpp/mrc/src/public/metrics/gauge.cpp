@@ -0,0 +1,41 @@
+/**
+ * SPDX-FileCopyrightText: Copyright (c) 2022-2023, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "mrc/metrics/gauge.hpp"
+
+#include <glog/logging.h>
+
+#include <utility>
+
+namespace mrc::metrics {
+
+Gauge::Gauge(std::shared_ptr<cells_t> cells) : m_cells(std::move(cells))
+{
+    CHECK(m_cells);
+}
+
+void Gauge::set(std::int64_t value)
+{
+    m_cells->add(value - m_cells->sum());
+}
+
+std::int64_t Gauge::value() const
+{
+    return m_cells->sum();
+}
+
+}  // namespace mrc::metrics
@@ -0,0 +1,90 @@
+/**
+ * SPDX-FileCopyrightText: Copyright (c) 2022-2023, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "mrc/metrics/histogram.hpp"
+
+#include <glog/logging.h>
+
+#include <algorithm>
+#include <cmath>
+#include <utility>
+
+namespace mrc::metrics {
+
+std::uint64_t HistogramSnapshot::quantile(double q) const
+{
+    if (count == 0)
+    {
+        return 0;
+    }
+
+    q = std::clamp(q, 0.0, 1.0);
+
+    // rank of the requested value among the recorded values, starting at one
+    const auto rank = std::max<std::uint64_t>(1, static_cast<std::uint64_t>(std::ceil(q * static_cast<double>(count))));
+
+    std::uint64_t seen = 0;
+    for (std::size_t i = 0; i < buckets.size(); ++i)
+    {
+        seen += buckets[i];
+        if (seen >= rank)
+        {
+            return HistogramBuckets::upper_bound(i);
+        }
+    }
+    return HistogramBuckets::upper_bound(buckets.size() - 1);
+}
+
+std::uint64_t HistogramSnapshot::count_below(std::uint64_t bound) const
+{
+    std::uint64_t total = 0;
+    for (std::size_t i = 0; i < buckets.size() && HistogramBuckets::upper_bound(i) < bound; ++i)
+    {
+        total += buckets[i];
+    }
+    return total;
+}
+
+Histogram::Histogram(std::shared_ptr<cells_t> cells) : m_cells(std::move(cells))
+{
+    CHECK(m_cells);
+}
+
+HistogramSnapshot Histogram::snapshot() const
+{
+    HistogramSnapshot snapshot;
+    snapshot.buckets.resize(HistogramBuckets::BucketCount, 0);
+
+    for (const auto& shard : m_cells->shards)
+    {
+        for (std::size_t i = 0; i < HistogramBuckets::BucketCount; ++i)
+        {
+            snapshot.buckets[i] += shard.buckets[i].load(std::memory_order_relaxed);
+        }
+        snapshot.sum += shard.sum.load(std::memory_order_relaxed);
+    }
+
+    // the count is derived from the buckets so that it is always consistent with them
+    for (const auto& bucket : snapshot.buckets)
+    {
+        snapshot.count += bucket;
+    }
+
+    return snapshot;
+}
+
+}  // namespace mrc::metrics
@@ -0,0 +1,174 @@
+/**
+ * SPDX-FileCopyrightText: Copyright (c) 2022-2023, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "mrc/metrics/node_metrics.hpp"
+
+#include "mrc/core/watcher.hpp"
+
+#include <boost/fiber/fss.hpp>
+#include <glog/logging.h>
+
+#include <chrono>
+#include <cstdint>
+#include <utility>
+
+namespace mrc::metrics {
+
+namespace {
+
+std::int64_t now_ns()
+{
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now().time_since_epoch())
+        .count();
+}
+
+/**
+ * The progress engine of a sink reads a batch from its channel, then pushes each value through the operators on the
+ * same thread. A value is therefore finished when the engine moves on to the next value of the batch or returns to
+ * the channel, which is when the processing time is recorded.
+ *
+ * Several engines of a node may share a thread, so the state of an engine is fiber local. Values pushed inline by a
+ * fused upstream never arrive after a channel read, so they are counted but not timed.
+ */
+class SinkWatcher final : public WatcherInterface
+{
+  public:
+    SinkWatcher(Counter received, Gauge in_flight, Histogram processing) :
+      m_received(std::move(received)),
+      m_in_flight(std::move(in_flight)),
+      m_processing(std::move(processing))
+    {}
+
+    void on_entry(const WatchableEvent& event, const void* /*data*/) final
+    {
+        auto& state = engine();
+
+        if (event == WatchableEvent::sink_on_data)
+        {
+            m_received.increment();
+            if (state.reading)
+            {
+                const auto now = now_ns();
+                finish(std::exchange(state.started, now), now);
+                m_in_flight.increment();
+            }
+        }
+        else if (event == WatchableEvent::channel_read)
+        {
+            state.reading = false;
+            finish(std::exchange(state.started, 0), now_ns());
+        }
+    }
+
+    void on_exit(const WatchableEvent& event, bool /*rc*/, const void* /*data*/) final
+    {
+        if (event == WatchableEvent::channel_read)
+        {
+            engine().reading = true;
+        }
+    }
+
+  private:
+    struct Engine
+    {
+        std::int64_t started{0};
+        bool reading{false};
+    };
+
+    Engine& engine()
+    {
+        auto* state = m_engines.get();
+        if (state == nullptr)
+        {
+            state = new Engine;
+            m_engines.reset(state);
+        }
+        return *state;
+    }
+
+    void finish(std::int64_t started, std::int64_t now)
+    {
+        if (started == 0)
+        {
+            return;
+        }
+        m_processing.record(static_cast<std::uint64_t>(now > started ? now - started : 0));
+        m_in_flight.decrement();
+    }
+
+    Counter m_received;
+    Gauge m_in_flight;
+    Histogram m_processing;
+    boost::fibers::fiber_specific_ptr<Engine> m_engines;
+};
+
+class SourceWatcher final : public WatcherInterface
+{
+  public:
+    SourceWatcher(Counter emitted) : m_emitted(std::move(emitted)) {}
+
+    void on_entry(const WatchableEvent& /*event*/, const void* /*data*/) final {}
+
+    void on_exit(const WatchableEvent& event, bool /*rc*/, const void* /*data*/) final
+    {
+        // a source reports the end of the operator chain as the exit of sink_on_data, just before writing the value
+        if (event == WatchableEvent::sink_on_data)
+        {
+            m_emitted.increment();
+        }
+    }
+
+  private:
+    Counter m_emitted;
+};
+
+}  // namespace
+
+NodeMetrics::NodeMetrics(Registry& registry, Registry::labels_t labels) :
+  m_registry(registry),
+  m_labels(std::move(labels)),
+  m_received(registry.make_counter("mrc_node_received_total", m_labels)),
+  m_emitted(registry.make_counter("mrc_node_emitted_total", m_labels)),
+  m_in_flight(registry.make_gauge("mrc_node_in_flight", m_labels)),
+  m_processing(registry.make_histogram("mrc_node_processing_seconds", m_labels, 1e-9))
+{
+    registry.set_help("mrc_node_received_total", "values a node took from its input");
+    registry.set_help("mrc_node_emitted_total", "values a node wrote to its output");
+    registry.set_help("mrc_node_in_flight", "values a node is processing");
+    registry.set_help("mrc_node_processing_seconds", "time a node spent on each value taken from its input");
+    registry.set_help("mrc_node_queue_depth", "values waiting in the input channel of a node");
+}
+
+std::shared_ptr<WatcherInterface> NodeMetrics::sink_watcher() const
+{
+    return std::make_shared<SinkWatcher>(m_received, m_in_flight, m_processing);
+}
+
+std::shared_ptr<WatcherInterface> NodeMetrics::source_watcher() const
+{
+    return std::make_shared<SourceWatcher>(m_emitted);
+}
+
+void NodeMetrics::set_queue_depth_fn(std::function<std::size_t()> queue_depth_fn)
+{
+    CHECK(queue_depth_fn);
+    m_registry.make_callback_gauge("mrc_node_queue_depth", m_labels, [queue_depth_fn = std::move(queue_depth_fn)] {
+        return static_cast<double>(queue_depth_fn());
+    });
+}
+
+}  // namespace mrc::metrics
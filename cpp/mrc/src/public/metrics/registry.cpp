@@ -1,5 +1,5 @@
 /**
- * SPDX-FileCopyrightText: Copyright (c) 2021-2023, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-FileCopyrightText: Copyright (c) 2022-2023, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
  * SPDX-License-Identifier: Apache-2.0
  *
  * Licensed under the Apache License, Version 2.0 (the "License");
@@ -17,55 +17,324 @@
 
 #include "mrc/metrics/registry.hpp"
 
-#include "prometheus/metric_family.h"
-
+#include "mrc/exceptions/runtime_error.hpp"
 #include "mrc/metrics/counter.hpp"
+#include "mrc/metrics/gauge.hpp"
+#include "mrc/metrics/histogram.hpp"
 
 #include <glog/logging.h>
-#include <prometheus/client_metric.h>
-#include <prometheus/counter.h>
-#include <prometheus/family.h>
-#include <prometheus/registry.h>
 
+#include <cmath>
+#include <cstdint>
+#include <functional>
+#include <iomanip>
+#include <limits>
 #include <map>
 #include <memory>
+#include <optional>
+#include <sstream>
 #include <string>
+#include <type_traits>
 #include <utility>
+#include <variant>
 #include <vector>
 
 namespace mrc::metrics {
 
-Registry::Registry() :
-  m_registry(std::make_shared<prometheus::Registry>()),
-  m_throughput_counters(prometheus::BuildCounter()
-                            .Name("mrc_throughput_counters")
-                            .Help("number of data elements passing thru a given pipeline object")
-                            .Register(*m_registry))
-{}
+enum class Registry::Type
+{
+    counter,
+    gauge,
+    histogram,
+};
+
+namespace {
+
+using sample_fn_t = std::function<double()>;
+using metric_t    = std::variant<std::monostate,
+                              std::shared_ptr<Counter::cells_t>,
+                              std::shared_ptr<Gauge::cells_t>,
+                              sample_fn_t,
+                              std::shared_ptr<Histogram::cells_t>>;
+
+constexpr const char* ThroughputCounters = "mrc_throughput_counters";
+
+// histograms are exported with a cumulative bucket at every fourth power of two, 2^0 to 2^40; for nanosecond
+// latencies this spans 1ns to roughly 18 minutes
+constexpr std::size_t ExportedBucketStep = 2;
+constexpr std::size_t ExportedBucketMax  = 40;
+
+std::string format_value(double value)
+{
+    if (std::isnan(value))
+    {
+        return "NaN";
+    }
+    if (std::isinf(value))
+    {
+        return value > 0 ? "+Inf" : "-Inf";
+    }
+
+    std::ostringstream ss;
+    ss << std::setprecision(std::numeric_limits<double>::digits10) << value;
+    return ss.str();
+}
+
+void write_label_value(std::ostream& os, const std::string& value)
+{
+    for (const auto c : value)
+    {
+        switch (c)
+        {
+        case '\\':
+            os << "\\\\";
+            break;
+        case '"':
+            os << "\\\"";
+            break;
+        case '\n':
+            os << "\\n";
+            break;
+        default:
+            os << c;
+        }
+    }
+}
+
+void write_labels(std::ostream& os, const Registry::labels_t& labels, const std::string& le = {})
+{
+    if (labels.empty() && le.empty())
+    {
+        return;
+    }
+
+    os << '{';
+    bool first = true;
+    for (const auto& [key, value] : labels)
+    {
+        os << (first ? "" : ",") << key << "=\"";
+        write_label_value(os, value);
+        os << '"';
+        first = false;
+    }
+    if (!le.empty())
+    {
+        os << (first ? "" : ",") << "le=\"" << le << '"';
+    }
+    os << '}';
+}
+
+}  // namespace
+
+struct Registry::Family
+{
+    const char* type_name() const
+    {
+        switch (type.value_or(Type::counter))
+        {
+        case Type::counter:
+            return "counter";
+        case Type::gauge:
+            return "gauge";
+        case Type::histogram:
+            return "histogram";
+        }
+        return "counter";
+    }
+
+    // families created by set_help are typed by the first metric added to them
+    std::optional<Type> type;
+    std::string help;
+    double scale{1.0};
+    std::map<labels_t, metric_t> metrics;
+};
+
+Registry::Registry()
+{
+    set_help(ThroughputCounters, "number of data elements passing thru a given pipeline object");
+}
+
+Registry::~Registry() = default;
+
+Registry::Family& Registry::get_family(const std::string& name, Type type)
+{
+    auto& family = m_families[name];
+    if (!family)
+    {
+        family = std::make_unique<Family>();
+    }
+    if (!family->type)
+    {
+        family->type = type;
+    }
+    else if (*family->type != type)
+    {
+        LOG(ERROR) << "metric " << name << " is registered as a " << family->type_name();
+        throw exceptions::MrcRuntimeError("metric " + name + " was already registered with a different type");
+    }
+    return *family;
+}
 
-Counter Registry::make_counter(std::string name, std::map<std::string, std::string> labels)
+Counter Registry::make_counter(std::string name, labels_t labels)
 {
-    auto& family  = prometheus::BuildCounter().Name(std::move(name)).Register(*m_registry);
-    auto& counter = family.Add(std::move(labels));
-    return Counter(&counter);
+    std::lock_guard<decltype(m_mutex)> lock(m_mutex);
+    auto& metric = get_family(name, Type::counter).metrics[std::move(labels)];
+    if (std::holds_alternative<std::monostate>(metric))
+    {
+        metric = std::make_shared<Counter::cells_t>();
+    }
+    return Counter(std::get<std::shared_ptr<Counter::cells_t>>(metric));
 }
 
 Counter Registry::make_throughput_counter(std::string name)
 {
-    auto& counter = m_throughput_counters.Add({{"name", name}});
-    return Counter(&counter);
+    return make_counter(ThroughputCounters, {{"name", std::move(name)}});
+}
+
+Gauge Registry::make_gauge(std::string name, labels_t labels)
+{
+    std::lock_guard<decltype(m_mutex)> lock(m_mutex);
+    auto& metric = get_family(name, Type::gauge).metrics[std::move(labels)];
+    if (std::holds_alternative<std::monostate>(metric))
+    {
+        metric = std::make_shared<Gauge::cells_t>();
+    }
+    else if (!std::holds_alternative<std::shared_ptr<Gauge::cells_t>>(metric))
+    {
+        throw exceptions::MrcRuntimeError("gauge " + name + " is already registered as a callback gauge");
+    }
+    return Gauge(std::get<std::shared_ptr<Gauge::cells_t>>(metric));
+}
+
+void Registry::make_callback_gauge(std::string name, labels_t labels, std::function<double()> sample_fn)
+{
+    CHECK(sample_fn);
+    std::lock_guard<decltype(m_mutex)> lock(m_mutex);
+    auto& metric = get_family(name, Type::gauge).metrics[std::move(labels)];
+    if (std::holds_alternative<std::shared_ptr<Gauge::cells_t>>(metric))
+    {
+        throw exceptions::MrcRuntimeError("gauge " + name + " is already registered as a sharded gauge");
+    }
+    metric = std::move(sample_fn);
+}
+
+Histogram Registry::make_histogram(std::string name, labels_t labels, double scale)
+{
+    std::lock_guard<decltype(m_mutex)> lock(m_mutex);
+    auto& family = get_family(name, Type::histogram);
+    family.scale = scale;
+
+    auto& metric = family.metrics[std::move(labels)];
+    if (std::holds_alternative<std::monostate>(metric))
+    {
+        metric = std::make_shared<Histogram::cells_t>();
+    }
+    return Histogram(std::get<std::shared_ptr<Histogram::cells_t>>(metric));
+}
+
+void Registry::set_help(const std::string& name, std::string help)
+{
+    std::lock_guard<decltype(m_mutex)> lock(m_mutex);
+    auto& family = m_families[name];
+    if (!family)
+    {
+        family = std::make_unique<Family>();
+    }
+    family->help = std::move(help);
 }
 
 std::vector<CounterReport> Registry::collect_throughput_counters() const
 {
+    std::lock_guard<decltype(m_mutex)> lock(m_mutex);
     std::vector<CounterReport> report;
-    auto collected = m_throughput_counters.Collect();
-    CHECK_EQ(collected.size(), 1);
-    for (auto& metric : collected[0].metric)
+
+    auto search = m_families.find(ThroughputCounters);
+    if (search == m_families.end())
+    {
+        return report;
+    }
+
+    for (const auto& [labels, metric] : search->second->metrics)
     {
-        report.emplace_back(metric.label.at(0).value, metric.counter.value);
+        const auto* cells = std::get_if<std::shared_ptr<Counter::cells_t>>(&metric);
+        if (cells == nullptr || labels.empty())
+        {
+            continue;
+        }
+
+        auto name = labels.find("name");
+        report.emplace_back(name != labels.end() ? name->second : labels.begin()->second, (*cells)->sum());
     }
     return report;
 }
 
+std::string Registry::serialize() const
+{
+    std::lock_guard<decltype(m_mutex)> lock(m_mutex);
+    std::ostringstream os;
+
+    for (const auto& [name, family] : m_families)
+    {
+        if (family->metrics.empty())
+        {
+            continue;
+        }
+
+        if (!family->help.empty())
+        {
+            os << "# HELP " << name << " " << family->help << "\n";
+        }
+        os << "# TYPE " << name << " " << family->type_name() << "\n";
+
+        for (const auto& [labels, metric] : family->metrics)
+        {
+            std::visit(
+                [&, &name = name, &family = family](const auto& value) {
+                    using value_t = std::decay_t<decltype(value)>;
+
+                    if constexpr (std::is_same_v<value_t, std::shared_ptr<Counter::cells_t>> ||
+                                  std::is_same_v<value_t, std::shared_ptr<Gauge::cells_t>>)
+                    {
+                        os << name;
+                        write_labels(os, labels);
+                        os << " " << value->sum() << "\n";
+                    }
+                    else if constexpr (std::is_same_v<value_t, sample_fn_t>)
+                    {
+                        os << name;
+                        write_labels(os, labels);
+                        os << " " << format_value(value()) << "\n";
+                    }
+                    else if constexpr (std::is_same_v<value_t, std::shared_ptr<Histogram::cells_t>>)
+                    {
+                        auto snapshot = Histogram(value).snapshot();
+
+                        for (std::size_t bits = 0; bits <= ExportedBucketMax; bits += ExportedBucketStep)
+                        {
+                            const auto bound = std::uint64_t{1} << bits;
+                            os << name << "_bucket";
+                            write_labels(os, labels, format_value(static_cast<double>(bound) * family->scale));
+                            os << " " << snapshot.count_below(bound) << "\n";
+                        }
+
+                        os << name << "_bucket";
+                        write_labels(os, labels, "+Inf");
+                        os << " " << snapshot.count << "\n";
+
+                        os << name << "_sum";
+                        write_labels(os, labels);
+                        os << " " << format_value(static_cast<double>(snapshot.sum) * family->scale) << "\n";
+
+                        os << name << "_count";
+                        write_labels(os, labels);
+                        os << " " << snapshot.count << "\n";
+                    }
+                },
+                metric);
+        }
+    }
+
+    return os.str();
+}
+
 }  // namespace mrc::metrics
@@ -0,0 +1,31 @@
+/**
+ * SPDX-FileCopyrightText: Copyright (c) 2022-2023, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "mrc/metrics/detail/sharded_value.hpp"
+
+#include <atomic>
+#include <cstddef>
+
+namespace mrc::metrics::detail {
+
+std::size_t next_thread_shard()
+{
+    static std::atomic<std::size_t> s_next_shard{0};
+    return s_next_shard.fetch_add(1, std::memory_order_relaxed) % MetricShardCount;
+}
+
+}  // namespace mrc::metrics::detail
@@ -0,0 +1,122 @@
+/**
+ * SPDX-FileCopyrightText: Copyright (c) 2023, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "mrc/node/read_batch.hpp"
+
+#include <boost/fiber/fss.hpp>
+
+#include <cstddef>
+#include <utility>
+
+namespace mrc::node {
+
+namespace {
+
+// the fiber does not own its ReadBatch, which lives on the stack of the progress engine
+void no_cleanup(ReadBatch* /*unused*/) {}
+
+boost::fibers::fiber_specific_ptr<ReadBatch>& fiber_local_batch()
+{
+    static boost::fibers::fiber_specific_ptr<ReadBatch> fiber_local(no_cleanup);
+    return fiber_local;
+}
+
+// likewise for the ReadDeadlines of the progress engine
+void no_cleanup(ReadDeadlines* /*unused*/) {}
+
+boost::fibers::fiber_specific_ptr<ReadDeadlines>& fiber_local_deadlines()
+{
+    static boost::fibers::fiber_specific_ptr<ReadDeadlines> fiber_local(no_cleanup);
+    return fiber_local;
+}
+
+}  // namespace
+
+ReadBatch::ReadBatch() : m_previous(fiber_local_batch().get())
+{
+    fiber_local_batch().reset(this);
+}
+
+ReadBatch::~ReadBatch()
+{
+    fiber_local_batch().reset(m_previous);
+}
+
+ReadBatch* ReadBatch::current()
+{
+    return fiber_local_batch().get();
+}
+
+void ReadBatch::defer(std::function<void()> flush_fn)
+{
+    m_flush_fns.push_back(std::move(flush_fn));
+}
+
+void ReadBatch::flush()
+{
+    // callbacks may register further callbacks, so the vector can grow while it is being walked
+    for (std::size_t i = 0; i < m_flush_fns.size(); ++i)
+    {
+        auto flush_fn = std::move(m_flush_fns[i]);
+        flush_fn();
+    }
+    m_flush_fns.clear();
+}
+
+ReadDeadlines::ReadDeadlines() : m_previous(fiber_local_deadlines().get())
+{
+    fiber_local_deadlines().reset(this);
+}
+
+ReadDeadlines::~ReadDeadlines()
+{
+    fiber_local_deadlines().reset(m_previous);
+}
+
+ReadDeadlines* ReadDeadlines::current()
+{
+    return fiber_local_deadlines().get();
+}
+
+void ReadDeadlines::schedule(channel::time_point_t deadline, std::function<void()> callback_fn)
+{
+    m_callbacks.emplace(deadline, std::move(callback_fn));
+}
+
+std::optional<channel::time_point_t> ReadDeadlines::next() const
+{
+    if (m_callbacks.empty())
+    {
+        return std::nullopt;
+    }
+    return m_callbacks.begin()->first;
+}
+
+void ReadDeadlines::run_expired()
+{
+    const auto now = channel::clock_t::now();
+
+    // each callback is removed before it runs, so it may schedule further callbacks
+    while (!m_callbacks.empty() && m_callbacks.begin()->first <= now)
+    {
+        auto callback_fn = std::move(m_callbacks.begin()->second);
+        m_callbacks.erase(m_callbacks.begin());
+        callback_fn();
+    }
+}
+
+}  // namespace mrc::node
@@ -98,4 +98,12 @@ bool EngineGroups::ignore_hyper_threads() const
 {
     return m_ignore_hyper_threads;
 }
+void EngineGroups::set_fuse_operator_chains(bool default_false)
+{
+    m_fuse_operator_chains = default_false;
+}
+bool EngineGroups::fuse_operator_chains() const
+{
+    return m_fuse_operator_chains;
+}
 }  // namespace mrc
@@ -34,6 +34,11 @@ FiberPoolOptions& FiberPoolOptions::enable_tracing_scheduler(bool default_false)
     m_enable_tracing_scheduler = false;
     return *this;
 }
+FiberPoolOptions& FiberPoolOptions::enable_work_stealing(bool default_false)
+{
+    m_enable_work_stealing = default_false;
+    return *this;
+}
 bool FiberPoolOptions::enable_memory_binding() const
 {
     return m_enable_memory_binding;
@@ -46,5 +51,9 @@ bool FiberPoolOptions::enable_tracing_scheduler() const
 {
     return m_enable_tracing_scheduler;
 }
+bool FiberPoolOptions::enable_work_stealing() const
+{
+    return m_enable_work_stealing;
+}
 
 }  // namespace mrc
@@ -0,0 +1,70 @@
+/**
+ * SPDX-FileCopyrightText: Copyright (c) 2022-2023, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "mrc/options/metrics.hpp"
+
+#include <utility>
+
+namespace mrc {
+
+MetricsOptions& MetricsOptions::node_metrics(bool default_false)
+{
+    m_node_metrics = default_false;
+    return *this;
+}
+MetricsOptions& MetricsOptions::export_address(std::string address)
+{
+    m_export_address = std::move(address);
+    return *this;
+}
+MetricsOptions& MetricsOptions::export_port(std::uint16_t port)
+{
+    m_export_port = port;
+    return *this;
+}
+MetricsOptions& MetricsOptions::export_path(std::string path)
+{
+    m_export_path = std::move(path);
+    return *this;
+}
+MetricsOptions& MetricsOptions::export_interval(std::chrono::milliseconds interval)
+{
+    m_export_interval = interval;
+    return *this;
+}
+bool MetricsOptions::node_metrics() const
+{
+    return m_node_metrics;
+}
+const std::string& MetricsOptions::export_address() const
+{
+    return m_export_address;
+}
+std::uint16_t MetricsOptions::export_port() const
+{
+    return m_export_port;
+}
+const std::string& MetricsOptions::export_path() const
+{
+    return m_export_path;
+}
+std::chrono::milliseconds MetricsOptions::export_interval() const
+{
+    return m_export_interval;
+}
+
+}  // namespace mrc
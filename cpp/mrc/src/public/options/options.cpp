@@ -19,7 +19,9 @@
 
 #include "mrc/options/engine_groups.hpp"
 #include "mrc/options/fiber_pool.hpp"
+#include "mrc/options/metrics.hpp"
 #include "mrc/options/placement.hpp"
+#include "mrc/options/progress_engine.hpp"
 #include "mrc/options/resources.hpp"
 #include "mrc/options/services.hpp"
 #include "mrc/options/topology.hpp"
@@ -33,7 +35,9 @@ namespace mrc {
 Options::Options() :
   m_engine_groups(std::make_unique<EngineGroups>()),
   m_fiber_pool(std::make_unique<FiberPoolOptions>()),
+  m_metrics(std::make_unique<MetricsOptions>()),
   m_placement(std::make_unique<PlacementOptions>()),
+  m_progress_engine(std::make_unique<ProgressEngineOptions>()),
   m_resources(std::make_unique<ResourceOptions>()),
   m_services(std::make_unique<ServiceOptions>()),
   m_topology(std::make_unique<TopologyOptions>())
@@ -61,6 +65,17 @@ const FiberPoolOptions& Options::fiber_pool() const
     return *m_fiber_pool;
 }
 
+MetricsOptions& Options::metrics()
+{
+    CHECK(m_metrics);
+    return *m_metrics;
+}
+const MetricsOptions& Options::metrics() const
+{
+    CHECK(m_metrics);
+    return *m_metrics;
+}
+
 PlacementOptions& Options::placement()
 {
     CHECK(m_placement);
@@ -72,6 +87,17 @@ const PlacementOptions& Options::placement() const
     return *m_placement;
 }
 
+ProgressEngineOptions& Options::progress_engine()
+{
+    CHECK(m_progress_engine);
+    return *m_progress_engine;
+}
+const ProgressEngineOptions& Options::progress_engine() const
+{
+    CHECK(m_progress_engine);
+    return *m_progress_engine;
+}
+
 ResourceOptions& Options::resources()
 {
     CHECK(m_resources);
@@ -0,0 +1,59 @@
+/**
+ * SPDX-FileCopyrightText: Copyright (c) 2022-2023, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "mrc/options/progress_engine.hpp"
+
+namespace mrc {
+
+ProgressEngineOptions& ProgressEngineOptions::spin_count(std::size_t count)
+{
+    m_spin_count = count;
+    return *this;
+}
+ProgressEngineOptions& ProgressEngineOptions::max_backoff(std::chrono::microseconds duration)
+{
+    m_max_backoff = duration;
+    return *this;
+}
+ProgressEngineOptions& ProgressEngineOptions::park_threshold(std::chrono::microseconds duration)
+{
+    m_park_threshold = duration;
+    return *this;
+}
+ProgressEngineOptions& ProgressEngineOptions::park_timeout(std::chrono::milliseconds duration)
+{
+    m_park_timeout = duration;
+    return *this;
+}
+std::size_t ProgressEngineOptions::spin_count() const
+{
+    return m_spin_count;
+}
+std::chrono::microseconds ProgressEngineOptions::max_backoff() const
+{
+    return m_max_backoff;
+}
+std::chrono::microseconds ProgressEngineOptions::park_threshold() const
+{
+    return m_park_threshold;
+}
+std::chrono::milliseconds ProgressEngineOptions::park_timeout() const
+{
+    return m_park_timeout;
+}
+
+}  // namespace mrc
@@ -0,0 +1,64 @@
+/**
+ * SPDX-FileCopyrightText: Copyright (c) 2022-2023, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "mrc/runnable/autoscaler_policy.hpp"
+
+#include <glog/logging.h>
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+
+namespace mrc::runnable {
+
+UtilizationAutoscalerPolicy::UtilizationAutoscalerPolicy(double scale_up_utilization,
+                                                         double scale_down_utilization,
+                                                         std::size_t patience) :
+  m_scale_up_utilization(scale_up_utilization),
+  m_scale_down_utilization(scale_down_utilization),
+  m_patience(std::max<std::size_t>(patience, 1))
+{
+    CHECK(0.0 <= m_scale_down_utilization && m_scale_down_utilization < m_scale_up_utilization &&
+          m_scale_up_utilization <= 1.0)
+        << "autoscaler utilization thresholds must satisfy 0 <= scale_down < scale_up <= 1";
+}
+
+std::size_t UtilizationAutoscalerPolicy::target_instance_count(const AutoscalerSample& sample)
+{
+    const auto current = sample.instance_count;
+    const bool busy    = sample.utilization > m_scale_up_utilization && sample.queue_depth > 0;
+    const bool idle    = sample.utilization < m_scale_down_utilization && sample.queue_depth <= current;
+
+    m_scale_up_streak   = busy ? m_scale_up_streak + 1 : 0;
+    m_scale_down_streak = idle ? m_scale_down_streak + 1 : 0;
+
+    if (m_scale_up_streak < m_patience && m_scale_down_streak < m_patience)
+    {
+        return current;
+    }
+    m_scale_up_streak   = 0;
+    m_scale_down_streak = 0;
+
+    // size the instances so the observed work lands in the middle of the band
+    const auto target_utilization = (m_scale_up_utilization + m_scale_down_utilization) / 2.0;
+    const auto work               = static_cast<double>(current) * sample.utilization;
+    const auto target             = static_cast<std::size_t>(std::ceil(work / target_utilization));
+
+    return busy ? std::max(target, current + 1) : std::min(target, current - std::min<std::size_t>(current, 1));
+}
+
+}  // namespace mrc::runnable
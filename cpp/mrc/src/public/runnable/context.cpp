@@ -22,6 +22,8 @@
 #include <boost/fiber/fss.hpp>
 #include <glog/logging.h>
 
+#include <atomic>
+#include <chrono>
 #include <cstddef>
 #include <exception>
 #include <sstream>
@@ -66,7 +68,7 @@ std::size_t Context::size() const
 
 void Context::lock()
 {
-    if (m_size > 1)
+    if (m_size > 1 && !m_elastic)
     {
         do_lock();
     }
@@ -74,7 +76,7 @@ void Context::lock()
 
 void Context::unlock()
 {
-    if (m_size > 1)
+    if (m_size > 1 && !m_elastic)
     {
         do_unlock();
     }
@@ -82,7 +84,7 @@ void Context::unlock()
 
 void Context::barrier()
 {
-    if (m_size > 1)
+    if (m_size > 1 && !m_elastic)
     {
         do_barrier();
     }
@@ -93,7 +95,7 @@ void Context::yield()
     do_yield();
 }
 
-void Context::init(const Runner& runner)
+void Context::init(Runner& runner)
 {
     auto& fiber_local = FiberLocalContext::get();
     fiber_local.reset(new FiberLocalContext());
@@ -132,6 +134,12 @@ void Context::set_exception(std::exception_ptr exception_ptr)
     }
 }
 
+bool Context::has_runtime_context()
+{
+    auto& fiber_local = FiberLocalContext::get();
+    return fiber_local.get() != nullptr && fiber_local->m_context != nullptr;
+}
+
 Context& Context::get_runtime_context()
 {
     auto& fiber_local = FiberLocalContext::get();
@@ -150,6 +158,45 @@ const std::string& Context::info() const
     return m_info;
 }
 
+bool Context::is_elastic() const
+{
+    return m_elastic;
+}
+
+bool Context::retire_requested() const
+{
+    return m_retire_requested.load(std::memory_order_acquire);
+}
+
+std::chrono::nanoseconds Context::scaling_interval() const
+{
+    return m_scaling_interval;
+}
+
+bool Context::scaling_tick(std::chrono::nanoseconds busy_time, std::size_t queue_depth)
+{
+    m_busy_time_ns.fetch_add(busy_time.count(), std::memory_order_relaxed);
+
+    if (retire_requested())
+    {
+        return false;
+    }
+
+    // only launched instances drive the autoscaler, and rank 0 lives until the Runnable shuts down
+    if (m_rank == 0 && !m_elastic)
+    {
+        DCHECK(m_runner);
+        m_runner->autoscale(queue_depth);
+    }
+    return true;
+}
+
+void Context::await_elastic_instances()
+{
+    DCHECK(m_runner);
+    m_runner->await_elastic_instances();
+}
+
 bool Context::status() const
 {
     return (m_exception_ptr == nullptr);
@@ -69,4 +69,9 @@ void Runnable::update_state(State new_state)
 
 void Runnable::on_state_update(const State& /*unused*/) {}
 
+bool Runnable::supports_elastic_instances() const
+{
+    return false;
+}
+
 }  // namespace mrc::runnable
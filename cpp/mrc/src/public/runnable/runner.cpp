@@ -18,6 +18,7 @@
 #include "mrc/runnable/runner.hpp"
 
 #include "mrc/exceptions/runtime_error.hpp"
+#include "mrc/runnable/autoscaler_policy.hpp"
 #include "mrc/runnable/context.hpp"
 #include "mrc/runnable/engine.hpp"
 #include "mrc/runnable/runnable.hpp"
@@ -26,20 +27,21 @@
 #include <boost/fiber/future/future.hpp>
 #include <glog/logging.h>
 
+#include <algorithm>
 #include <atomic>
+#include <chrono>
 #include <cstddef>
+#include <deque>
 #include <exception>
 #include <functional>
 #include <memory>
 #include <mutex>
 #include <ostream>
 #include <string>
+#include <tuple>
 #include <utility>
 #include <vector>
 
-// IWYU thinks we need std::max for calling m_instances.resize()
-// IWYU pragma: no_include <algorithm>
-
 namespace mrc::runnable {
 
 static std::string runnable_state_str(const Runner::State& state)
@@ -79,10 +81,7 @@ Runner::~Runner()
     if (is_running)
     {
         m_runnable->update_state(Runnable::State::Kill);
-        for (auto& instance : m_instances)
-        {
-            await_join();
-        }
+        await_join();
     }
 }
 
@@ -97,6 +96,20 @@ void Runner::enqueue(std::shared_ptr<Engines> launcher, std::vector<std::shared_
             throw exceptions::MrcRuntimeError("Runner::run() is disabled");
         }
 
+        // the autoscaler runs if the runnable may grow beyond the launched instances
+        if (m_instance_factory && m_max_instances > contexts.size() && m_runnable->supports_elastic_instances())
+        {
+            if (!m_autoscaler)
+            {
+                m_autoscaler = std::make_unique<UtilizationAutoscalerPolicy>();
+            }
+            m_last_autoscale = std::chrono::steady_clock::now();
+        }
+        else
+        {
+            m_autoscaler.reset();
+        }
+
         // update to instance count = launcher.count()
         DCHECK_EQ(m_instances.size(), 0);
         m_instances.resize(contexts.size());
@@ -106,8 +119,15 @@ void Runner::enqueue(std::shared_ptr<Engines> launcher, std::vector<std::shared_
             m_instances[i].m_live_future = m_instances[i].m_live_promise.get_future().share();
             m_instances[i].m_context     = contexts[i];
             m_instances[i].m_engine      = launcher->launchers()[i];
+            if (m_autoscaler)
+            {
+                // every launched instance reports its busy time, rank 0 also drives the autoscaler
+                contexts[i]->m_scaling_interval = m_autoscale_interval;
+            }
             update_state(contexts[i]->rank(), State::Queued);
         }
+        m_launched_instances  = contexts.size();
+        m_remaining_instances = contexts.size();
 
         // mark runnable as running unless someone has already marked it to as stop or kill
         if (m_runnable->m_state < Runnable::State::Run)
@@ -122,59 +142,369 @@ void Runner::enqueue(std::shared_ptr<Engines> launcher, std::vector<std::shared_
 
     CHECK_EQ(m_instances.size(), launcher->launchers().size());
 
-    m_remaining_instances = launcher->size();
-
     for (auto& instance : m_instances)
     {
-        auto context = instance.m_context;
-        auto engine  = instance.m_engine;
-
-        auto f = engine->launch_task([this, context, &instance] {
-            context->init(*this);
-            update_state(context->rank(), State::Running);
-            instance.m_live_promise.set_value();
-            m_runnable->main(*context);
-            if (!context->status())
+        launch(instance);
+    }
+
+    // elastic instances are appended to m_instances, so they are only accepted once the launched ones are running
+    std::lock_guard<decltype(m_mutex)> lock(m_mutex);
+    m_accepting_instances = m_instance_factory != nullptr && m_runnable->supports_elastic_instances();
+}
+
+void Runner::launch(Instance& instance)
+{
+    auto context = instance.m_context;
+    auto engine  = instance.m_engine;
+
+    auto f = engine->launch_task([this, context, &instance] {
+        context->init(*this);
+        update_state(context->rank(), State::Running);
+        instance.m_live_promise.set_value();
+        m_runnable->main(*context);
+        if (!context->status())
+        {
+            update_state(context->rank(), State::Error);
+        }
+        update_state(context->rank(), State::Completed);
+        m_status = m_status && context->status();
+        if (--m_remaining_instances == 0)
+        {
+            if (m_completion_callback)
             {
-                update_state(context->rank(), State::Error);
+                m_completion_callback(m_status);
             }
-            update_state(context->rank(), State::Completed);
-            m_status = m_status && context->status();
-            if (--m_remaining_instances == 0)
+        }
+        context->finish();
+    });
+
+    instance.m_join_future = f.share();
+}
+
+std::size_t Runner::add_instances(std::size_t count)
+{
+    if (!m_runnable->supports_elastic_instances())
+    {
+        throw exceptions::MrcRuntimeError("Runner::add_instances() - the runnable does not support elastic instances");
+    }
+    if (!m_instance_factory)
+    {
+        throw exceptions::MrcRuntimeError("Runner::add_instances() - the runner was not prepared by a LaunchControl");
+    }
+
+    // concurrent calls are serialized, so the ranks reserved below stay unique while the engines are built; the
+    // recursive mutex is only held to reserve the ranks and to publish the instances
+    std::lock_guard<decltype(m_scaling_mutex)> scaling_lock(m_scaling_mutex);
+
+    std::vector<std::size_t> ranks;
+    {
+        std::lock_guard<decltype(m_mutex)> lock(m_mutex);
+        if (count == 0 || !m_accepting_instances || m_instances.empty() || m_runnable->m_state >= Runnable::State::Stop)
+        {
+            return 0;
+        }
+
+        release_retired_instances();
+
+        // reuse the lowest free ranks first, then append new ones
+        std::sort(m_free_ranks.begin(), m_free_ranks.end(), std::greater<>());
+        while (ranks.size() < count && !m_free_ranks.empty())
+        {
+            ranks.push_back(m_free_ranks.back());
+            m_free_ranks.pop_back();
+        }
+        for (auto rank = m_instances.size(); ranks.size() < count; ++rank)
+        {
+            ranks.push_back(rank);
+        }
+    }
+
+    // gives the reused ranks back if no instance was launched on them
+    auto free_ranks = [this, &ranks] {
+        std::lock_guard<decltype(m_mutex)> lock(m_mutex);
+        for (const auto rank : ranks)
+        {
+            if (rank < m_instances.size())
             {
-                if (m_completion_callback)
-                {
-                    m_completion_callback(m_status);
-                }
+                m_free_ranks.push_back(rank);
             }
-            context->finish();
-        });
+        }
+    };
+
+    // building the engines may bind cores and start threads; the autoscaler, retire_instances and the join and state
+    // queries of the Runner are not blocked meanwhile
+    std::shared_ptr<Engines> engines;
+    std::vector<std::shared_ptr<Context>> contexts;
+    try
+    {
+        std::tie(engines, contexts) = m_instance_factory(ranks);
+    } catch (...)
+    {
+        free_ranks();
+        throw;
+    }
+    CHECK(engines);
+    CHECK_EQ(engines->size(), count);
+    CHECK_EQ(contexts.size(), count);
+
+    std::lock_guard<decltype(m_mutex)> lock(m_mutex);
+
+    // rank 0 may have begun to shut down while the engines were built; the unlaunched engines are dropped
+    if (!m_accepting_instances || m_runnable->m_state >= Runnable::State::Stop)
+    {
+        free_ranks();
+        return 0;
+    }
+
+    m_remaining_instances += count;
+
+    // launched while holding the lock, so the join futures are set before await_elastic_instances can see them
+    for (std::size_t i = 0; i < count; ++i)
+    {
+        auto& context = contexts[i];
+        DCHECK_EQ(context->rank(), ranks[i]);
+        context->m_elastic          = true;
+        context->m_scaling_interval = m_autoscale_interval;
 
-        instance.m_join_future = f.share();
+        if (ranks[i] == m_instances.size())
+        {
+            m_instances.emplace_back();
+        }
+        else
+        {
+            m_instances[ranks[i]] = Instance{};
+        }
+
+        auto& instance         = m_instances[ranks[i]];
+        instance.m_uid         = context->rank();
+        instance.m_live_future = instance.m_live_promise.get_future().share();
+        instance.m_context     = context;
+        instance.m_engine      = engines->launchers()[i];
+        update_state(context->rank(), State::Queued);
+
+        m_elastic_ranks.push_back(context->rank());
+        launch(instance);
+    }
+
+    DVLOG(10) << "runner added " << count << " elastic instances; instance count: " << instance_count();
+    return count;
+}
+
+std::size_t Runner::retire_instances(std::size_t count)
+{
+    std::lock_guard<decltype(m_mutex)> lock(m_mutex);
+    if (m_instances.empty())
+    {
+        return 0;
+    }
+
+    std::size_t retired = 0;
+    while (retired < count && !m_elastic_ranks.empty())
+    {
+        const auto rank = m_elastic_ranks.back();
+        m_elastic_ranks.pop_back();
+        m_instances[rank].m_context->m_retire_requested.store(true, std::memory_order_release);
+        m_retired_ranks.push_back(rank);
+        ++retired;
     }
+
+    DVLOG(10) << "runner retired " << retired << " elastic instances; instance count: " << instance_count();
+    return retired;
 }
 
-const std::vector<Runner::Instance>& Runner::instances() const
+std::size_t Runner::instance_count() const
+{
+    std::lock_guard<decltype(m_mutex)> lock(m_mutex);
+    if (m_instances.empty())
+    {
+        return 0;
+    }
+    return m_launched_instances + m_elastic_ranks.size();
+}
+
+void Runner::set_autoscaler_policy(std::unique_ptr<AutoscalerPolicy> policy)
+{
+    CHECK(policy);
+    std::lock_guard<decltype(m_mutex)> lock(m_mutex);
+    CHECK(m_instances.empty()) << "the autoscaler policy must be set before the runnable is launched";
+    m_autoscaler = std::move(policy);
+}
+
+void Runner::set_instance_factory(instance_factory_t factory,
+                                  std::size_t max_instances,
+                                  std::chrono::nanoseconds autoscale_interval)
+{
+    CHECK(factory);
+    CHECK_GT(autoscale_interval.count(), 0) << "the autoscale interval must be positive";
+    std::lock_guard<decltype(m_mutex)> lock(m_mutex);
+    m_instance_factory   = std::move(factory);
+    m_max_instances      = max_instances;
+    m_autoscale_interval = autoscale_interval;
+}
+
+void Runner::autoscale(std::size_t queue_depth)
+{
+    if (!m_autoscaler)
+    {
+        return;
+    }
+
+    const auto now     = std::chrono::steady_clock::now();
+    const auto elapsed = std::chrono::duration_cast<std::chrono::nanoseconds>(now - m_last_autoscale);
+    if (elapsed < m_autoscale_interval)
+    {
+        return;
+    }
+
+    // the sample and the target are taken under the lock; add_instances builds the engines of new instances without
+    // holding it, so it is called once the lock is released
+    std::size_t instances = 0;
+    std::size_t target    = 0;
+    {
+        std::lock_guard<decltype(m_mutex)> lock(m_mutex);
+
+        const auto busy = busy_time();
+        instances       = instance_count();
+
+        AutoscalerSample sample{};
+        sample.instance_count = instances;
+        sample.min_instances  = m_launched_instances;
+        sample.max_instances  = m_max_instances;
+        sample.queue_depth    = queue_depth;
+        sample.utilization    = std::clamp(static_cast<double>((busy - m_last_busy_time).count()) /
+                                            (static_cast<double>(elapsed.count()) * static_cast<double>(instances)),
+                                        0.0,
+                                        1.0);
+
+        m_last_autoscale = now;
+        m_last_busy_time = busy;
+
+        target = std::clamp(m_autoscaler->target_instance_count(sample), m_launched_instances, m_max_instances);
+    }
+
+    if (target > instances)
+    {
+        try
+        {
+            add_instances(target - instances);
+        } catch (const std::exception& e)
+        {
+            // e.g. a single use engine factory ran out of cores; stop trying to grow past what is running
+            LOG(WARNING) << "autoscaler failed to add instances; limiting the runnable to " << instances
+                         << " instances: " << e.what();
+            std::lock_guard<decltype(m_mutex)> lock(m_mutex);
+            m_max_instances = instances;
+        }
+    }
+    else if (target < instances)
+    {
+        retire_instances(instances - target);
+    }
+}
+
+void Runner::await_elastic_instances()
+{
+    std::vector<SharedFuture<void>> join_futures;
+    {
+        std::lock_guard<decltype(m_mutex)> lock(m_mutex);
+        m_accepting_instances = false;
+        for (auto rank = m_launched_instances; rank < m_instances.size(); ++rank)
+        {
+            join_futures.push_back(m_instances[rank].join_future());
+        }
+    }
+
+    for (auto& join_future : join_futures)
+    {
+        try
+        {
+            join_future.get();
+        } catch (...)
+        {
+            // the exception is rethrown by await_join
+        }
+    }
+}
+
+void Runner::release_retired_instances()
+{
+    // a retired instance no longer needs its engine or context once its task has returned
+    auto released = std::remove_if(m_retired_ranks.begin(), m_retired_ranks.end(), [this](std::size_t rank) {
+        auto& instance = m_instances[rank];
+        if (instance.m_join_future.wait_for(std::chrono::seconds(0)) != boost::fibers::future_status::ready)
+        {
+            return false;
+        }
+        m_retired_busy_time += std::chrono::nanoseconds(instance.m_context->m_busy_time_ns.load());
+        instance.m_context.reset();
+        instance.m_engine.reset();
+        m_free_ranks.push_back(rank);
+        return true;
+    });
+    m_retired_ranks.erase(released, m_retired_ranks.end());
+}
+
+std::chrono::nanoseconds Runner::busy_time() const
+{
+    std::lock_guard<decltype(m_mutex)> lock(m_mutex);
+
+    auto busy_time = m_retired_busy_time;
+    auto add       = [&](std::size_t rank) {
+        busy_time += std::chrono::nanoseconds(m_instances[rank].m_context->m_busy_time_ns.load());
+    };
+
+    for (std::size_t rank = 0; rank < m_launched_instances; ++rank)
+    {
+        add(rank);
+    }
+    std::for_each(m_elastic_ranks.begin(), m_elastic_ranks.end(), add);
+    std::for_each(m_retired_ranks.begin(), m_retired_ranks.end(), add);
+
+    return busy_time;
+}
+
+const std::deque<Runner::Instance>& Runner::instances() const
 {
     return m_instances;
 }
 
 void Runner::await_live() const
 {
-    for (const auto& instance : instances())
+    for (std::size_t i = 0;; ++i)
     {
-        instance.live_future().get();
+        SharedFuture<void> live_future;
+        {
+            std::lock_guard<decltype(m_mutex)> lock(m_mutex);
+            if (i >= m_instances.size())
+            {
+                break;
+            }
+            live_future = m_instances[i].live_future();
+        }
+        live_future.get();
     }
 }
 
 void Runner::await_join() const
 {
     std::exception_ptr first_exception{nullptr};
-    for (const auto& instance : instances())
+
+    // elastic instances may be added while waiting, but only until rank 0 begins to shut down
+    for (std::size_t i = 0;; ++i)
     {
+        SharedFuture<void> join_future;
+        {
+            std::lock_guard<decltype(m_mutex)> lock(m_mutex);
+            if (i >= m_instances.size())
+            {
+                break;
+            }
+            join_future = m_instances[i].join_future();
+        }
+
         try
         {
-            instance.join_future().get();
+            join_future.get();
         } catch (...)
         {
             if (first_exception == nullptr)
@@ -183,7 +513,10 @@ void Runner::await_join() const
             }
         }
     }
-    m_instances.clear();
+    {
+        std::lock_guard<decltype(m_mutex)> lock(m_mutex);
+        m_instances.clear();
+    }
     if (first_exception)
     {
         LOG(ERROR) << "Runner::await_join - an exception was caught while awaiting on one or more contexts/instances - "
@@ -0,0 +1,512 @@
+/**
+ * SPDX-FileCopyrightText: Copyright (c) 2022-2023, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "mrc/tracing/event_trace.hpp"
+
+#include <glog/logging.h>
+#include <pthread.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <array>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <iomanip>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <ostream>
+#include <utility>
+#include <vector>
+
+#if defined(__x86_64__) || defined(__i386__)
+    #include <x86intrin.h>
+#endif
+
+namespace mrc::tracing {
+
+namespace detail {
+
+std::atomic<bool> s_enabled{std::getenv("MRC_TRACE_EVENTS") != nullptr};  // NOLINT
+
+}  // namespace detail
+
+namespace {
+
+constexpr std::size_t DefaultCapacity = 1UL << 14;
+constexpr std::size_t MinCapacity     = 16;
+
+// the timestamp counter is converted to time using two reference points at least this far apart
+constexpr std::chrono::milliseconds MinCalibrationInterval{10};
+
+std::int64_t steady_ns()
+{
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now().time_since_epoch())
+        .count();
+}
+
+std::uint64_t read_timestamp()
+{
+#if defined(__x86_64__) || defined(__i386__)
+    return __rdtsc();
+#else
+    return static_cast<std::uint64_t>(steady_ns());
+#endif
+}
+
+std::string json_string(const std::string& value)
+{
+    std::string quoted = "\"";
+    for (const auto c : value)
+    {
+        switch (c)
+        {
+        case '"':
+            quoted += "\\\"";
+            break;
+        case '\\':
+            quoted += "\\\\";
+            break;
+        default:
+            if (static_cast<unsigned char>(c) < 0x20)
+            {
+                std::array<char, 8> escaped{};
+                std::snprintf(escaped.data(), escaped.size(), "\\u%04x", c);
+                quoted += escaped.data();
+            }
+            else
+            {
+                quoted += c;
+            }
+        }
+    }
+    quoted += '"';
+    return quoted;
+}
+
+struct Event
+{
+    std::uint64_t timestamp;
+    std::uint64_t arg;
+    std::uint32_t name_id;
+    EventType type;
+    Phase phase;
+};
+
+/**
+ * Single-writer ring of events. The owning thread publishes each event by advancing m_head; readers copy the ring
+ * and then re-read m_head to discard any slot the writer may have reused while they were copying (a seqlock over the
+ * whole ring).
+ */
+class ThreadBuffer
+{
+  public:
+    ThreadBuffer(std::size_t capacity, std::uint64_t tid, std::string thread_name) :
+      m_mask(capacity - 1),
+      m_slots(capacity),
+      m_tid(tid),
+      m_thread_name(std::move(thread_name))
+    {}
+
+    void push(EventType type, Phase phase, std::uint32_t name_id, std::uint64_t arg)
+    {
+        push(read_timestamp(), type, phase, name_id, arg);
+    }
+
+    void push(std::uint64_t timestamp, EventType type, Phase phase, std::uint32_t name_id, std::uint64_t arg)
+    {
+        const auto index = m_head.load(std::memory_order_relaxed);
+
+        // orders the publication of the previous event before the slot is overwritten; see collect
+        std::atomic_thread_fence(std::memory_order_release);
+
+        auto& slot = m_slots[index & m_mask];
+        slot.timestamp.store(timestamp, std::memory_order_relaxed);
+        slot.arg.store(arg, std::memory_order_relaxed);
+        slot.meta.store(pack(type, phase, name_id), std::memory_order_relaxed);
+
+        m_head.store(index + 1, std::memory_order_release);
+    }
+
+    void collect(std::vector<Event>& events) const
+    {
+        const auto capacity = m_slots.size();
+        const auto head     = m_head.load(std::memory_order_acquire);
+        const auto floor    = m_floor.load(std::memory_order_relaxed);
+        const auto first    = std::max(floor, head > capacity ? head - capacity : 0);
+
+        std::vector<Event> copied;
+        copied.reserve(head - first);
+        for (auto index = first; index < head; ++index)
+        {
+            const auto& slot = m_slots[index & m_mask];
+            const auto meta  = slot.meta.load(std::memory_order_relaxed);
+            copied.push_back(Event{slot.timestamp.load(std::memory_order_relaxed),
+                                   slot.arg.load(std::memory_order_relaxed),
+                                   static_cast<std::uint32_t>(meta >> 16),
+                                   static_cast<EventType>((meta >> 8) & 0xff),
+                                   static_cast<Phase>(meta & 0xff)});
+        }
+
+        // the writer reuses the slot of event i only once it has published event i + capacity - 1
+        std::atomic_thread_fence(std::memory_order_acquire);
+        const auto head_after  = m_head.load(std::memory_order_relaxed);
+        const auto first_valid = head_after >= capacity ? head_after - capacity + 1 : 0;
+
+        for (auto index = first; index < head; ++index)
+        {
+            if (index >= first_valid)
+            {
+                events.push_back(copied[index - first]);
+            }
+        }
+    }
+
+    void clear()
+    {
+        m_floor.store(m_head.load(std::memory_order_acquire), std::memory_order_relaxed);
+    }
+
+    void retire()
+    {
+        m_retired.store(true, std::memory_order_release);
+    }
+
+    bool is_retired() const
+    {
+        return m_retired.load(std::memory_order_acquire);
+    }
+
+    std::uint64_t tid() const
+    {
+        return m_tid;
+    }
+
+    const std::string& thread_name() const
+    {
+        return m_thread_name;
+    }
+
+  private:
+    struct Slot
+    {
+        std::atomic<std::uint64_t> timestamp{0};
+        std::atomic<std::uint64_t> arg{0};
+        std::atomic<std::uint64_t> meta{0};
+    };
+
+    static std::uint64_t pack(EventType type, Phase phase, std::uint32_t name_id)
+    {
+        return (static_cast<std::uint64_t>(name_id) << 16) | (static_cast<std::uint64_t>(type) << 8) |
+               static_cast<std::uint64_t>(phase);
+    }
+
+    const std::size_t m_mask;
+    std::vector<Slot> m_slots;
+    std::atomic<std::uint64_t> m_head{0};
+    std::atomic<std::uint64_t> m_floor{0};
+    std::atomic<bool> m_retired{false};
+
+    const std::uint64_t m_tid;
+    const std::string m_thread_name;
+};
+
+class State
+{
+  public:
+    State() : m_base_timestamp(read_timestamp()), m_base_ns(steady_ns())
+    {
+        // id 0 labels events by their type, e.g. fiber switches
+        m_names.emplace_back();
+    }
+
+    std::shared_ptr<ThreadBuffer> register_thread()
+    {
+        std::array<char, 64> name{};
+        pthread_getname_np(pthread_self(), name.data(), name.size());
+
+        auto buffer = std::make_shared<ThreadBuffer>(m_capacity.load(std::memory_order_relaxed),
+                                                     static_cast<std::uint64_t>(::syscall(SYS_gettid)),
+                                                     std::string(name.data()));
+
+        std::lock_guard<decltype(m_mutex)> lock(m_mutex);
+        m_buffers.push_back(buffer);
+        return buffer;
+    }
+
+    void set_capacity(std::size_t events)
+    {
+        std::size_t capacity = MinCapacity;
+        while (capacity < events)
+        {
+            capacity <<= 1;
+        }
+        m_capacity.store(capacity, std::memory_order_relaxed);
+    }
+
+    std::uint32_t intern(const std::string& name)
+    {
+        std::lock_guard<decltype(m_mutex)> lock(m_mutex);
+        auto [it, inserted] = m_name_ids.emplace(name, m_names.size());
+        if (inserted)
+        {
+            m_names.push_back(name);
+        }
+        return it->second;
+    }
+
+    void clear()
+    {
+        std::lock_guard<decltype(m_mutex)> lock(m_mutex);
+        m_buffers.erase(std::remove_if(m_buffers.begin(),
+                                       m_buffers.end(),
+                                       [](const auto& buffer) {
+                                           return buffer->is_retired();
+                                       }),
+                        m_buffers.end());
+        for (auto& buffer : m_buffers)
+        {
+            buffer->clear();
+        }
+    }
+
+    std::size_t dump(std::ostream& os)
+    {
+        // snapshot the buffer list and the names, then format without holding the lock
+        std::vector<std::shared_ptr<ThreadBuffer>> buffers;
+        std::vector<std::string> names;
+        {
+            std::lock_guard<decltype(m_mutex)> lock(m_mutex);
+            buffers = m_buffers;
+            names   = m_names;
+        }
+
+        const auto ns_per_tick = calibrate();
+        const auto pid         = ::getpid();
+
+        std::size_t count = 0;
+        os << R"({"displayTimeUnit":"ns","traceEvents":[)";
+
+        bool first = true;
+        auto separator = [&first, &os] {
+            os << (first ? "\n" : ",\n");
+            first = false;
+        };
+
+        std::vector<Event> events;
+        for (const auto& buffer : buffers)
+        {
+            separator();
+            os << R"({"ph":"M","name":"thread_name","pid":)" << pid << R"(,"tid":)" << buffer->tid()
+               << R"(,"args":{"name":)" << json_string(buffer->thread_name()) << "}}";
+
+            events.clear();
+            buffer->collect(events);
+
+            for (const auto& event : events)
+            {
+                const auto ts_us =
+                    static_cast<double>(static_cast<std::int64_t>(event.timestamp - m_base_timestamp)) * ns_per_tick /
+                    1000.0;
+                const bool complete = event.phase == Phase::complete;
+                const auto* category = type_name(event.type);
+
+                separator();
+                os << R"({"name":)"
+                   << json_string(event.name_id != 0 && event.name_id < names.size() ? names[event.name_id] : category)
+                   << R"(,"cat":")" << category << R"(","ph":")" << phase_name(event.phase) << '"'
+                   << (event.phase == Phase::instant ? R"(,"s":"t")" : "") << R"(,"ts":)" << std::fixed
+                   << std::setprecision(3) << ts_us << std::defaultfloat << R"(,"pid":)" << pid << R"(,"tid":)"
+                   << buffer->tid();
+                if (complete)
+                {
+                    // the argument of a complete event is its duration in ticks
+                    os << R"(,"dur":)" << std::fixed << std::setprecision(3)
+                       << static_cast<double>(event.arg) * ns_per_tick / 1000.0 << std::defaultfloat;
+                }
+                else if (event.arg != 0)
+                {
+                    os << R"(,"args":{"id":)" << event.arg << "}";
+                }
+                os << "}";
+                ++count;
+            }
+        }
+
+        os << "\n]}\n";
+        return count;
+    }
+
+  private:
+    static const char* type_name(EventType type)
+    {
+        switch (type)
+        {
+        case EventType::node:
+            return "node";
+        case EventType::channel_read:
+            return "channel_read";
+        case EventType::channel_write:
+            return "channel_write";
+        case EventType::fiber_switch:
+            return "fiber_switch";
+        }
+        return "unknown";
+    }
+
+    static const char* phase_name(Phase phase)
+    {
+        switch (phase)
+        {
+        case Phase::begin:
+            return "B";
+        case Phase::end:
+            return "E";
+        case Phase::instant:
+            return "i";
+        case Phase::complete:
+            return "X";
+        }
+        return "i";
+    }
+
+    // nanoseconds per timestamp tick, measured against the steady clock since the state was created
+    double calibrate() const
+    {
+        auto now_ns        = steady_ns();
+        auto now_timestamp = read_timestamp();
+        while (now_ns - m_base_ns < std::chrono::nanoseconds(MinCalibrationInterval).count())
+        {
+            now_ns        = steady_ns();
+            now_timestamp = read_timestamp();
+        }
+
+        if (now_timestamp <= m_base_timestamp)
+        {
+            return 1.0;
+        }
+        return static_cast<double>(now_ns - m_base_ns) / static_cast<double>(now_timestamp - m_base_timestamp);
+    }
+
+    const std::uint64_t m_base_timestamp;
+    const std::int64_t m_base_ns;
+
+    std::mutex m_mutex;
+    std::vector<std::shared_ptr<ThreadBuffer>> m_buffers;
+    std::vector<std::string> m_names;
+    std::map<std::string, std::uint32_t> m_name_ids;
+    std::atomic<std::size_t> m_capacity{DefaultCapacity};
+};
+
+State& state()
+{
+    // never destroyed; threads may still record while static destructors run
+    static auto* s_state = new State;
+    return *s_state;
+}
+
+// trivially destructible, so reading it never registers a thread exit handler, which may allocate
+thread_local ThreadBuffer* t_buffer = nullptr;  // NOLINT
+
+ThreadBuffer& this_thread_buffer()
+{
+    struct Holder
+    {
+        ~Holder()
+        {
+            t_buffer = nullptr;
+            if (buffer)
+            {
+                buffer->retire();
+            }
+        }
+
+        std::shared_ptr<ThreadBuffer> buffer;
+    };
+
+    if (t_buffer == nullptr)
+    {
+        thread_local Holder holder;
+        holder.buffer = state().register_thread();
+        t_buffer      = holder.buffer.get();
+    }
+    return *t_buffer;
+}
+
+}  // namespace
+
+namespace detail {
+
+void record(EventType type, Phase phase, std::uint32_t name_id, std::uint64_t arg)
+{
+    this_thread_buffer().push(type, phase, name_id, arg);
+}
+
+void record_registered(EventType type, Phase phase, std::uint32_t name_id, std::uint64_t arg)
+{
+    if (t_buffer != nullptr)
+    {
+        t_buffer->push(type, phase, name_id, arg);
+    }
+}
+
+std::uint64_t timestamp()
+{
+    return std::max<std::uint64_t>(read_timestamp(), 1);
+}
+
+void record_span(EventType type, std::uint32_t name_id, std::uint64_t started)
+{
+    const auto now = read_timestamp();
+    this_thread_buffer().push(started, type, Phase::complete, name_id, now > started ? now - started : 0);
+}
+
+}  // namespace detail
+
+void register_thread()
+{
+    this_thread_buffer();
+}
+
+void set_enabled(bool enabled)
+{
+    detail::s_enabled.store(enabled, std::memory_order_relaxed);
+}
+
+void set_buffer_capacity(std::size_t events)
+{
+    state().set_capacity(events);
+}
+
+std::uint32_t intern(const std::string& name)
+{
+    return state().intern(name);
+}
+
+std::size_t dump_chrome_trace(std::ostream& os)
+{
+    return state().dump(os);
+}
+
+void clear()
+{
+    state().clear();
+}
+
+}  // namespace mrc::tracing
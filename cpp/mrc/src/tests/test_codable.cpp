@@ -17,6 +17,8 @@
 
 #include "common.hpp"
 
+#include "internal/codable/codable_storage.hpp"
+#include "internal/codable/flat_storage.hpp"
 #include "internal/data_plane/resources.hpp"
 #include "internal/network/resources.hpp"
 #include "internal/remote_descriptor/storage.hpp"
@@ -29,28 +31,37 @@
 
 #include "mrc/codable/api.hpp"
 #include "mrc/codable/codable_protocol.hpp"
+#include "mrc/codable/contiguous_types.hpp"  // IWYU pragma: keep
 #include "mrc/codable/decode.hpp"
 #include "mrc/codable/encode.hpp"
 #include "mrc/codable/fundamental_types.hpp"  // IWYU pragma: keep
 #include "mrc/codable/protobuf_message.hpp"   // IWYU pragma: keep
 #include "mrc/codable/type_traits.hpp"
+#include "mrc/exceptions/runtime_error.hpp"
+#include "mrc/memory/buffer_view.hpp"
 #include "mrc/memory/codable/buffer.hpp"  // IWYU pragma: keep
+#include "mrc/memory/memory_kind.hpp"
 #include "mrc/options/options.hpp"
 #include "mrc/options/placement.hpp"
 #include "mrc/protos/codable.pb.h"  // IWYU pragma: keep
+#include "mrc/runtime/api.hpp"
 
 #include <glog/logging.h>
 #include <gtest/gtest.h>
 
 #include <algorithm>
+#include <cstddef>
 #include <cstdint>
 #include <cstdlib>
+#include <cstring>
 #include <ctime>
 #include <memory>
+#include <numeric>
 #include <optional>
 #include <ostream>
 #include <string>
 #include <utility>
+#include <vector>
 
 namespace mrc::codable {
 class EncodingOptions;
@@ -194,24 +205,69 @@ TEST_F(TestCodable, Buffer)
 {
     static_assert(is_codable<mrc::memory::buffer>::value, "should be codable");
 
-    // Uncomment when local copy is working!
-    // auto encodable_storage = m_runtime->partition(0).make_codable_storage();
+    auto encodable_storage = m_runtime->partition(0).make_codable_storage();
+
+    size_t int_count = 100;
 
-    // size_t int_count = 100;
+    auto buffer = m_runtime->partition(0).resources().host().make_buffer(int_count * sizeof(int));
 
-    // auto buffer = m_runtime->partition(0).resources().host().make_buffer(int_count * sizeof(int));
+    populate(int_count, static_cast<int*>(buffer.data()));
 
-    // populate(int_count, static_cast<int*>(buffer.data()));
+    encode(buffer, *encodable_storage);
+    EXPECT_EQ(encodable_storage->descriptor_count(), 1);
 
-    // encode(buffer, *encodable_storage);
-    // EXPECT_EQ(encodable_storage->descriptor_count(), 1);
+    auto decoding = decode<mrc::memory::buffer>(*encodable_storage);
 
-    // auto decoding = decode<mrc::memory::buffer>(*encodable_storage);
+    int* input_start  = static_cast<int*>(buffer.data());
+    int* output_start = static_cast<int*>(decoding.data());
 
-    // int* input_start  = static_cast<int*>(buffer.data());
-    // int* output_start = static_cast<int*>(decoding.data());
+    EXPECT_TRUE(std::equal(input_start, input_start + int_count, output_start));
 
-    // EXPECT_TRUE(std::equal(input_start, input_start + int_count, output_start));
+    // decoding into a buffer of the same size reuses its allocation
+    const auto* address = decoding.data();
+    std::fill(output_start, output_start + int_count, 0);
+    decode_into(*encodable_storage, decoding);
+    EXPECT_EQ(decoding.data(), address);
+    EXPECT_TRUE(std::equal(input_start, input_start + int_count, output_start));
+}
+
+TEST_F(TestCodable, Vector)
+{
+    static_assert(is_codable<std::vector<float>>::value, "should be codable");
+    static_assert(!is_codable<std::vector<bool>>::value, "not contiguous");
+    static_assert(!is_codable<std::vector<std::string>>::value, "not trivially copyable");
+
+    // small vectors are copied to an eager descriptor
+    std::vector<float> small{1.0F, 2.0F, 3.0F};
+    auto small_storage = m_runtime->partition(0).make_codable_storage();
+    encode(small, *small_storage);
+    EXPECT_EQ(small_storage->descriptor_count(), 1);
+    EXPECT_TRUE(small_storage->proto().descriptors(0).has_eager_desc());
+    EXPECT_EQ(decode<std::vector<float>>(*small_storage), small);
+
+    // large vectors are registered in place
+    std::vector<std::uint64_t> large(32 * 1024);
+    std::iota(large.begin(), large.end(), 0);
+    auto large_storage = m_runtime->partition(0).make_codable_storage();
+    encode(large, *large_storage);
+    EXPECT_EQ(large_storage->descriptor_count(), 1);
+    ASSERT_TRUE(large_storage->proto().descriptors(0).has_remote_desc());
+    EXPECT_EQ(large_storage->proto().descriptors(0).remote_desc().address(),
+              reinterpret_cast<std::uint64_t>(large.data()));
+    EXPECT_EQ(decode<std::vector<std::uint64_t>>(*large_storage), large);
+
+    // decoding into an existing vector reuses its capacity
+    std::vector<std::uint64_t> dst;
+    dst.reserve(large.size());
+    const auto* address = dst.data();
+    decode_into(*large_storage, dst);
+    EXPECT_EQ(dst.data(), address);
+    EXPECT_EQ(dst, large);
+
+    // forcing a copy decouples the encoding from the vector
+    auto copy_storage = m_runtime->partition(0).make_codable_storage();
+    encode(large, *copy_storage, EncodingOptions(true, false));
+    EXPECT_EQ(decode<std::vector<std::uint64_t>>(*copy_storage), large);
 }
 
 TEST_F(TestCodable, Double)
@@ -252,6 +308,78 @@ TEST_F(TestCodable, Composite)
     EXPECT_EQ(ans, decoded_ans);
 }
 
+TEST_F(TestCodable, FlatStorage)
+{
+    std::string str   = "Hello Mrc";
+    std::uint64_t ans = 42;
+    std::vector<std::uint64_t> large(32 * 1024);
+    std::iota(large.begin(), large.end(), 0);
+
+    // both ends of the flat encoding are reachable through the public partition interface
+    mrc::runtime::IPartition& partition = m_runtime->partition(0);
+
+    auto storage_ptr = partition.make_flat_codable_storage();
+    auto& storage    = *storage_ptr;
+
+    encode(str, storage);
+    encode(ans, storage);
+    encode(large, storage);
+
+    EXPECT_EQ(storage.object_count(), 3);
+    EXPECT_EQ(storage.descriptor_count(), 3);
+    EXPECT_EQ(decode<std::string>(storage, 0), str);
+
+    // the finalized bytes are read in place; nothing is parsed, only bounds are validated
+    auto encoded       = storage.finalize();
+    auto decodable_ptr = partition.make_flat_decodable_storage(encoded);
+    auto& decodable    = *decodable_ptr;
+
+    EXPECT_EQ(decodable.object_count(), 3);
+    EXPECT_EQ(decode<std::string>(decodable, 0), str);
+    EXPECT_EQ(decode<std::uint64_t>(decodable, 1), ans);
+    EXPECT_EQ(decode<std::vector<std::uint64_t>>(decodable, 2), large);
+
+    // the protobuf form is built on demand and matches CodableStorage
+    const auto& proto = decodable.proto();
+    EXPECT_EQ(proto.objects_size(), 3);
+    EXPECT_TRUE(proto.descriptors(0).has_eager_desc());
+    EXPECT_EQ(proto.descriptors(0).eager_desc().data(), str);
+    ASSERT_TRUE(proto.descriptors(2).has_remote_desc());
+    EXPECT_EQ(proto.descriptors(2).remote_desc().address(), reinterpret_cast<std::uint64_t>(large.data()));
+
+    internal::codable::CodableStorage from_proto(proto, m_runtime->partition(0).resources());
+    EXPECT_EQ(decode<std::uint64_t>(from_proto.decodable(), 1), ans);
+}
+
+TEST_F(TestCodable, FlatStorageRejectsMalformedBytes)
+{
+    auto storage = m_runtime->partition(0).make_flat_codable_storage();
+    encode(std::string("Hello Mrc"), *storage);
+    auto encoded = storage->finalize();
+
+    // an 8-byte aligned copy which can be corrupted
+    std::vector<std::uint64_t> bytes(encoded.bytes() / sizeof(std::uint64_t) + 1);
+    std::memcpy(bytes.data(), encoded.data(), encoded.bytes());
+    auto* base = reinterpret_cast<std::byte*>(bytes.data());
+    memory::const_buffer_view view(base, encoded.bytes(), memory::memory_kind::host);
+    memory::const_buffer_view truncated(base, sizeof(internal::codable::FlatHeader), memory::memory_kind::host);
+    auto& resources = m_runtime->partition(0).resources();
+
+    EXPECT_NO_THROW(internal::codable::FlatDecodableStorage(view, resources));
+    EXPECT_THROW(internal::codable::FlatDecodableStorage(truncated, resources), exceptions::MrcRuntimeError);
+
+    // a descriptor whose data runs past the end of the encoding
+    const auto& header = *reinterpret_cast<const internal::codable::FlatHeader*>(base);
+    auto* descriptors  = reinterpret_cast<internal::codable::FlatDescriptor*>(base + header.descriptors_offset);
+    descriptors[0].bytes = header.total_bytes;
+    EXPECT_THROW(internal::codable::FlatDecodableStorage(view, resources), exceptions::MrcRuntimeError);
+
+    // an offset chosen so offset + bytes wraps around
+    descriptors[0].bytes  = 16;
+    descriptors[0].offset = ~std::uint64_t(0) - 8;
+    EXPECT_THROW(internal::codable::FlatDecodableStorage(view, resources), exceptions::MrcRuntimeError);
+}
+
 TEST_F(TestCodable, EncodedObjectProto)
 {
     static_assert(codable::is_encodable<mrc::codable::protos::EncodedObject>::value, "should be encodable");
@@ -16,29 +16,37 @@
  */
 
 #include "internal/memory/callback_adaptor.hpp"
+#include "internal/memory/numa_memory_resource.hpp"
+#include "internal/memory/slab_pool.hpp"
 #include "internal/memory/transient_pool.hpp"
+#include "internal/system/topology.hpp"
 #include "internal/ucx/context.hpp"
 #include "internal/ucx/memory_block.hpp"
 #include "internal/ucx/registration_cache.hpp"
 #include "internal/ucx/registration_resource.hpp"
 
+#include "mrc/core/bitmap.hpp"
 #include "mrc/memory/adaptors.hpp"
 #include "mrc/memory/buffer.hpp"
 #include "mrc/memory/literals.hpp"
 #include "mrc/memory/memory_kind.hpp"
 #include "mrc/memory/resources/arena_resource.hpp"
 #include "mrc/memory/resources/device/cuda_malloc_resource.hpp"
+#include "mrc/memory/resources/host/huge_page_memory_resource.hpp"
 #include "mrc/memory/resources/host/malloc_memory_resource.hpp"
 #include "mrc/memory/resources/host/pinned_memory_resource.hpp"
 #include "mrc/memory/resources/logging_resource.hpp"
 
 #include <glog/logging.h>
 #include <gtest/gtest.h>
+#include <hwloc.h>
 #include <spdlog/sinks/basic_file_sink.h>
 
 #include <array>
 #include <atomic>
 #include <cstddef>
+#include <cstdint>
+#include <cstring>
 #include <map>
 #include <memory>
 #include <optional>
@@ -201,7 +209,14 @@ TEST_F(TestMemory, TransientPool)
 
     internal::memory::TransientPool pool(10_MiB, 4, callback);
 
-    EXPECT_ANY_THROW(pool.await_buffer(11_MiB));
+    // requests larger than a block bypass the pool rather than throwing
+    {
+        auto large = pool.await_buffer(11_MiB);
+        EXPECT_EQ(large.bytes(), 11_MiB);
+        EXPECT_EQ(pool.stats().large_allocations, 1);
+        EXPECT_GE(pool.stats().bytes_in_use, 11_MiB);
+    }
+    EXPECT_EQ(pool.stats().bytes_in_use, 0);
 
     // this should get the starting address of each block
     std::vector<void*> starting_addr;
@@ -221,13 +236,14 @@ TEST_F(TestMemory, TransientPool)
         EXPECT_TRUE(addrs.at(i) == starting_addr.at(i));
     }
 
+    // the first object fills the remainder of the last block, after which each block holds two objects
     addrs.clear();
     for (int i = 0; i < 8; i++)
     {
         auto data = pool.await_object<StaticData>();
         addrs.push_back(data->array.data());
 
-        if (i % 2 == 0)
+        if (i % 2 == 1)
         {
             EXPECT_TRUE(addrs.at(i) == starting_addr.at(i / 2));
         }
@@ -268,3 +284,282 @@ TEST_F(TestMemory, TransientPool)
     EXPECT_FALSE(other_tick);
     EXPECT_EQ(some_int, 42);
 }
+
+TEST_F(TestMemory, TransientPoolConcurrent)
+{
+    struct alignas(64) CacheLine
+    {
+        std::array<std::uint32_t, 8> words;
+    };
+
+    auto malloc = std::make_shared<mrc::memory::malloc_memory_resource>();
+    internal::memory::TransientPool pool(1_MiB, 4, malloc);
+
+    auto large = pool.await_buffer(2_MiB, 4096);
+    EXPECT_EQ(reinterpret_cast<std::uintptr_t>(large.data()) % 4096, 0);
+    large.release();
+
+    constexpr std::size_t thread_count = 4;
+    constexpr std::size_t iterations   = 10000;
+
+    std::vector<std::thread> threads;
+    std::atomic_size_t errors = 0;
+    for (std::size_t t = 0; t < thread_count; t++)
+    {
+        threads.emplace_back([&pool, &errors, t] {
+            // keep a window of live allocations so overlapping ranges from concurrent threads would be detected
+            std::vector<internal::memory::Transient<CacheLine>> live;
+            for (std::size_t i = 0; i < iterations; i++)
+            {
+                auto object = pool.await_object<CacheLine>();
+                if (reinterpret_cast<std::uintptr_t>(&*object) % alignof(CacheLine) != 0)
+                {
+                    errors++;
+                }
+                object->words.fill(t);
+                live.push_back(std::move(object));
+
+                if (live.size() == 16)
+                {
+                    for (auto& item : live)
+                    {
+                        for (auto word : item->words)
+                        {
+                            errors += (word != t ? 1 : 0);
+                        }
+                    }
+                    live.clear();
+                }
+            }
+        });
+    }
+
+    for (auto& thread : threads)
+    {
+        thread.join();
+    }
+
+    EXPECT_EQ(errors, 0);
+
+    auto stats = pool.stats();
+    EXPECT_EQ(stats.allocations, thread_count * iterations + 1);
+    EXPECT_EQ(stats.large_allocations, 1);
+    EXPECT_GE(stats.high_water_bytes, 2_MiB);
+
+    // only the bump regions still hold on to their blocks
+    EXPECT_LE(stats.bytes_in_use, stats.high_water_bytes);
+    EXPECT_GT(stats.bytes_in_use, 0);
+}
+
+TEST_F(TestMemory, SlabPool)
+{
+    auto malloc = std::make_shared<mrc::memory::malloc_memory_resource>();
+    std::optional<internal::memory::SlabPool> pool;
+    pool.emplace(1000, 4, 2, malloc);
+
+    // slot sizes are rounded up to keep every slot aligned
+    EXPECT_EQ(pool->slot_size() % alignof(std::max_align_t), 0);
+    EXPECT_GE(pool->slot_size(), 1000);
+    EXPECT_EQ(pool->capacity(), 0);
+
+    std::vector<internal::memory::TransientBuffer> slots;
+    for (int i = 0; i < 8; i++)
+    {
+        slots.push_back(pool->try_acquire());
+        EXPECT_NE(slots.back().data(), nullptr);
+        EXPECT_EQ(slots.back().bytes(), pool->slot_size());
+    }
+    EXPECT_EQ(pool->capacity(), 8);
+    EXPECT_EQ(pool->slots_in_use(), 8);
+
+    // both slabs are exhausted
+    EXPECT_EQ(pool->try_acquire().data(), nullptr);
+
+    // a shallow copy keeps the slot in use until both are released
+    auto* addr = slots.front().data();
+    internal::memory::TransientBuffer shallow(addr, 10, slots.front());
+    slots.front().release();
+    EXPECT_EQ(pool->slots_in_use(), 8);
+    shallow.release();
+    EXPECT_EQ(pool->slots_in_use(), 7);
+
+    auto recycled = pool->try_acquire();
+    EXPECT_EQ(recycled.data(), addr);
+    EXPECT_EQ(pool->high_water_slots(), 8);
+
+    // outstanding slots remain valid after the pool is destroyed
+    pool.reset();
+    std::memset(recycled.data(), 0, recycled.bytes());
+    recycled.release();
+    slots.clear();
+}
+
+TEST_F(TestMemory, NumaMemoryResource)
+{
+    auto topology = internal::system::Topology::Create();
+
+    for (std::uint32_t numa_id = 0; numa_id < topology->numa_count(); ++numa_id)
+    {
+        auto numa_set = topology->numaset_for_cpuset(topology->numa_cpuset(numa_id));
+        auto mr       = std::make_shared<internal::memory::NumaMemoryResource>(*topology, numa_set);
+
+        auto md = buffer(4_MiB, mr);
+        EXPECT_EQ(md.kind(), memory_kind::host);
+        EXPECT_EQ(reinterpret_cast<std::uintptr_t>(md.data()) % alignof(std::max_align_t), 0);
+
+        // fault the pages in, then ask the OS where they landed
+        std::memset(md.data(), 0, md.bytes());
+
+        NumaSet location;
+        if (hwloc_get_area_memlocation(
+                topology->handle(), md.data(), md.bytes(), &location.bitmap(), HWLOC_MEMBIND_BYNODESET) == 0 &&
+            !location.empty())
+        {
+            EXPECT_TRUE(hwloc_bitmap_isincluded(&location.bitmap(), &numa_set.bitmap()))
+                << "memory for numa node " << numa_id << " was placed on " << location;
+        }
+    }
+
+    // zero byte buffers never reach hwloc
+    auto mr = std::make_shared<internal::memory::NumaMemoryResource>(*topology,
+                                                                     topology->numaset_for_cpuset(topology->cpu_set()));
+    auto empty = buffer(0, mr);
+    EXPECT_TRUE(empty.empty());
+}
+
+TEST_F(TestMemory, NumaBindingAdaptor)
+{
+    auto topology = internal::system::Topology::Create();
+    auto numa_set = topology->numaset_for_cpuset(topology->numa_cpuset(0));
+
+    // malloc'd allocations are not page aligned; only the whole pages of large ones are bound
+    auto mr = memory::make_shared_resource<internal::memory::NumaBindingAdaptor>(
+        std::make_shared<mrc::memory::malloc_memory_resource>(), *topology, numa_set, 1_MiB);
+
+    auto small = buffer(1_KiB, mr);
+    auto large = buffer(4_MiB + 123, mr);
+    std::memset(small.data(), 0, small.bytes());
+    std::memset(large.data(), 0, large.bytes());
+
+    NumaSet location;
+    if (hwloc_get_area_memlocation(
+            topology->handle(), large.data(), large.bytes(), &location.bitmap(), HWLOC_MEMBIND_BYNODESET) == 0 &&
+        !location.empty())
+    {
+        EXPECT_TRUE(hwloc_bitmap_isincluded(&location.bitmap(), &numa_set.bitmap())) << "placed on " << location;
+    }
+
+    // huge pages are bound first and prefaulted by the adaptor, so they are populated on the bound nodes
+    auto huge_pages = memory::make_shared_resource<internal::memory::NumaBindingAdaptor>(
+        std::make_shared<huge_page_memory_resource>(huge_page_memory_resource::huge_page_2mib, false),
+        *topology,
+        numa_set,
+        0,
+        /*prefault=*/true);
+
+    auto prefaulted = buffer(4_MiB, huge_pages);
+    if (hwloc_get_area_memlocation(topology->handle(),
+                                   prefaulted.data(),
+                                   prefaulted.bytes(),
+                                   &location.bitmap(),
+                                   HWLOC_MEMBIND_BYNODESET) == 0 &&
+        !location.empty())
+    {
+        EXPECT_TRUE(hwloc_bitmap_isincluded(&location.bitmap(), &numa_set.bitmap())) << "placed on " << location;
+    }
+}
+
+TEST_F(TestMemory, HugePageMemoryResource)
+{
+    // explicit pages fall back to transparent huge pages when no hugetlbfs pages are reserved, so every mode works
+    for (bool use_hugetlbfs : {false, true})
+    {
+        auto huge_pages = std::make_shared<huge_page_memory_resource>(
+            huge_page_memory_resource::huge_page_2mib, use_hugetlbfs, /*prefault=*/true);
+
+        auto md = buffer(3_MiB, huge_pages);
+        EXPECT_EQ(md.kind(), memory_kind::host);
+        EXPECT_EQ(reinterpret_cast<std::uintptr_t>(md.data()) % huge_pages->page_size(), 0);
+        std::memset(md.data(), 0xff, md.bytes());
+        md.release();
+
+        // the arena draws its superblocks from the huge page resource
+        auto arena = memory::make_shared_resource<arena_resource>(huge_pages, 4_MiB, 16_MiB);
+        auto small = buffer(1_KiB, arena);
+        auto large = buffer(6_MiB, arena);
+        std::memset(small.data(), 0, small.bytes());
+        std::memset(large.data(), 0, large.bytes());
+    }
+
+    EXPECT_TRUE(buffer(0, std::make_shared<huge_page_memory_resource>(huge_page_memory_resource::huge_page_2mib, false))
+                    .empty());
+}
+
+TEST_F(TestMemory, ArenaThreadCaches)
+{
+    auto malloc = std::make_shared<mrc::memory::malloc_memory_resource>();
+    auto arena  = memory::make_shared_resource<arena_resource>(malloc, 4_MiB, 64_MiB);
+
+    // small sizes are rounded up to their size class, so a freed block serves any size of the same class
+    EXPECT_EQ(detail::arena::round_to_size_class(1000), 1_KiB);
+    EXPECT_EQ(detail::arena::round_to_size_class(1100), 1280);
+    EXPECT_EQ(detail::arena::round_to_size_class(64_KiB + 1), 64_KiB + 256);
+
+    auto* first = arena->allocate(1000);
+    arena->deallocate(first, 1000);
+    auto* second = arena->allocate(900);
+    EXPECT_EQ(second, first);
+    arena->deallocate(second, 900);
+
+    auto stats = arena->stats();
+    EXPECT_EQ(stats.cache_hits, 1);
+    EXPECT_EQ(stats.cache_misses, 1);
+    EXPECT_DOUBLE_EQ(stats.hit_rate(), 0.5);
+
+    constexpr std::size_t thread_count = 4;
+    constexpr std::size_t iterations   = 10000;
+
+    std::vector<std::thread> threads;
+    std::atomic_size_t errors = 0;
+    for (std::size_t t = 0; t < thread_count; t++)
+    {
+        threads.emplace_back([&arena, &errors, t] {
+            // keep a window of live buffers of mixed sizes, including some larger than a superblock, so blocks handed
+            // out twice would be detected
+            std::vector<buffer> live;
+            for (std::size_t i = 0; i < iterations; i++)
+            {
+                const std::size_t bytes = (i % 97 == 0) ? 300_KiB : 256 * (1 + (i * 7 + t) % 64);
+                auto& md                = live.emplace_back(bytes, arena);
+                std::memset(md.data(), static_cast<int>(t), md.bytes());
+
+                if (live.size() == 16)
+                {
+                    for (auto& item : live)
+                    {
+                        const auto* data = static_cast<const std::uint8_t*>(item.data());
+                        const auto byte  = static_cast<std::uint8_t>(t);
+                        errors += (data[0] != byte || data[item.bytes() - 1] != byte) ? 1 : 0;
+                    }
+                    live.clear();
+                }
+            }
+        });
+    }
+
+    for (auto& thread : threads)
+    {
+        thread.join();
+    }
+
+    EXPECT_EQ(errors, 0);
+
+    stats = arena->stats();
+    EXPECT_EQ(stats.cache_hits + stats.cache_misses, 2 + thread_count * (iterations - iterations / 97 - 1));
+    EXPECT_GT(stats.hit_rate(), 0.5);
+    EXPECT_GT(stats.lock_acquisitions, 0);
+    EXPECT_LE(stats.contended_acquisitions, stats.lock_acquisitions);
+    EXPECT_LE(stats.free_bytes, stats.current_size);
+    EXPECT_GE(stats.fragmentation(), 0.0);
+    EXPECT_LT(stats.fragmentation(), 1.0);
+}
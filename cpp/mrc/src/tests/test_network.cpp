@@ -59,8 +59,11 @@
 #include <spdlog/sinks/basic_file_sink.h>
 
 #include <atomic>
+#include <chrono>
 #include <cstddef>
 #include <cstdint>
+#include <cstdlib>
+#include <cstring>
 #include <functional>
 #include <map>
 #include <memory>
@@ -88,6 +91,34 @@ static std::shared_ptr<internal::system::System> make_system(std::function<void(
 class TestNetwork : public ::testing::Test
 {};
 
+/**
+ * @brief Restricts ucx to host-only loopback transports for the duration of a test, unless UCX_TLS is already set in
+ * the environment, in which case the explicit setting takes precedence
+ */
+class TestNetworkHostTransports : public TestNetwork
+{
+  protected:
+    void SetUp() override
+    {
+        m_set_tls = std::getenv("UCX_TLS") == nullptr;
+        if (m_set_tls)
+        {
+            setenv("UCX_TLS", "tcp,sm,self", 1);  // NOLINT
+        }
+    }
+
+    void TearDown() override
+    {
+        if (m_set_tls)
+        {
+            unsetenv("UCX_TLS");  // NOLINT
+        }
+    }
+
+  private:
+    bool m_set_tls{false};
+};
+
 TEST_F(TestNetwork, Arena)
 {
     std::shared_ptr<mrc::memory::memory_resource> mr;
@@ -365,6 +396,109 @@ TEST_F(TestNetwork, PersistentEagerDataPlaneTaggedRecv)
 
     resources.reset();
 }
+
+TEST_F(TestNetworkHostTransports, EagerBurstAndRendezvousDataPlaneTaggedRecv)
+{
+    auto resources = std::make_unique<internal::resources::Manager>(
+        internal::system::SystemProvider(make_system([](Options& options) {
+            options.enable_server(true);
+            options.architect_url("localhost:13337");
+            options.placement().resources_strategy(PlacementResources::Dedicated);
+            options.resources().enable_host_memory_pool(true);
+            options.resources().host_memory_pool().block_size(32_MiB);
+            options.resources().host_memory_pool().max_aggregate_bytes(128_MiB);
+        })));
+
+    if (resources->partition_count() < 2)
+    {
+        GTEST_SKIP() << "this test requires 2 partitions";
+    }
+
+    auto f1 = resources->partition(0).network()->control_plane().client().connections().update_future();
+    auto f2 = resources->partition(1).network()->control_plane().client().connections().update_future();
+    resources->partition(0).network()->control_plane().client().request_update();
+    f1.get();
+    f2.get();
+
+    auto& r0 = resources->partition(0).network()->data_plane();
+    auto& r1 = resources->partition(1).network()->data_plane();
+
+    const std::uint64_t tag         = 20920;
+    const std::size_t eager_count   = 256;
+    const std::size_t rendezvous_sz = 4_MiB;
+
+    std::atomic<std::size_t> eager_counter      = 0;
+    std::atomic<std::size_t> rendezvous_counter = 0;
+
+    std::size_t initial_pre_posted = r0.server().pre_posted_recv_count();
+    EXPECT_GT(initial_pre_posted, 0);
+
+    // with a window spanning the whole test, the burst below grows the pre-posted recvs as soon as every one of them
+    // has completed once, regardless of how quickly the messages arrive
+    r0.server().set_pre_post_growth_window(std::chrono::hours(1));
+
+    auto recv_sink = std::make_unique<node::RxSink<internal::memory::TransientBuffer>>(
+        [&](internal::memory::TransientBuffer buffer) {
+            if (buffer.bytes() == rendezvous_sz)
+            {
+                const auto* data = static_cast<const std::uint8_t*>(buffer.data());
+                EXPECT_EQ(data[0], 7);
+                EXPECT_EQ(data[rendezvous_sz - 1], 7);
+                rendezvous_counter++;
+            }
+            else
+            {
+                EXPECT_EQ(buffer.bytes(), 128);
+                eager_counter++;
+            }
+
+            if (eager_counter + rendezvous_counter == eager_count + 1)
+            {
+                r0.server().deserialize_source().drop_edge(tag);
+            }
+        });
+
+    auto deser_source = r0.server().deserialize_source().get_source(tag);
+    mrc::make_edge(*deser_source, *recv_sink);
+
+    auto launch_opts = resources->partition(0).network()->data_plane().launch_options(1);
+    auto recv_runner = resources->partition(0)
+                           .runnable()
+                           .launch_control()
+                           .prepare_launcher(launch_opts, std::move(recv_sink))
+                           ->ignition();
+
+    auto endpoint = r1.client().endpoint_shared(r0.instance_id());
+
+    // issue a burst of eager messages larger than the initial number of pre-posted recvs
+    auto eager_buffer = resources->partition(1).host().make_buffer(128);
+    std::vector<internal::data_plane::Request> requests(eager_count);
+    for (auto& req : requests)
+    {
+        r1.client().async_send(eager_buffer.data(), eager_buffer.bytes(), tag | TAG_EGR_MSG, *endpoint, req);
+    }
+    for (auto& req : requests)
+    {
+        EXPECT_TRUE(req.await_complete());
+    }
+
+    // a message larger than the pre-posted recv buffers is probed for and received into a buffer of its exact size
+    auto rendezvous_buffer = resources->partition(1).host().make_buffer(rendezvous_sz);
+    std::memset(rendezvous_buffer.data(), 7, rendezvous_sz);
+    internal::data_plane::Request rendezvous_req;
+    r1.client().async_send(
+        rendezvous_buffer.data(), rendezvous_buffer.bytes(), tag | TAG_RND_MSG, *endpoint, rendezvous_req);
+    EXPECT_TRUE(rendezvous_req.await_complete());
+
+    recv_runner->await_join();
+    EXPECT_EQ(eager_counter, eager_count);
+    EXPECT_EQ(rendezvous_counter, 1);
+    // the burst consumed every pre-posted recv within the growth window
+    EXPECT_GT(r0.server().pre_posted_recv_count(), initial_pre_posted);
+
+    resources.reset();
+}
+
 // TEST_F(TestNetwork, NetworkEventsManagerLifeCycle)
 // {
 //     auto launcher = m_launch_control->prepare_launcher(std::move(m_mutable_nem));
@@ -15,10 +15,12 @@
  * limitations under the License.
  */
 
+#include "internal/segment/placement.hpp"
 #include "internal/system/device_partition.hpp"
 #include "internal/system/engine_factory_cpu_sets.hpp"
 #include "internal/system/gpu_info.hpp"
 #include "internal/system/host_partition.hpp"
+#include "internal/system/partition.hpp"
 #include "internal/system/partitions.hpp"
 #include "internal/system/topology.hpp"
 
@@ -27,6 +29,7 @@
 #include "mrc/options/options.hpp"
 #include "mrc/options/placement.hpp"
 #include "mrc/options/topology.hpp"
+#include "mrc/runnable/launch_options.hpp"
 #include "mrc/runnable/types.hpp"
 
 #include <glog/logging.h>
@@ -739,4 +742,36 @@ TEST_P(TestPartitions, EngineFactoryScenario11)
     EXPECT_FALSE(cpu_sets.shared_cpus_has_fibers);
 }
 
+TEST_P(TestPartitions, ResolvePlacement)
+{
+    auto options    = make_options([](Options& options) {
+        options.placement().resources_strategy(PlacementResources::Dedicated);
+    });
+    auto partitions = make_partitions(options);
+    ASSERT_EQ(partitions->flattened().size(), 4);
+
+    using mrc::runnable::CpuSetPlacement;
+    using mrc::runnable::NumaNodePlacement;
+    using mrc::runnable::PartitionPlacement;
+    using internal::segment::resolve_placement;
+
+    // no hint
+    EXPECT_EQ(resolve_placement({}, *partitions, 1), 1);
+
+    // explicit partitions; out of range ids fall back to the default
+    EXPECT_EQ(resolve_placement(PartitionPlacement{2}, *partitions, 1), 2);
+    EXPECT_EQ(resolve_placement(PartitionPlacement{4}, *partitions, 1), 1);
+
+    // the partition with the largest cpu overlap wins; the default wins ties
+    EXPECT_EQ(resolve_placement(CpuSetPlacement{CpuSet(std::string("20-23"))}, *partitions, 0), 1);
+    EXPECT_EQ(resolve_placement(CpuSetPlacement{CpuSet(std::string("14-19"))}, *partitions, 3), 1);
+    EXPECT_EQ(resolve_placement(CpuSetPlacement{CpuSet(std::string("14-17"))}, *partitions, 0), 0);
+    EXPECT_EQ(resolve_placement(CpuSetPlacement{CpuSet(std::string("1000"))}, *partitions, 2), 2);
+
+    // the default partition is preferred if it is on the requested numa node
+    const auto numa_id = partitions->flattened().at(3).host().numa_set().first();
+    EXPECT_EQ(resolve_placement(NumaNodePlacement{numa_id}, *partitions, 3), 3);
+    EXPECT_EQ(resolve_placement(NumaNodePlacement{1000}, *partitions, 2), 2);
+}
+
 INSTANTIATE_TEST_SUITE_P(Topos, TestPartitions, testing::Values("dgx_a100_station_topology"));
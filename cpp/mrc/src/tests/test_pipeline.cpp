@@ -23,11 +23,16 @@
 #include "internal/pipeline/types.hpp"
 #include "internal/resources/manager.hpp"
 #include "internal/system/system.hpp"
+#include "internal/system/host_partition.hpp"
+#include "internal/system/partition.hpp"
+#include "internal/system/partitions.hpp"
 #include "internal/system/system_provider.hpp"
 #include "internal/system/topology.hpp"
 #include "internal/utils/collision_detector.hpp"
 
+#include "mrc/channel/buffered_channel.hpp"
 #include "mrc/channel/channel.hpp"
+#include "mrc/constants.hpp"
 #include "mrc/core/addresses.hpp"
 #include "mrc/core/executor.hpp"
 #include "mrc/data/reusable_pool.hpp"
@@ -44,6 +49,7 @@
 #include "mrc/options/topology.hpp"
 #include "mrc/pipeline/pipeline.hpp"
 #include "mrc/runnable/context.hpp"
+#include "mrc/runnable/launch_options.hpp"
 #include "mrc/runnable/types.hpp"
 #include "mrc/segment/builder.hpp"
 #include "mrc/segment/egress_ports.hpp"
@@ -55,8 +61,10 @@
 #include <glog/logging.h>
 #include <gtest/gtest.h>
 #include <rxcpp/rx.hpp>
+#include <sched.h>
 
 #include <array>
+#include <atomic>
 #include <chrono>
 #include <cstddef>
 #include <functional>
@@ -513,6 +521,182 @@ TEST_F(TestPipeline, Nodes1k)
     LOG(INFO) << " time in us: " << std::chrono::duration<double>(end - start).count();
 }
 
+TEST_F(TestPipeline, PlacedNodes)
+{
+    auto system = make_system([](Options& options) {
+        options.placement().cpu_strategy(PlacementStrategy::PerNumaNode);
+        options.topology().restrict_gpus(true);
+    });
+
+    const auto& partitions = system->partitions().flattened();
+    if (partitions.size() < 2)
+    {
+        GTEST_SKIP() << "placement requires at least two partitions; found " << partitions.size();
+    }
+
+    mrc::channel::set_default_channel_size(8);
+    const auto deep_channel_size = mrc::channel::cross_partition_channel_size();
+    ASSERT_GT(deep_channel_size, mrc::channel::default_channel_size());
+
+    std::atomic<std::size_t> written{0};
+    std::atomic<int> source_cpu{-1};
+    std::atomic<int> sink_cpu{-1};
+    std::size_t buffered = 0;
+    std::size_t received = 0;
+
+    auto pipeline = pipeline::make_pipeline();
+    pipeline->make_segment("seg_1", [&](segment::Builder& s) {
+        auto source = s.make_source<int>("source", [&](rxcpp::subscriber<int> sub) {
+            source_cpu = sched_getcpu();
+            for (std::size_t i = 0; i < 4 * deep_channel_size && sub.is_subscribed(); ++i)
+            {
+                sub.on_next(static_cast<int>(i));
+                ++written;
+            }
+            sub.on_completed();
+        });
+
+        auto sink = s.make_sink<int>("sink", [&](int value) {
+            if (received++ == 0)
+            {
+                sink_cpu = sched_getcpu();
+
+                // hold the first value until the source is blocked on the full channel
+                std::size_t last = 0;
+                do
+                {
+                    last = written;
+                    boost::this_fiber::sleep_for(std::chrono::milliseconds(50));
+                } while (written != last);
+                buffered = written;
+            }
+        });
+
+        // the sink is placed on another partition than the segment, so its input edge crosses partitions
+        sink->launch_options().placement = runnable::PartitionPlacement{1};
+        sink->object().set_read_batch(1);
+
+        s.make_edge(source, sink);
+    });
+
+    auto resources = internal::resources::Manager(internal::system::SystemProvider(system));
+    auto manager   = std::make_unique<internal::pipeline::Manager>(unwrap(*pipeline), resources);
+
+    internal::pipeline::SegmentAddresses update;
+    update[segment_address_encode(segment_name_hash("seg_1"), 0)] = 0;
+
+    manager->service_start();
+    manager->push_updates(std::move(update));
+    manager->service_await_join();
+
+    mrc::channel::set_default_channel_size(MRC_DEFAULT_BUFFERED_CHANNEL_SIZE);
+    mrc::channel::set_cross_partition_channel_size(0);
+
+    EXPECT_EQ(received, 4 * deep_channel_size);
+
+    // each runnable was launched on the LaunchControl of its own partition
+    ASSERT_GE(source_cpu, 0);
+    ASSERT_GE(sink_cpu, 0);
+    EXPECT_TRUE(partitions.at(0).host().cpu_set().is_set(source_cpu));
+    EXPECT_TRUE(partitions.at(1).host().cpu_set().is_set(sink_cpu));
+
+    // the source filled the deeper cross-partition channel, plus the value held by the sink and the one being written
+    EXPECT_GE(buffered, deep_channel_size);
+    EXPECT_LE(buffered, deep_channel_size + 2);
+}
+
+TEST_F(TestPipeline, PlacedNodesKeepUserChannels)
+{
+    auto system = make_system([](Options& options) {
+        options.topology().restrict_gpus(true);
+    });
+
+    // the placed channel swap is tested on its own, without the lock-free channel swap taking precedence
+    mrc::channel::set_lock_free_edge_channels(false);
+    mrc::channel::set_default_channel_size(8);
+
+    const std::size_t placed_channel_size = 32;
+    const std::size_t user_channel_size   = 16;
+    const std::size_t count               = 4 * placed_channel_size;
+
+    struct Stream
+    {
+        std::atomic<std::size_t> written{0};
+        std::size_t buffered{0};
+        std::size_t received{0};
+    };
+
+    Stream default_stream;
+    Stream user_stream;
+
+    auto pipeline = pipeline::make_pipeline();
+    pipeline->make_segment("seg_1", [&](segment::Builder& s) {
+        auto make_stream = [&](const std::string& name, Stream& stream) {
+            auto source = s.make_source<int>(name + "_source", [&stream, count](rxcpp::subscriber<int> sub) {
+                for (std::size_t i = 0; i < count && sub.is_subscribed(); ++i)
+                {
+                    sub.on_next(static_cast<int>(i));
+                    ++stream.written;
+                }
+                sub.on_completed();
+            });
+
+            auto sink = s.make_sink<int>(name + "_sink", [&stream](int value) {
+                if (stream.received++ == 0)
+                {
+                    // hold the first value until the source is blocked on the full channel
+                    std::size_t last = 0;
+                    do
+                    {
+                        last = stream.written;
+                        boost::this_fiber::sleep_for(std::chrono::milliseconds(50));
+                    } while (stream.written != last);
+                    stream.buffered = stream.written;
+                }
+            });
+
+            // placed on the partition of the segment, so its input edge does not cross partitions
+            sink->launch_options().placement = runnable::PartitionPlacement{0};
+            sink->object().set_read_batch(1);
+
+            s.make_edge(source, sink);
+            return sink;
+        };
+
+        make_stream("default", default_stream);
+        auto user_sink = make_stream("user", user_stream);
+        user_sink->object().set_channel(std::make_unique<mrc::channel::BufferedChannel<int>>(user_channel_size));
+
+        // the default channels were allocated with the previous size; a replaced channel is allocated with this one
+        mrc::channel::set_default_channel_size(placed_channel_size);
+    });
+
+    auto resources = internal::resources::Manager(internal::system::SystemProvider(system));
+    auto manager   = std::make_unique<internal::pipeline::Manager>(unwrap(*pipeline), resources);
+
+    internal::pipeline::SegmentAddresses update;
+    update[segment_address_encode(segment_name_hash("seg_1"), 0)] = 0;
+
+    manager->service_start();
+    manager->push_updates(std::move(update));
+    manager->service_await_join();
+
+    mrc::channel::set_default_channel_size(MRC_DEFAULT_BUFFERED_CHANNEL_SIZE);
+    mrc::channel::set_lock_free_edge_channels(true);
+
+    EXPECT_EQ(default_stream.received, count);
+    EXPECT_EQ(user_stream.received, count);
+
+    // the default channel of the placed sink was replaced by one allocated on its partition; the source filled it,
+    // plus the value held by the sink and the one being written
+    EXPECT_GE(default_stream.buffered, placed_channel_size);
+    EXPECT_LE(default_stream.buffered, placed_channel_size + 2);
+
+    // the channel installed by the user was kept
+    EXPECT_GE(user_stream.buffered, user_channel_size);
+    EXPECT_LE(user_stream.buffered, user_channel_size + 2);
+}
+
 TEST_F(TestPipeline, EngineFactories)
 {
     auto topology = mrc::internal::system::Topology::Create();
@@ -27,6 +27,7 @@
 #include "mrc/options/engine_groups.hpp"
 #include "mrc/options/options.hpp"
 #include "mrc/options/topology.hpp"
+#include "mrc/runnable/autoscaler_policy.hpp"
 #include "mrc/runnable/context.hpp"  // IWYU pragma: keep (for static_asserts)
 #include "mrc/runnable/fiber_context.hpp"
 #include "mrc/runnable/forward.hpp"
@@ -44,12 +45,14 @@
 #include <gtest/gtest.h>
 #include <rxcpp/rx.hpp>
 
+#include <algorithm>
 #include <atomic>
 #include <chrono>
 #include <cstddef>
 #include <functional>
 #include <map>
 #include <memory>
+#include <mutex>
 #include <sstream>
 #include <string>
 #include <thread>
@@ -134,6 +137,21 @@ class TestFiberRunnable final : public runnable::FiberRunnable<>
     int i;
 };
 
+// delegates the scaling decisions to a test supplied function
+class FunctionAutoscalerPolicy final : public runnable::AutoscalerPolicy
+{
+  public:
+    FunctionAutoscalerPolicy(std::function<std::size_t(const runnable::AutoscalerSample&)> fn) : m_fn(std::move(fn)) {}
+
+    std::size_t target_instance_count(const runnable::AutoscalerSample& sample) final
+    {
+        return m_fn(sample);
+    }
+
+  private:
+    std::function<std::size_t(const runnable::AutoscalerSample&)> m_fn;
+};
+
 class TestThreadRunnable final : public runnable::ThreadRunnable<>
 {
     void run(ContextType& ctx) final
@@ -344,6 +362,208 @@ TEST_F(TestRunnable, RxSourceToMuxerToRxSink)
     EXPECT_EQ(counter, 3);
 }
 
+TEST_F(TestRunnable, UtilizationAutoscalerPolicy)
+{
+    runnable::UtilizationAutoscalerPolicy policy(0.8, 0.3, 2);
+
+    auto sample = [](std::size_t instance_count, std::size_t queue_depth, double utilization) {
+        return runnable::AutoscalerSample{instance_count, 1, 8, queue_depth, utilization};
+    };
+
+    // a change is only made once its condition held for two samples in a row
+    EXPECT_EQ(policy.target_instance_count(sample(2, 10, 0.95)), 2);
+    EXPECT_EQ(policy.target_instance_count(sample(2, 10, 0.5)), 2);
+    EXPECT_EQ(policy.target_instance_count(sample(2, 10, 0.95)), 2);
+    EXPECT_EQ(policy.target_instance_count(sample(2, 10, 0.95)), 4);
+
+    // busy instances without a backlog are not scaled up
+    EXPECT_EQ(policy.target_instance_count(sample(4, 0, 0.95)), 4);
+    EXPECT_EQ(policy.target_instance_count(sample(4, 0, 0.95)), 4);
+
+    EXPECT_EQ(policy.target_instance_count(sample(4, 0, 0.1)), 4);
+    EXPECT_EQ(policy.target_instance_count(sample(4, 0, 0.1)), 1);
+}
+
+TEST_F(TestRunnable, ElasticRxSink)
+{
+    std::atomic<std::size_t> counter = 0;
+    std::mutex mutex;
+    std::map<std::size_t, std::size_t> values_per_rank;
+    std::unique_ptr<runnable::Runner> runner_source;
+    std::unique_ptr<runnable::Runner> runner_sink;
+
+    {
+        // the source is faster than a single sink instance, so every instance gets a share of the values
+        auto source = std::make_unique<node::RxSource<float>>(
+            rxcpp::observable<>::create<float>([](rxcpp::subscriber<float> s) {
+                for (int i = 0; i < 100; ++i)
+                {
+                    s.on_next(static_cast<float>(i));
+                    boost::this_fiber::sleep_for(std::chrono::milliseconds(1));
+                }
+                s.on_completed();
+            }));
+        auto sink = std::make_unique<node::RxSink<float>>(rxcpp::make_observer_dynamic<float>([&](float x) {
+            boost::this_fiber::sleep_for(std::chrono::milliseconds(5));
+            std::lock_guard<decltype(mutex)> lock(mutex);
+            ++values_per_rank[runnable::Context::get_runtime_context().rank()];
+            ++counter;
+        }));
+        sink->set_read_batch(1);
+
+        mrc::make_edge(*source, *sink);
+
+        runnable::LaunchOptions options;
+        options.max_instances      = 3;
+        options.autoscale_interval = std::chrono::hours(1);
+
+        runner_sink = m_resources->launch_control().prepare_launcher(options, std::move(sink))->ignition();
+
+        EXPECT_EQ(runner_sink->add_instances(2), 2);
+        EXPECT_EQ(runner_sink->instance_count(), 3);
+
+        runner_source = m_resources->launch_control().prepare_launcher(std::move(source))->ignition();
+    }
+
+    runner_source->await_join();
+
+    // only the elastic instances can be retired
+    EXPECT_EQ(runner_sink->retire_instances(3), 2);
+    EXPECT_EQ(runner_sink->instance_count(), 1);
+
+    runner_sink->await_join();
+
+    EXPECT_EQ(counter, 100);
+    EXPECT_EQ(values_per_rank.size(), 3);
+    EXPECT_GT(values_per_rank[1], 0);
+    EXPECT_GT(values_per_rank[2], 0);
+}
+
+TEST_F(TestRunnable, ElasticRxSinkCompletesAtEndOfStream)
+{
+    std::atomic<std::size_t> counter               = 0;
+    std::atomic<std::size_t> completions           = 0;
+    std::atomic<std::size_t> counter_at_completion = 0;
+    std::unique_ptr<runnable::Runner> runner_source;
+    std::unique_ptr<runnable::Runner> runner_sink;
+
+    {
+        auto source = std::make_unique<node::RxSource<float>>(
+            rxcpp::observable<>::create<float>([](rxcpp::subscriber<float> s) {
+                for (int i = 0; i < 100; ++i)
+                {
+                    s.on_next(static_cast<float>(i));
+                    boost::this_fiber::sleep_for(std::chrono::milliseconds(1));
+                }
+                s.on_completed();
+            }));
+        auto sink = std::make_unique<node::RxSink<float>>(rxcpp::make_observer_dynamic<float>(
+            [&](float x) {
+                boost::this_fiber::sleep_for(std::chrono::milliseconds(5));
+                ++counter;
+            },
+            [&] {
+                counter_at_completion = counter.load();
+                ++completions;
+            }));
+        sink->set_read_batch(1);
+
+        mrc::make_edge(*source, *sink);
+
+        runnable::LaunchOptions options;
+        options.max_instances      = 3;
+        options.autoscale_interval = std::chrono::hours(1);
+
+        runner_sink = m_resources->launch_control().prepare_launcher(options, std::move(sink))->ignition();
+        EXPECT_EQ(runner_sink->add_instances(2), 2);
+
+        runner_source = m_resources->launch_control().prepare_launcher(std::move(source))->ignition();
+    }
+
+    // scale down while the source is still writing
+    while (counter < 20)
+    {
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+    EXPECT_EQ(runner_sink->retire_instances(2), 2);
+
+    runner_source->await_join();
+    runner_sink->await_join();
+
+    // the retired instances stopped without completing the observer; it was completed once, after every value
+    EXPECT_EQ(counter, 100);
+    EXPECT_EQ(completions, 1);
+    EXPECT_EQ(counter_at_completion, 100);
+}
+
+TEST_F(TestRunnable, AutoscaledRxSink)
+{
+    std::atomic<std::size_t> counter = 0;
+    std::mutex mutex;
+    std::map<std::size_t, std::size_t> values_per_rank;
+    std::vector<std::size_t> instance_counts;
+    std::unique_ptr<runnable::Runner> runner_source;
+    std::unique_ptr<runnable::Runner> runner_sink;
+
+    {
+        auto source = std::make_unique<node::RxSource<float>>(
+            rxcpp::observable<>::create<float>([](rxcpp::subscriber<float> s) {
+                for (int i = 0; i < 200; ++i)
+                {
+                    s.on_next(static_cast<float>(i));
+                    boost::this_fiber::sleep_for(std::chrono::milliseconds(1));
+                }
+                s.on_completed();
+            }));
+        auto sink = std::make_unique<node::RxSink<float>>(rxcpp::make_observer_dynamic<float>([&](float x) {
+            boost::this_fiber::sleep_for(std::chrono::milliseconds(5));
+            std::lock_guard<decltype(mutex)> lock(mutex);
+            ++values_per_rank[runnable::Context::get_runtime_context().rank()];
+            ++counter;
+        }));
+        sink->set_read_batch(1);
+
+        mrc::make_edge(*source, *sink);
+
+        runnable::LaunchOptions options;
+        options.max_instances      = 3;
+        options.autoscale_interval = std::chrono::milliseconds(5);
+
+        // scale up, back down to the launched instance and up again while the sink is running
+        auto policy = std::make_unique<FunctionAutoscalerPolicy>([&](const runnable::AutoscalerSample& sample) {
+            if (instance_counts.empty() || instance_counts.back() != sample.instance_count)
+            {
+                instance_counts.push_back(sample.instance_count);
+            }
+            const auto processed = counter.load();
+            return (processed < 60 || processed >= 120) ? sample.max_instances : sample.min_instances;
+        });
+
+        auto launcher = m_resources->launch_control().prepare_launcher(options, std::move(sink));
+        launcher->apply([&](runnable::Runner& runner) { runner.set_autoscaler_policy(std::move(policy)); });
+        runner_sink = launcher->ignition();
+
+        runner_source = m_resources->launch_control().prepare_launcher(std::move(source))->ignition();
+    }
+
+    runner_source->await_join();
+    runner_sink->await_join();
+
+    EXPECT_EQ(counter, 200);
+    ASSERT_EQ(values_per_rank.size(), 3);
+
+    // the policy saw the instances it added, then the retirement, then the instances it added again
+    auto grown   = std::find(instance_counts.begin(), instance_counts.end(), 3);
+    auto shrunk  = std::find(grown, instance_counts.end(), 1);
+    auto regrown = std::find(shrunk, instance_counts.end(), 3);
+    EXPECT_NE(regrown, instance_counts.end());
+
+    // the elastic instances processed values, and the instances added again reused the ranks of the retired ones
+    EXPECT_GT(values_per_rank[1], 0);
+    EXPECT_GT(values_per_rank[2], 0);
+    EXPECT_EQ(values_per_rank.rbegin()->first, 2);
+}
+
 // Move the remaining tests to TestNode
 
 // TEST_F(TestRunnable, ThreadRunnable)
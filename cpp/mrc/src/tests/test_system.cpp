@@ -24,6 +24,8 @@
 #include "internal/system/topology.hpp"
 
 #include "mrc/core/bitmap.hpp"
+#include "mrc/core/fiber_meta_data.hpp"
+#include "mrc/options/fiber_pool.hpp"
 #include "mrc/options/options.hpp"
 #include "mrc/options/topology.hpp"
 #include "mrc/types.hpp"
@@ -136,6 +138,138 @@ TEST_F(TestSystem, FiberPool)
     EXPECT_EQ(s0.size(), 1);
 }
 
+TEST_F(TestSystem, FiberPoolWorkStealing)
+{
+    auto system = system::make_system(make_options([](Options& options) {
+        options.topology().user_cpuset("0-255");
+        options.fiber_pool().enable_work_stealing(true);
+    }));
+
+    // steal groups never span numa nodes, so pick two cpus from the same node
+    auto numa_cpus = system->topology().numa_cpuset(0).vec();
+    if (numa_cpus.size() < 2)
+    {
+        GTEST_SKIP() << "work stealing requires at least two logical cpus on a numa node";
+    }
+
+    CpuSet cpu_set;
+    cpu_set.on(numa_cpus[0]);
+    cpu_set.on(numa_cpus[1]);
+
+    system::Resources resources((system::SystemProvider(system)));
+
+    auto pool = resources.make_fiber_pool(cpu_set, true);
+    EXPECT_EQ(pool.thread_count(), 2);
+
+    FiberMetaData stealable;
+    stealable.steal_group = pool.steal_group();
+    ASSERT_NE(stealable.steal_group, 0);
+
+    // hold thread 0 so both stealable tasks are launched on it before either runs
+    std::atomic<bool> gate_open{false};
+    auto gate = pool.enqueue(0, [&gate_open] {
+        while (!gate_open)
+        {
+            std::this_thread::sleep_for(std::chrono::milliseconds(1));
+        }
+    });
+
+    // each task blocks its os thread until both have started, which can only happen if the second task is stolen by
+    // the idle thread 1
+    std::atomic<int> started{0};
+    auto task = [&started] {
+        ++started;
+        auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds(10);
+        while (started < 2 && std::chrono::steady_clock::now() < deadline)
+        {
+            std::this_thread::sleep_for(std::chrono::milliseconds(1));
+        }
+        return std::this_thread::get_id();
+    };
+
+    auto f0 = pool.enqueue(0, stealable, task);
+    auto f1 = pool.enqueue(0, stealable, task);
+
+    gate_open = true;
+    gate.get();
+
+    std::set<std::thread::id> threads{f0.get(), f1.get()};
+    EXPECT_EQ(started, 2);
+    EXPECT_EQ(threads.size(), 2);
+}
+
+TEST_F(TestSystem, FiberPoolWorkStealingIsPerPool)
+{
+    auto system = system::make_system(make_options([](Options& options) {
+        options.topology().user_cpuset("0-255");
+        options.fiber_pool().enable_work_stealing(true);
+    }));
+
+    auto numa_cpus = system->topology().numa_cpuset(0).vec();
+    if (numa_cpus.size() < 3)
+    {
+        GTEST_SKIP() << "requires at least three logical cpus on a numa node";
+    }
+
+    // both pools share the thread on numa_cpus[0]
+    CpuSet cpu_set_a;
+    cpu_set_a.on(numa_cpus[0]);
+    cpu_set_a.on(numa_cpus[1]);
+
+    CpuSet cpu_set_b;
+    cpu_set_b.on(numa_cpus[0]);
+    cpu_set_b.on(numa_cpus[2]);
+
+    system::Resources resources((system::SystemProvider(system)));
+
+    auto pool_a = resources.make_fiber_pool(cpu_set_a, true);
+    auto pool_b = resources.make_fiber_pool(cpu_set_b, true);
+    ASSERT_NE(pool_a.steal_group(), 0);
+    ASSERT_NE(pool_b.steal_group(), 0);
+    EXPECT_NE(pool_a.steal_group(), pool_b.steal_group());
+
+    auto only_in_a = pool_a.enqueue(1, [] {
+        return std::this_thread::get_id();
+    });
+    const auto thread_only_in_a = only_in_a.get();
+
+    FiberMetaData stealable;
+    stealable.steal_group = pool_b.steal_group();
+
+    // hold the shared thread so the tasks of pool b queue up on it; the idle thread of pool a must not take them
+    std::atomic<bool> gate_open{false};
+    auto gate = pool_b.enqueue(0, [&gate_open] {
+        while (!gate_open)
+        {
+            std::this_thread::sleep_for(std::chrono::milliseconds(1));
+        }
+    });
+
+    std::atomic<int> started{0};
+    auto task = [&started] {
+        ++started;
+        auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds(10);
+        while (started < 2 && std::chrono::steady_clock::now() < deadline)
+        {
+            std::this_thread::sleep_for(std::chrono::milliseconds(1));
+        }
+        return std::this_thread::get_id();
+    };
+
+    auto f0 = pool_b.enqueue(0, stealable, task);
+    auto f1 = pool_b.enqueue(0, stealable, task);
+
+    // give the idle threads time to steal before the shared thread is released
+    std::this_thread::sleep_for(std::chrono::milliseconds(50));
+    gate_open = true;
+    gate.get();
+
+    std::set<std::thread::id> threads{f0.get(), f1.get()};
+    EXPECT_EQ(started, 2);
+    EXPECT_EQ(threads.size(), 2);
+    EXPECT_EQ(threads.count(thread_only_in_a), 0);
+}
+
 TEST_F(TestSystem, ImpossibleCoreCount)
 {
     auto system = system::make_system(make_options([](Options& options) {
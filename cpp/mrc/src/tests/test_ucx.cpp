@@ -17,9 +17,11 @@
 
 #include "common.hpp"
 
+#include "internal/ucx/adaptive_progress.hpp"
 #include "internal/ucx/all.hpp"
 #include "internal/ucx/endpoint.hpp"
 
+#include "mrc/options/progress_engine.hpp"
 #include "mrc/types.hpp"
 
 #include <boost/fiber/future/future.hpp>
@@ -71,6 +73,39 @@ TEST_F(TestUCX, CreateWorkerAddress)
     EXPECT_GT(address.length(), 0);
 }
 
+TEST_F(TestUCX, AdaptiveProgress)
+{
+    auto worker = std::make_shared<Worker>(m_context);
+
+    // parking is opt-in
+    EXPECT_EQ(ProgressEngineOptions().park_threshold().count(), 0);
+
+    ProgressEngineOptions options;
+    options.spin_count(4).max_backoff(std::chrono::microseconds(8)).park_threshold(std::chrono::microseconds(100));
+    options.park_timeout(std::chrono::milliseconds(1));
+
+    AdaptiveProgress progress(*worker, options);
+
+    // activity resets the idle state, so an engine receiving events never parks
+    for (int i = 0; i < 100; i++)
+    {
+        progress.wait(true);
+    }
+    EXPECT_EQ(progress.park_count(), 0);
+
+    // an idle engine spins, backs off and eventually parks
+    auto start = std::chrono::steady_clock::now();
+    while (progress.park_count() < 3)
+    {
+        worker->progress();
+        progress.wait(false);
+    }
+    EXPECT_GE(std::chrono::steady_clock::now() - start, options.park_threshold());
+
+    // waking a worker which is not parked is a no-op
+    worker->wake();
+}
+
 TEST_F(TestUCX, EndpointsInProcess)
 {
     // note this test really should use a progress engine
@@ -0,0 +1,145 @@
+/**
+ * SPDX-FileCopyrightText: Copyright (c) 2023, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "mrc/coroutines/event.hpp"
+#include "mrc/coroutines/sync_wait.hpp"
+#include "mrc/coroutines/task.hpp"
+#include "mrc/coroutines/thread_pool.hpp"
+#include "mrc/coroutines/when_all.hpp"
+
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+using namespace mrc;
+
+class TestCoroThreadPool : public ::testing::Test
+{};
+
+TEST_F(TestCoroThreadPool, ScheduleFromOutsideThePool)
+{
+    coroutines::ThreadPool tp{{.thread_count = 4}};
+    std::atomic<std::size_t> counter{0};
+
+    // enqueue captures the functor by reference, so it must outlive the tasks
+    auto increment = [&counter] {
+        counter++;
+    };
+
+    std::vector<coroutines::Task<void>> tasks;
+    for (std::size_t i = 0; i < 10'000; ++i)
+    {
+        tasks.emplace_back(tp.enqueue(increment));
+    }
+
+    coroutines::sync_wait(coroutines::when_all(std::move(tasks)));
+
+    EXPECT_EQ(counter, 10'000);
+    EXPECT_EQ(tp.queue_size(), 0);
+}
+
+TEST_F(TestCoroThreadPool, ScheduleFromWorkers)
+{
+    // tasks scheduled from an executor thread land in its local queue and must be stolen to run on the other threads;
+    // the local queues are also overfilled to exercise spilling into the shared queue
+    coroutines::ThreadPool tp{{.thread_count = 4}};
+    std::atomic<std::size_t> counter{0};
+
+    auto leaf = [&]() -> coroutines::Task<void> {
+        co_await tp.schedule();
+        counter++;
+        co_await tp.yield();
+        counter++;
+    };
+
+    auto spawner = [&]() -> coroutines::Task<void> {
+        co_await tp.schedule();
+        std::vector<coroutines::Task<void>> tasks;
+        for (std::size_t i = 0; i < 1'000; ++i)
+        {
+            tasks.emplace_back(leaf());
+        }
+        co_await coroutines::when_all(std::move(tasks));
+    };
+
+    std::vector<coroutines::Task<void>> spawners;
+    for (std::size_t i = 0; i < 8; ++i)
+    {
+        spawners.emplace_back(spawner());
+    }
+
+    coroutines::sync_wait(coroutines::when_all(std::move(spawners)));
+
+    EXPECT_EQ(counter, 16'000);
+}
+
+TEST_F(TestCoroThreadPool, ResumedContinuationRunsOnResumingThread)
+{
+    coroutines::ThreadPool tp{{.thread_count = 4}};
+    coroutines::Event event;
+
+    std::size_t setter_thread{0};
+    coroutines::ThreadPool* waiter_pool{nullptr};
+    std::size_t waiter_thread{0};
+
+    // suspends on the event from the calling thread; resumed by the pool when the event is set
+    auto waiter = [&]() -> coroutines::Task<void> {
+        co_await event;
+        waiter_pool   = coroutines::ThreadPool::from_current_thread();
+        waiter_thread = coroutines::ThreadPool::get_thread_id();
+    };
+
+    auto setter = [&]() -> coroutines::Task<void> {
+        co_await tp.schedule();
+        setter_thread = coroutines::ThreadPool::get_thread_id();
+        event.set(tp);
+    };
+
+    coroutines::sync_wait(coroutines::when_all(waiter(), setter()));
+
+    EXPECT_EQ(waiter_pool, &tp);
+    EXPECT_EQ(waiter_thread, setter_thread);
+}
+
+TEST_F(TestCoroThreadPool, ShutdownDrainsScheduledTasks)
+{
+    std::atomic<std::size_t> counter{0};
+
+    auto task = [&](coroutines::ThreadPool& tp) -> coroutines::Task<void> {
+        co_await tp.schedule();
+        counter++;
+    };
+
+    std::vector<coroutines::Task<void>> tasks;
+
+    {
+        coroutines::ThreadPool tp{{.thread_count = 2}};
+        for (std::size_t i = 0; i < 1'000; ++i)
+        {
+            tasks.emplace_back(task(tp));
+            tasks.back().resume();
+        }
+
+        tp.shutdown();
+        EXPECT_TRUE(tp.empty());
+    }
+
+    EXPECT_EQ(counter, 1'000);
+}
@@ -20,8 +20,10 @@
 #include "mrc/channel/buffered_channel.hpp"
 #include "mrc/channel/egress.hpp"
 #include "mrc/channel/ingress.hpp"
+#include "mrc/channel/mpmc_channel.hpp"
 #include "mrc/channel/null_channel.hpp"
 #include "mrc/channel/recent_channel.hpp"
+#include "mrc/channel/spsc_channel.hpp"
 #include "mrc/core/userspace_threads.hpp"
 #include "mrc/core/watcher.hpp"
 
@@ -30,12 +32,15 @@
 #include <boost/fiber/future/future.hpp>
 #include <boost/fiber/operations.hpp>  // for sleep_for
 
+#include <algorithm>
 #include <chrono>      // for duration, system_clock, milliseconds, time_point
 #include <cstddef>     // for size_t
 #include <cstdint>     // for uint64_t
 #include <functional>  // for ref, reference_wrapper
 #include <memory>
+#include <thread>
 #include <utility>
+#include <vector>
 // IWYU thinks algorithm is needed for: auto channel = std::make_shared<RecentChannel<int>>(2);
 // IWYU pragma: no_include <algorithm>
 
@@ -177,6 +182,38 @@ TEST_F(TestChannel, BufferedChannel)
     EXPECT_GE(t, 0.1);
 }
 
+TEST_F(TestChannel, WatcherFastPath)
+{
+    auto channel  = std::make_shared<BufferedChannel<int>>(4);
+    auto observer = std::make_shared<TestChannelObserver>();
+
+    EXPECT_FALSE(channel->has_watchers());
+
+    // without watchers, no events are delivered
+    channel->await_write(1);
+    EXPECT_EQ(observer->m_write_counter, 0);
+
+    channel->add_watcher(observer);
+    EXPECT_TRUE(channel->has_watchers());
+
+    channel->await_write(2);
+#ifdef MRC_TRACING_DISABLED
+    EXPECT_EQ(observer->m_write_counter, 0);
+#else
+    EXPECT_EQ(observer->m_write_counter, 1);
+#endif
+
+    channel->remove_watcher(observer);
+    EXPECT_FALSE(channel->has_watchers());
+
+    channel->await_write(3);
+#ifdef MRC_TRACING_DISABLED
+    EXPECT_EQ(observer->m_write_counter, 0);
+#else
+    EXPECT_EQ(observer->m_write_counter, 1);
+#endif
+}
+
 TEST_F(TestChannel, RecentChannel)
 {
     auto channel = std::make_shared<RecentChannel<int>>(2);
@@ -194,6 +231,22 @@ TEST_F(TestChannel, RecentChannel)
     egress.try_read(std::ref(i));
     EXPECT_EQ(i, -2);
 
+    // 42 was overwritten by -2
+    EXPECT_EQ(channel->dropped_count(), 1);
+
+    // an empty channel waits for the deadline
+    auto s = channel::clock_t::now();
+    EXPECT_EQ(egress.await_read_until(i, s + std::chrono::milliseconds(50)), channel::Status::timeout);
+    EXPECT_GE(channel::clock_t::now() - s, std::chrono::milliseconds(50));
+
+    // remaining values are drained after close
+    ingress.await_write(7);
+    channel->close_channel();
+    EXPECT_EQ(ingress.await_write(8), channel::Status::closed);
+    EXPECT_EQ(egress.await_read(i), channel::Status::success);
+    EXPECT_EQ(i, 7);
+    EXPECT_EQ(egress.await_read(i), channel::Status::closed);
+
     /*
     auto f = userspace_threads::async([&] {
         boost::this_fiber::sleep_for(std::chrono::milliseconds(100));
@@ -209,6 +262,251 @@ TEST_F(TestChannel, RecentChannel)
     */
 }
 
+TEST_F(TestChannel, RecentChannelThreads)
+{
+    constexpr int count = 100000;
+    auto channel        = std::make_shared<RecentChannel<int>>(8);
+
+    std::thread producer([channel] {
+        for (int i = 0; i < count; i++)
+        {
+            EXPECT_EQ(channel->await_write(i), channel::Status::success);
+        }
+        channel->close_channel();
+    });
+
+    // values arrive in order, the latest one is never dropped and every value is either read or dropped
+    int i;
+    int last         = -1;
+    std::size_t read = 0;
+    while (channel->await_read(i) == channel::Status::success)
+    {
+        EXPECT_GT(i, last);
+        last = i;
+        read++;
+    }
+
+    producer.join();
+    EXPECT_EQ(last, count - 1);
+    EXPECT_EQ(read + channel->dropped_count(), count);
+}
+
+TEST_F(TestChannel, SpscChannel)
+{
+    auto channel = std::make_shared<SpscChannel<int>>(3);
+
+    // capacity is rounded up to the next power of two
+    EXPECT_EQ(channel->capacity(), 4);
+
+    channel::Ingress<int>& ingress = *channel;
+    channel::Egress<int>& egress   = *channel;
+
+    int i;
+    EXPECT_EQ(egress.try_read(std::ref(i)), channel::Status::empty);
+    EXPECT_EQ(egress.await_read_until(i, channel::clock_t::now() + std::chrono::milliseconds(10)),
+              channel::Status::timeout);
+
+    for (int j = 0; j < 4; j++)
+    {
+        EXPECT_EQ(ingress.await_write(j), channel::Status::success);
+    }
+
+    channel->close_channel();
+    EXPECT_TRUE(channel->is_channel_closed());
+    EXPECT_EQ(ingress.await_write(42), channel::Status::closed);
+
+    // remaining elements can be drained after close
+    for (int j = 0; j < 4; j++)
+    {
+        EXPECT_EQ(egress.await_read(i), channel::Status::success);
+        EXPECT_EQ(i, j);
+    }
+
+    EXPECT_EQ(egress.await_read(i), channel::Status::closed);
+}
+
+TEST_F(TestChannel, SpscChannelThreads)
+{
+    constexpr int count = 100000;
+    auto channel        = std::make_shared<SpscChannel<int>>(16);
+
+    std::thread producer([channel] {
+        for (int i = 0; i < count; i++)
+        {
+            channel->await_write(i);
+        }
+        channel->close_channel();
+    });
+
+    int expected = 0;
+    int i;
+    while (channel->await_read(i) == channel::Status::success)
+    {
+        EXPECT_EQ(i, expected++);
+    }
+
+    producer.join();
+    EXPECT_EQ(expected, count);
+}
+
+TEST_F(TestChannel, MpmcChannelThreads)
+{
+    constexpr int producer_count = 4;
+    constexpr int consumer_count = 4;
+    constexpr int count          = 25000;
+
+    auto channel = std::make_shared<MpmcChannel<std::uint64_t>>(16);
+
+    std::vector<std::thread> producers;
+    std::vector<std::thread> consumers;
+    std::vector<std::uint64_t> sums(consumer_count, 0);
+
+    for (int p = 0; p < producer_count; p++)
+    {
+        producers.emplace_back([channel] {
+            for (std::uint64_t i = 1; i <= count; i++)
+            {
+                channel->await_write(std::uint64_t(i));
+            }
+        });
+    }
+
+    for (int c = 0; c < consumer_count; c++)
+    {
+        consumers.emplace_back([channel, &sums, c] {
+            std::uint64_t val;
+            while (channel->await_read(val) == channel::Status::success)
+            {
+                sums[c] += val;
+            }
+        });
+    }
+
+    for (auto& producer : producers)
+    {
+        producer.join();
+    }
+    channel->close_channel();
+    for (auto& consumer : consumers)
+    {
+        consumer.join();
+    }
+
+    std::uint64_t total = 0;
+    for (const auto& sum : sums)
+    {
+        total += sum;
+    }
+
+    EXPECT_EQ(total, producer_count * (std::uint64_t(count) * (count + 1) / 2));
+}
+
+TEST_F(TestChannel, BatchedReadWrite)
+{
+    auto check_channel = [](channel::Channel<int>& channel) {
+        std::vector<int> input{0, 1, 2, 3, 4, 5};
+        EXPECT_EQ(channel.await_write_batch(input), channel::Status::success);
+
+        std::vector<int> output(4);
+        std::size_t count = 0;
+
+        EXPECT_EQ(channel.await_read_up_to(output, count), channel::Status::success);
+        EXPECT_EQ(count, 4);
+        EXPECT_EQ(output, (std::vector<int>{0, 1, 2, 3}));
+
+        // only the buffered elements are returned
+        EXPECT_EQ(channel.await_read_up_to(output, count), channel::Status::success);
+        EXPECT_EQ(count, 2);
+        EXPECT_EQ(output[0], 4);
+        EXPECT_EQ(output[1], 5);
+
+        EXPECT_EQ(channel.await_read_up_to(output, count, channel::clock_t::now() + std::chrono::milliseconds(10)),
+                  channel::Status::timeout);
+        EXPECT_EQ(count, 0);
+
+        channel.close_channel();
+        EXPECT_EQ(channel.await_write_batch(input), channel::Status::closed);
+        EXPECT_EQ(channel.await_read_up_to(output, count), channel::Status::closed);
+        EXPECT_EQ(count, 0);
+    };
+
+    BufferedChannel<int> buffered(8);
+    check_channel(buffered);
+
+    SpscChannel<int> spsc(8);
+    check_channel(spsc);
+
+    MpmcChannel<int> mpmc(8);
+    check_channel(mpmc);
+}
+
+TEST_F(TestChannel, SpscChannelBatchedThreads)
+{
+    constexpr int count = 100000;
+    auto channel        = std::make_shared<SpscChannel<int>>(16);
+
+    std::thread producer([channel] {
+        std::vector<int> batch;
+        for (int i = 0; i < count; i += 7)
+        {
+            batch.clear();
+            for (int j = i; j < std::min(i + 7, count); j++)
+            {
+                batch.push_back(j);
+            }
+            EXPECT_EQ(channel->await_write_batch(batch), channel::Status::success);
+        }
+        channel->close_channel();
+    });
+
+    std::vector<int> batch(5);
+    std::size_t read = 0;
+    int expected     = 0;
+    while (channel->await_read_up_to(batch, read) == channel::Status::success)
+    {
+        for (std::size_t j = 0; j < read; j++)
+        {
+            EXPECT_EQ(batch[j], expected++);
+        }
+    }
+
+    producer.join();
+    EXPECT_EQ(expected, count);
+}
+
+TEST_F(TestChannel, Size)
+{
+    auto check_channel = [](channel::Channel<int>& channel) {
+        int i;
+        EXPECT_EQ(channel.size(), 0);
+
+        for (int j = 0; j < 3; j++)
+        {
+            EXPECT_EQ(channel.await_write(j), channel::Status::success);
+        }
+        EXPECT_EQ(channel.size(), 3);
+
+        EXPECT_EQ(channel.await_read(i), channel::Status::success);
+        EXPECT_EQ(channel.size(), 2);
+
+        // buffered elements are still counted once the channel is closed
+        channel.close_channel();
+        EXPECT_EQ(channel.size(), 2);
+    };
+
+    BufferedChannel<int> buffered(8);
+    check_channel(buffered);
+
+    SpscChannel<int> spsc(8);
+    check_channel(spsc);
+
+    MpmcChannel<int> mpmc(8);
+    check_channel(mpmc);
+
+    RecentChannel<int> recent(8);
+    check_channel(recent);
+}
+
 TEST_F(TestChannel, OnComplete) {}
 
 TEST_F(TestChannel, AwaitWriteOverloads)
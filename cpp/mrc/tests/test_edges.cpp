@@ -23,6 +23,7 @@
 #include "mrc/edge/edge_channel.hpp"
 #include "mrc/edge/edge_readable.hpp"
 #include "mrc/edge/edge_writable.hpp"
+#include "mrc/edge/shared_payload.hpp"
 #include "mrc/node/generic_source.hpp"
 #include "mrc/node/operators/broadcast.hpp"
 #include "mrc/node/operators/combine_latest.hpp"
@@ -37,6 +38,8 @@
 #include <gtest/gtest.h>
 #include <gtest/internal/gtest-internal.h>
 
+#include <cstddef>
+#include <cstdint>
 #include <functional>
 #include <map>
 #include <memory>
@@ -45,6 +48,7 @@
 #include <string>
 #include <tuple>
 #include <utility>
+#include <vector>
 
 // IWYU pragma: no_forward_declare mrc::channel::Channel
 
@@ -201,12 +205,21 @@ class TestSink : public WritableProvider<T>, public ReadableAcceptor<T>, public
         while (input->await_read(t) == channel::Status::success)
         {
             VLOG(10) << "Sink got value";
+            m_values.push_back(t);
         }
 
         VLOG(10) << "Sink exited run";
 
         this->release_edge_connection();
     }
+
+    const std::vector<T>& values() const
+    {
+        return m_values;
+    }
+
+  private:
+    std::vector<T> m_values;
 };
 
 template <typename T>
@@ -317,6 +330,22 @@ class TestRouter : public Router<std::string, int>
     }
 };
 
+enum class TestRouteKey
+{
+    Even = 0,
+    Odd  = 1,
+};
+
+template <typename T>
+class TestFlatRouter : public FlatRouter<TestRouteKey, int>
+{
+  protected:
+    TestRouteKey determine_key_for_value(const int& t) override
+    {
+        return t % 2 == 1 ? TestRouteKey::Odd : TestRouteKey::Even;
+    }
+};
+
 template <typename T>
 class TestConditional : public ForwardingWritableProvider<T>, public WritableAcceptor<T>
 {
@@ -624,6 +653,83 @@ TEST_F(TestEdges, SourceToRouterToDifferentSinks)
     sink1->run();
 }
 
+TEST_F(TestEdges, SourceToFlatRouterToSinks)
+{
+    auto source = std::make_shared<node::TestSource<int>>();
+    auto router = std::make_shared<node::TestFlatRouter<int>>();
+    auto sink1  = std::make_shared<node::TestSink<int>>();
+    auto sink2  = std::make_shared<node::TestSink<int>>();
+
+    mrc::make_edge(*source, *router);
+    mrc::make_edge(*router->get_source(node::TestRouteKey::Odd), *sink1);
+    mrc::make_edge(*router->get_source(node::TestRouteKey::Even), *sink2);
+
+    source->run();
+    sink1->run();
+    sink2->run();
+
+    EXPECT_EQ(sink1->values(), (std::vector<int>{1}));
+    EXPECT_EQ(sink2->values(), (std::vector<int>{0, 2}));
+}
+
+TEST_F(TestEdges, FlatRouterDropEdge)
+{
+    auto router = std::make_shared<node::TestFlatRouter<int>>();
+    auto sink1  = std::make_shared<node::TestSink<int>>();
+    auto sink2  = std::make_shared<node::TestSink<int>>();
+
+    mrc::make_edge(*router->get_source(node::TestRouteKey::Odd), *sink1);
+    mrc::make_edge(*router->get_source(node::TestRouteKey::Even), *sink2);
+
+    router->freeze();
+
+    // the frozen table must not keep the dropped edge alive, otherwise the sink never sees its channel close
+    router->drop_edge(node::TestRouteKey::Odd);
+    sink1->run();
+    EXPECT_TRUE(sink1->values().empty());
+
+    router->drop_edge(node::TestRouteKey::Even);
+    sink2->run();
+    EXPECT_TRUE(sink2->values().empty());
+}
+
+TEST_F(TestEdges, FlatEdgeTable)
+{
+    auto make_writer = [] {
+        return edge::EdgeChannel<int>(std::make_unique<channel::BufferedChannel<int>>()).get_writer();
+    };
+
+    std::vector<std::shared_ptr<edge::IEdgeWritable<int>>> writers{make_writer(), make_writer(), make_writer()};
+
+    // dense keys, including negative ones, are indexed directly
+    node::detail::FlatEdgeTable<int, int> dense;
+    dense.build({{-1, writers[0]}, {2, writers[1]}, {5, writers[2]}});
+
+    EXPECT_TRUE(dense.is_direct());
+    EXPECT_EQ(dense.find(-1), writers[0].get());
+    EXPECT_EQ(dense.find(2), writers[1].get());
+    EXPECT_EQ(dense.find(5), writers[2].get());
+    EXPECT_EQ(dense.find(0), nullptr);
+    EXPECT_EQ(dense.find(-2), nullptr);
+    EXPECT_EQ(dense.find(6), nullptr);
+
+    // sparse keys fall back to the sorted array
+    node::detail::FlatEdgeTable<std::uint64_t, int> sparse;
+    sparse.build({{7, writers[0]}, {1UL << 40, writers[1]}, {1UL << 62, writers[2]}});
+
+    EXPECT_FALSE(sparse.is_direct());
+    EXPECT_EQ(sparse.find(7), writers[0].get());
+    EXPECT_EQ(sparse.find(1UL << 40), writers[1].get());
+    EXPECT_EQ(sparse.find(1UL << 62), writers[2].get());
+    EXPECT_EQ(sparse.find(8), nullptr);
+
+    node::detail::FlatEdgeTable<std::string, int> strings;
+    strings.build({{"even", writers[0]}, {"odd", writers[1]}});
+
+    EXPECT_EQ(strings.find("odd"), writers[1].get());
+    EXPECT_EQ(strings.find("none"), nullptr);
+}
+
 TEST_F(TestEdges, SourceToBroadcastToSink)
 {
     auto source    = std::make_shared<node::TestSource<int>>();
@@ -756,6 +862,31 @@ TEST_F(TestEdges, SourceToBroadcastToSinkComponents)
     source->run();
 }
 
+TEST_F(TestEdges, SourceToSharedBroadcastToMultiSink)
+{
+    CopyMoveCounter::reset();
+
+    auto source    = std::make_shared<node::TestSource<CopyMoveCounter>>();
+    auto broadcast = std::make_shared<node::SharedBroadcast<CopyMoveCounter>>();
+    auto sink1     = std::make_shared<node::TestSink<edge::SharedPayload<CopyMoveCounter>>>();
+    auto sink2     = std::make_shared<node::TestSink<std::shared_ptr<const CopyMoveCounter>>>();
+    auto sink3     = std::make_shared<node::TestSink<CopyMoveCounter>>();
+
+    mrc::make_edge(*source, *broadcast);
+    mrc::make_edge(*broadcast, *sink1);
+    mrc::make_edge(*broadcast, *sink2);
+    mrc::make_edge(*broadcast, *sink3);
+
+    source->run();
+
+    // read-only sinks share each value, only the sink which needs a mutable value copies it
+    EXPECT_EQ(CopyMoveCounter::global_copy_count(), 3);
+
+    sink1->run();
+    sink2->run();
+    sink3->run();
+}
+
 TEST_F(TestEdges, SourceComponentDoubleToSinkFloat)
 {
     auto source = std::make_shared<node::TestSourceComponent<double>>();
@@ -803,6 +934,33 @@ TEST_F(TestEdges, SourceToNodeToNull)
     node->run();
 }
 
+TEST_F(TestEdges, ReadUpToDeadlineWithoutDeadlineSupport)
+{
+    int next = 0;
+    node::EdgeReadableLambda<int> edge([&next](int& t) {
+        if (next == 2)
+        {
+            return channel::Status::closed;
+        }
+        t = next++;
+        return channel::Status::success;
+    });
+
+    // an edge which cannot wait with a deadline reads a single value instead of timing out
+    std::vector<int> items(4);
+    std::size_t count = 0;
+    EXPECT_EQ(edge.await_read_up_to(items, count, channel::clock_t::now()), channel::Status::success);
+    EXPECT_EQ(count, 1);
+    EXPECT_EQ(items[0], 0);
+
+    EXPECT_EQ(edge.await_read_up_to(items, count, channel::clock_t::now()), channel::Status::success);
+    EXPECT_EQ(count, 1);
+    EXPECT_EQ(items[0], 1);
+
+    EXPECT_EQ(edge.await_read_up_to(items, count, channel::clock_t::now()), channel::Status::closed);
+    EXPECT_EQ(count, 0);
+}
+
 TEST_F(TestEdges, CreateAndDestroy)
 {
     {
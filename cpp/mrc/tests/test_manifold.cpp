@@ -0,0 +1,152 @@
+/**
+ * SPDX-FileCopyrightText: Copyright (c) 2023, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "test_mrc.hpp"  // IWYU pragma: associated
+
+#include "mrc/channel/status.hpp"
+#include "mrc/manifold/egress.hpp"
+#include "mrc/manifold/load_balancing_policy.hpp"
+#include "mrc/node/readable_endpoint.hpp"
+#include "mrc/types.hpp"
+
+#include <chrono>
+#include <cstddef>
+#include <thread>
+#include <vector>
+
+namespace mrc {
+
+class TestManifold : public ::testing::Test
+{};
+
+TEST_F(TestManifold, RoundRobinPolicy)
+{
+    auto policy = manifold::make_load_balancing_policy(manifold::LoadBalancingPolicyType::RoundRobin);
+
+    std::vector<std::size_t> depths{5, 0, 9};
+    auto queue_depth = [&](std::size_t i) {
+        return depths[i];
+    };
+
+    // occupancy is ignored
+    for (std::size_t i = 0; i < 6; ++i)
+    {
+        EXPECT_EQ(policy->select(depths.size(), queue_depth), i % depths.size());
+    }
+}
+
+TEST_F(TestManifold, LeastQueueDepthPolicy)
+{
+    auto policy = manifold::make_load_balancing_policy(manifold::LoadBalancingPolicyType::LeastQueueDepth);
+
+    std::vector<std::size_t> depths{4, 2, 7, 2};
+    auto queue_depth = [&](std::size_t i) {
+        return depths[i];
+    };
+
+    // ties on the shallowest output are broken round-robin
+    EXPECT_EQ(policy->select(depths.size(), queue_depth), 1);
+    EXPECT_EQ(policy->select(depths.size(), queue_depth), 3);
+    EXPECT_EQ(policy->select(depths.size(), queue_depth), 1);
+
+    depths = {0, 0, 0, 0};
+    std::vector<std::size_t> counts(depths.size(), 0);
+    for (std::size_t i = 0; i < 8; ++i)
+    {
+        counts[policy->select(depths.size(), queue_depth)]++;
+    }
+    EXPECT_EQ(counts, (std::vector<std::size_t>{2, 2, 2, 2}));
+
+    // the number of outputs may shrink between calls
+    depths = {3, 1};
+    EXPECT_EQ(policy->select(depths.size(), queue_depth), 1);
+}
+
+TEST_F(TestManifold, PowerOfTwoChoicesPolicy)
+{
+    auto policy = manifold::make_load_balancing_policy(manifold::LoadBalancingPolicyType::PowerOfTwoChoices);
+
+    // the deepest output always loses its comparison
+    std::vector<std::size_t> depths{1, 1, 100, 1};
+    auto queue_depth = [&](std::size_t i) {
+        return depths[i];
+    };
+
+    std::vector<std::size_t> counts(depths.size(), 0);
+    for (std::size_t i = 0; i < 1000; ++i)
+    {
+        counts[policy->select(depths.size(), queue_depth)]++;
+    }
+
+    EXPECT_EQ(counts[2], 0);
+    EXPECT_GT(counts[0], 0);
+    EXPECT_GT(counts[1], 0);
+    EXPECT_GT(counts[3], 0);
+
+    depths = {42};
+    EXPECT_EQ(policy->select(depths.size(), queue_depth), 0);
+}
+
+TEST_F(TestManifold, BalancedEgressPrefersFastOutput)
+{
+    const std::size_t count = 1000;
+
+    manifold::BalancedEgress<int> egress;
+    egress.set_policy(manifold::make_load_balancing_policy(manifold::LoadBalancingPolicyType::LeastQueueDepth));
+
+    node::ReadableEndpoint<int> slow;
+    node::ReadableEndpoint<int> fast;
+
+    egress.add_output(SegmentAddress{0}, &slow);
+    egress.add_output(SegmentAddress{1}, &fast);
+
+    std::size_t slow_count = 0;
+    std::size_t fast_count = 0;
+
+    std::thread slow_reader([&] {
+        int value;
+        while (slow.await_read(value) == channel::Status::success)
+        {
+            ++slow_count;
+            std::this_thread::sleep_for(std::chrono::milliseconds(1));
+        }
+    });
+
+    std::thread fast_reader([&] {
+        int value;
+        while (fast.await_read(value) == channel::Status::success)
+        {
+            ++fast_count;
+        }
+    });
+
+    for (std::size_t i = 0; i < count; ++i)
+    {
+        EXPECT_EQ(egress.await_write(static_cast<int>(i)), channel::Status::success);
+    }
+
+    // closes both downstream channels so the readers drain and exit
+    egress.release_outputs();
+
+    slow_reader.join();
+    fast_reader.join();
+
+    EXPECT_EQ(slow_count + fast_count, count);
+    EXPECT_GT(fast_count, 2 * slow_count);
+}
+
+}  // namespace mrc
@@ -17,13 +17,32 @@
 
 #include "./test_mrc.hpp"  // IWYU pragma: associated
 
+#include "mrc/core/watcher.hpp"
 #include "mrc/metrics/counter.hpp"
+#include "mrc/metrics/exporter.hpp"
+#include "mrc/metrics/gauge.hpp"
+#include "mrc/metrics/histogram.hpp"
+#include "mrc/metrics/node_metrics.hpp"
 #include "mrc/metrics/registry.hpp"
 
+#include <arpa/inet.h>
+#include <boost/fiber/fiber.hpp>
+#include <boost/fiber/operations.hpp>
 #include <gtest/gtest.h>  // for AssertionResult, SuiteApiResolver, TestInfo, EXPECT_TRUE, Message, TEST_F, Test, TestFactoryImpl, TestPartResult
+#include <netinet/in.h>
+#include <sys/socket.h>
+#include <unistd.h>
 
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <filesystem>
+#include <fstream>
+#include <iterator>
 #include <memory>
+#include <sstream>
 #include <string>  // for allocator, operator==, basic_string, string
+#include <thread>
 #include <vector>
 
 namespace mrc {
@@ -55,4 +74,228 @@ TEST_F(TestMetrics, ThroughputCounter)
     EXPECT_EQ(report[0].count, 43);
 }
 
+TEST_F(TestMetrics, ShardedCounterAndGauge)
+{
+    auto counter = m_registry->make_throughput_counter("test_counter");
+    auto gauge   = m_registry->make_gauge("test_gauge", {});
+
+    constexpr std::size_t thread_count = 8;
+    constexpr std::size_t iterations   = 100000;
+
+    std::vector<std::thread> threads;
+    for (std::size_t t = 0; t < thread_count; ++t)
+    {
+        threads.emplace_back([counter, gauge, t]() mutable {
+            for (std::size_t i = 0; i < iterations; ++i)
+            {
+                counter.increment();
+                gauge.increment();
+                if (t % 2 == 0)
+                {
+                    gauge.decrement();
+                }
+            }
+        });
+    }
+    for (auto& thread : threads)
+    {
+        thread.join();
+    }
+
+    EXPECT_EQ(counter.value(), thread_count * iterations);
+    EXPECT_EQ(gauge.value(), thread_count / 2 * iterations);
+
+    // handles to the same name and labels share the value
+    EXPECT_EQ(m_registry->make_throughput_counter("test_counter").value(), thread_count * iterations);
+
+    gauge.set(-3);
+    EXPECT_EQ(gauge.value(), -3);
+
+    EXPECT_ANY_THROW(m_registry->make_gauge("mrc_throughput_counters", {{"name", "test_counter"}}));
+}
+
+TEST_F(TestMetrics, HistogramBuckets)
+{
+    for (std::uint64_t value : {0UL, 1UL, 7UL, 8UL, 9UL, 15UL, 16UL, 17UL, 1000UL, 123456789UL, ~0UL})
+    {
+        auto index = HistogramBuckets::index(value);
+        ASSERT_LT(index, HistogramBuckets::BucketCount);
+        EXPECT_LE(HistogramBuckets::lower_bound(index), value);
+        EXPECT_GE(HistogramBuckets::upper_bound(index), value);
+
+        // relative width of a bucket is bounded by the sub-bucket resolution
+        auto width = HistogramBuckets::upper_bound(index) - HistogramBuckets::lower_bound(index);
+        EXPECT_LE(width, HistogramBuckets::lower_bound(index) / HistogramBuckets::SubBucketCount);
+    }
+
+    // buckets tile the value range
+    for (std::size_t i = 1; i < HistogramBuckets::BucketCount; ++i)
+    {
+        EXPECT_EQ(HistogramBuckets::lower_bound(i), HistogramBuckets::upper_bound(i - 1) + 1);
+    }
+
+    auto histogram = m_registry->make_histogram("test_latency", {});
+    for (std::uint64_t value = 1; value <= 1000; ++value)
+    {
+        histogram.record(value);
+    }
+
+    auto snapshot = histogram.snapshot();
+    EXPECT_EQ(snapshot.count, 1000);
+    EXPECT_EQ(snapshot.sum, 500500);
+    EXPECT_EQ(snapshot.count_below(512), 511);
+
+    auto median = snapshot.quantile(0.5);
+    EXPECT_GE(median, 500);
+    EXPECT_LE(median, 500 + 500 / HistogramBuckets::SubBucketCount);
+    EXPECT_GE(snapshot.quantile(1.0), 1000);
+}
+
+TEST_F(TestMetrics, PrometheusText)
+{
+    m_registry->make_counter("test_requests_total", {{"path", "a\"b"}}).increment(3);
+    m_registry->make_callback_gauge("test_depth", {{"queue", "q"}}, [] {
+        return 2.5;
+    });
+    m_registry->set_help("test_depth", "depth of a queue");
+
+    auto histogram = m_registry->make_histogram("test_seconds", {}, 1e-9);
+    histogram.record(3);
+    histogram.record(1UL << 20);
+
+    auto text = m_registry->serialize();
+
+    EXPECT_NE(text.find("# TYPE test_requests_total counter\ntest_requests_total{path=\"a\\\"b\"} 3\n"),
+              std::string::npos);
+    EXPECT_NE(text.find("# HELP test_depth depth of a queue\n# TYPE test_depth gauge\ntest_depth{queue=\"q\"} 2.5\n"),
+              std::string::npos);
+    EXPECT_NE(text.find("# TYPE test_seconds histogram\n"), std::string::npos);
+    EXPECT_NE(text.find("test_seconds_bucket{le=\"4e-09\"} 1\n"), std::string::npos);
+    EXPECT_NE(text.find("test_seconds_bucket{le=\"+Inf\"} 2\n"), std::string::npos);
+    EXPECT_NE(text.find("test_seconds_count 2\n"), std::string::npos);
+
+    // families without metrics are not exported
+    EXPECT_EQ(text.find("mrc_throughput_counters"), std::string::npos);
+}
+
+TEST_F(TestMetrics, NodeMetrics)
+{
+    NodeMetrics node_metrics(*m_registry, {{"node", "test_node"}});
+
+    std::size_t depth = 7;
+    node_metrics.set_queue_depth_fn([&depth] {
+        return depth;
+    });
+
+    auto sink   = node_metrics.sink_watcher();
+    auto source = node_metrics.source_watcher();
+
+    // a progress engine reading a batch of three values, emitting two of them
+    sink->on_entry(WatchableEvent::channel_read, nullptr);
+    sink->on_exit(WatchableEvent::channel_read, true, nullptr);
+    for (int i = 0; i < 3; ++i)
+    {
+        sink->on_entry(WatchableEvent::sink_on_data, nullptr);
+        EXPECT_EQ(m_registry->make_gauge("mrc_node_in_flight", {{"node", "test_node"}}).value(), 1);
+        if (i != 1)
+        {
+            source->on_exit(WatchableEvent::sink_on_data, true, nullptr);
+        }
+    }
+    sink->on_entry(WatchableEvent::channel_read, nullptr);
+
+    Registry::labels_t labels{{"node", "test_node"}};
+    EXPECT_EQ(m_registry->make_counter("mrc_node_received_total", labels).value(), 3);
+    EXPECT_EQ(m_registry->make_counter("mrc_node_emitted_total", labels).value(), 2);
+    EXPECT_EQ(m_registry->make_gauge("mrc_node_in_flight", labels).value(), 0);
+    EXPECT_EQ(m_registry->make_histogram("mrc_node_processing_seconds", labels, 1e-9).snapshot().count, 3);
+
+    // values pushed inline by a fused upstream are counted but not timed
+    sink->on_entry(WatchableEvent::sink_on_data, nullptr);
+    EXPECT_EQ(m_registry->make_counter("mrc_node_received_total", labels).value(), 4);
+    EXPECT_EQ(m_registry->make_gauge("mrc_node_in_flight", labels).value(), 0);
+
+    auto text = m_registry->serialize();
+    EXPECT_NE(text.find("mrc_node_queue_depth{node=\"test_node\"} 7\n"), std::string::npos);
+    depth = 0;
+    EXPECT_NE(m_registry->serialize().find("mrc_node_queue_depth{node=\"test_node\"} 0\n"), std::string::npos);
+}
+
+TEST_F(TestMetrics, NodeMetricsEnginesSharingAThread)
+{
+    NodeMetrics node_metrics(*m_registry, {{"node", "shared_thread"}});
+    Registry::labels_t labels{{"node", "shared_thread"}};
+
+    auto sink = node_metrics.sink_watcher();
+
+    // two progress engines of the same node interleave on this thread, each reading and processing one value
+    auto engine = [&] {
+        sink->on_entry(WatchableEvent::channel_read, nullptr);
+        sink->on_exit(WatchableEvent::channel_read, true, nullptr);
+        boost::this_fiber::yield();
+        sink->on_entry(WatchableEvent::sink_on_data, nullptr);
+        boost::this_fiber::yield();
+        sink->on_entry(WatchableEvent::channel_read, nullptr);
+    };
+
+    boost::fibers::fiber first(engine);
+    boost::fibers::fiber second(engine);
+
+    while (m_registry->make_counter("mrc_node_received_total", labels).value() < 2)
+    {
+        boost::this_fiber::yield();
+    }
+    EXPECT_EQ(m_registry->make_gauge("mrc_node_in_flight", labels).value(), 2);
+
+    first.join();
+    second.join();
+
+    EXPECT_EQ(m_registry->make_gauge("mrc_node_in_flight", labels).value(), 0);
+    EXPECT_EQ(m_registry->make_histogram("mrc_node_processing_seconds", labels, 1e-9).snapshot().count, 2);
+}
+
+TEST_F(TestMetrics, Exporter)
+{
+    m_registry->make_throughput_counter("exported").increment(5);
+
+    auto path = std::filesystem::temp_directory_path() / ("mrc_test_metrics_" + std::to_string(::getpid()) + ".prom");
+
+    Exporter exporter(*m_registry);
+    exporter.write(path.string());
+    {
+        std::ifstream file(path);
+        std::string contents((std::istreambuf_iterator<char>(file)), std::istreambuf_iterator<char>());
+        EXPECT_EQ(contents, m_registry->serialize());
+    }
+    std::filesystem::remove(path);
+
+    auto port = exporter.serve("127.0.0.1", 0);
+    ASSERT_NE(port, 0);
+
+    int fd = ::socket(AF_INET, SOCK_STREAM, 0);
+    ASSERT_GE(fd, 0);
+
+    sockaddr_in addr{};
+    addr.sin_family = AF_INET;
+    addr.sin_port   = htons(port);
+    ::inet_pton(AF_INET, "127.0.0.1", &addr.sin_addr);
+    ASSERT_EQ(::connect(fd, reinterpret_cast<sockaddr*>(&addr), sizeof(addr)), 0);
+
+    std::string request = "GET /metrics HTTP/1.1\r\nHost: localhost\r\n\r\n";
+    ASSERT_EQ(::send(fd, request.data(), request.size(), 0), request.size());
+
+    std::string response;
+    std::array<char, 1024> buffer{};
+    for (auto rc = ::recv(fd, buffer.data(), buffer.size(), 0); rc > 0; rc = ::recv(fd, buffer.data(), buffer.size(), 0))
+    {
+        response.append(buffer.data(), rc);
+    }
+    ::close(fd);
+
+    EXPECT_EQ(response.rfind("HTTP/1.1 200 OK\r\n", 0), 0);
+    EXPECT_NE(response.find("mrc_throughput_counters{name=\"exported\"} 5\n"), std::string::npos);
+
+    exporter.stop();
+}
+
 }  // namespace mrc
@@ -17,8 +17,10 @@
 
 #include "test_mrc.hpp"  // IWYU pragma: associated
 
+#include "mrc/channel/types.hpp"
 #include "mrc/core/executor.hpp"
 #include "mrc/engine/pipeline/ipipeline.hpp"
+#include "mrc/node/read_batch.hpp"
 #include "mrc/node/rx_node.hpp"
 #include "mrc/node/rx_sink.hpp"
 #include "mrc/node/rx_source.hpp"
@@ -31,6 +33,7 @@
 #include "mrc/segment/builder.hpp"
 #include "mrc/utils/string_utils.hpp"
 
+#include <boost/fiber/operations.hpp>
 #include <glog/logging.h>
 #include <gtest/gtest.h>
 #include <rxcpp/rx.hpp>
@@ -45,9 +48,7 @@
 #include <string>
 #include <thread>
 #include <utility>
-
-// IWYU thinks we need vector for make_segment
-// IWYU pragma: no_include <vector>
+#include <vector>
 
 using namespace std::chrono_literals;
 
@@ -482,6 +483,186 @@ TEST_F(TestNode, NodePrologueEpilogue)
     EXPECT_EQ(epilogue_tap_sum, 20);
 }
 
+TEST_F(TestNode, FusedOperatorChain)
+{
+    auto p = pipeline::make_pipeline();
+
+    std::atomic<int> sink_sum         = 0;
+    std::atomic<int> complete_count   = 0;
+    std::atomic<int> epilogue_tap_sum = 0;
+
+    std::mutex mut;
+    std::set<std::string> contexts;
+
+    auto record_context = [&]() {
+        std::lock_guard<std::mutex> lock(mut);
+        contexts.insert(runnable::Context::get_runtime_context().info());
+    };
+
+    auto my_segment = p->make_segment("my_segment", [&](segment::Builder& seg) {
+        auto source = seg.make_source<int>("src1", [&](rxcpp::subscriber<int>& s) {
+            record_context();
+            s.on_next(1);
+            s.on_next(2);
+            s.on_next(3);
+            s.on_next(4);
+            s.on_completed();
+        });
+
+        auto doubler = seg.make_node<int>("doubler", rxcpp::operators::map([&](const int& x) {
+                                              record_context();
+                                              return x * 2;
+                                          }));
+
+        auto incrementer = seg.make_node<int>("incrementer", rxcpp::operators::map([&](const int& x) {
+                                                  record_context();
+                                                  return x + 1;
+                                              }));
+
+        // taps still apply per stage
+        incrementer->object().add_epilogue_tap([&epilogue_tap_sum](const int& x) {
+            epilogue_tap_sum += x;
+        });
+
+        seg.make_edge(source, doubler);
+        seg.make_edge(doubler, incrementer);
+
+        auto sink = seg.make_sink<int>(
+            "sinkRef",
+            [&](const int& x) {
+                sink_sum += x;
+            },
+            [&]() {
+                ++complete_count;
+            });
+
+        seg.make_edge(incrementer, sink);
+    });
+
+    auto options = std::make_unique<Options>();
+    options->topology().user_cpuset("0");
+    options->engine_factories().set_fuse_operator_chains(true);
+
+    Executor exec(std::move(options));
+
+    exec.register_pipeline(std::move(p));
+
+    exec.start();
+
+    exec.join();
+
+    EXPECT_EQ(sink_sum, 24);
+    EXPECT_EQ(complete_count, 1);
+    EXPECT_EQ(epilogue_tap_sum, 24);
+
+    // both nodes ran inline in the source's runnable
+    EXPECT_EQ(contexts.size(), 1);
+}
+
+TEST_F(TestNode, ReadBatch)
+{
+    EXPECT_EQ(node::ReadBatch::current(), nullptr);
+
+    std::vector<int> order;
+    {
+        node::ReadBatch read_batch;
+        EXPECT_EQ(node::ReadBatch::current(), &read_batch);
+
+        read_batch.defer([&order]() {
+            order.push_back(1);
+
+            // registered while flushing; runs in the same flush
+            node::ReadBatch::current()->defer([&order]() {
+                order.push_back(3);
+            });
+        });
+        read_batch.defer([&order]() {
+            order.push_back(2);
+        });
+
+        read_batch.flush();
+    }
+
+    EXPECT_EQ(node::ReadBatch::current(), nullptr);
+    EXPECT_EQ(order, (std::vector<int>{1, 2, 3}));
+}
+
+TEST_F(TestNode, ReadDeadlines)
+{
+    EXPECT_EQ(node::ReadDeadlines::current(), nullptr);
+
+    std::vector<int> order;
+    {
+        node::ReadDeadlines deadlines;
+        EXPECT_EQ(node::ReadDeadlines::current(), &deadlines);
+
+        const auto now = channel::clock_t::now();
+        deadlines.schedule(now + 1h, [&order]() {
+            order.push_back(3);
+        });
+        deadlines.schedule(now, [&order, &deadlines, now]() {
+            order.push_back(1);
+
+            // scheduled while running; already expired, so it runs in the same call
+            deadlines.schedule(now, [&order]() {
+                order.push_back(2);
+            });
+        });
+
+        EXPECT_EQ(deadlines.next(), now);
+        deadlines.run_expired();
+        EXPECT_EQ(deadlines.next(), now + 1h);
+    }
+
+    EXPECT_EQ(node::ReadDeadlines::current(), nullptr);
+    EXPECT_EQ(order, (std::vector<int>{1, 2}));
+}
+
+TEST_F(TestNode, ReadDeadlinesRunWhileIdle)
+{
+    auto p = pipeline::make_pipeline();
+
+    std::atomic<bool> fired       = false;
+    std::atomic<bool> had_context = false;
+
+    auto my_segment = p->make_segment("my_segment", [&](segment::Builder& seg) {
+        auto source = seg.make_source<int>("src1", [&](rxcpp::subscriber<int>& s) {
+            s.on_next(1);
+
+            // the input of the sink stays idle until its deadline has fired
+            while (!fired)
+            {
+                boost::this_fiber::sleep_for(1ms);
+            }
+            s.on_completed();
+        });
+
+        auto sink = seg.make_sink<int>("sinkRef", [&](const int& x) {
+            auto* deadlines = node::ReadDeadlines::current();
+            ASSERT_NE(deadlines, nullptr);
+            deadlines->schedule(channel::clock_t::now() + 10ms, [&]() {
+                had_context = runnable::Context::has_runtime_context();
+                fired       = true;
+            });
+        });
+
+        seg.make_edge(source, sink);
+    });
+
+    auto options = std::make_unique<Options>();
+    options->topology().user_cpuset("0");
+
+    Executor exec(std::move(options));
+    exec.register_pipeline(std::move(p));
+    exec.start();
+    exec.join();
+
+    EXPECT_TRUE(fired);
+
+    // the callback ran on the progress engine of the sink
+    EXPECT_TRUE(had_context);
+}
+
 // the parallel tests:
 // - SourceMultiThread
 // - SinkMultiThread
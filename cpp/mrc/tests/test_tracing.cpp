@@ -0,0 +1,188 @@
+/**
+ * SPDX-FileCopyrightText: Copyright (c) 2022-2023, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "test_mrc.hpp"  // IWYU pragma: associated
+
+#include "mrc/tracing/event_trace.hpp"
+
+#include <atomic>
+#include <cstddef>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace mrc {
+
+class TestTracing : public ::testing::Test
+{
+  protected:
+    void SetUp() override
+    {
+        tracing::clear();
+        tracing::set_enabled(true);
+    }
+
+    void TearDown() override
+    {
+        tracing::set_enabled(false);
+        tracing::clear();
+    }
+
+    static std::size_t count(const std::string& text, const std::string& pattern)
+    {
+        std::size_t found = 0;
+        for (auto pos = text.find(pattern); pos != std::string::npos; pos = text.find(pattern, pos + 1))
+        {
+            ++found;
+        }
+        return found;
+    }
+};
+
+TEST_F(TestTracing, NodeAndChannelSpans)
+{
+    auto first  = tracing::intern("seg/first");
+    auto second = tracing::intern("seg/second");
+
+    std::thread engine([&] {
+        // the progress engines of two nodes whose fibers interleave on one thread; each carries its own span starts
+        tracing::register_thread();
+        auto first_read = tracing::begin_span(first);
+        tracing::record_fiber_switch(42);
+        auto second_read = tracing::begin_span(second);
+        tracing::end_span(tracing::EventType::channel_read, first, first_read);
+        auto first_node = tracing::begin_span(first);
+        auto write      = tracing::begin_span(first);
+        tracing::end_span(tracing::EventType::channel_write, first, write);
+        tracing::end_span(tracing::EventType::node, first, first_node);
+        tracing::end_span(tracing::EventType::channel_read, second, second_read);
+        auto second_node = tracing::begin_span(second);
+        tracing::end_span(tracing::EventType::node, second, second_node);
+
+        // unnamed objects are not traced
+        tracing::end_span(tracing::EventType::node, 0, tracing::begin_span(0));
+    });
+    engine.join();
+
+    std::ostringstream os;
+    EXPECT_EQ(tracing::dump_chrome_trace(os), 6);
+
+    auto trace = os.str();
+    EXPECT_EQ(trace.rfind(R"({"displayTimeUnit":"ns","traceEvents":[)", 0), 0);
+    EXPECT_EQ(count(trace, R"("name":"seg/first","cat":"node","ph":"X")"), 1);
+    EXPECT_EQ(count(trace, R"("name":"seg/second","cat":"node","ph":"X")"), 1);
+    EXPECT_EQ(count(trace, R"("name":"seg/first","cat":"channel_read","ph":"X")"), 1);
+    EXPECT_EQ(count(trace, R"("name":"seg/second","cat":"channel_read","ph":"X")"), 1);
+    EXPECT_EQ(count(trace, R"("cat":"channel_write","ph":"X")"), 1);
+    EXPECT_EQ(count(trace, R"("dur":)"), 5);
+    EXPECT_EQ(count(trace, R"("ph":"B")"), 0);
+    EXPECT_EQ(count(trace, R"("name":"fiber_switch","cat":"fiber_switch","ph":"i","s":"t")"), 1);
+    EXPECT_EQ(count(trace, R"("args":{"id":42})"), 1);
+    EXPECT_GE(count(trace, R"("name":"thread_name")"), 1);
+
+    tracing::clear();
+    std::ostringstream cleared;
+    EXPECT_EQ(tracing::dump_chrome_trace(cleared), 0);
+}
+
+TEST_F(TestTracing, FiberSwitchOnUnregisteredThread)
+{
+    // schedulers must not allocate in pick_next, so a switch on a thread without a buffer is dropped
+    std::thread thread([] {
+        tracing::record_fiber_switch(42);
+    });
+    thread.join();
+
+    std::ostringstream os;
+    EXPECT_EQ(tracing::dump_chrome_trace(os), 0);
+}
+
+TEST_F(TestTracing, Disabled)
+{
+    tracing::set_enabled(false);
+
+    auto name_id = tracing::intern("disabled");
+    std::thread([name_id] {
+        for (int i = 0; i < 100; ++i)
+        {
+            tracing::record(tracing::EventType::node, tracing::Phase::instant, name_id);
+        }
+    }).join();
+
+    std::ostringstream os;
+    EXPECT_EQ(tracing::dump_chrome_trace(os), 0);
+}
+
+TEST_F(TestTracing, RingOverwritesOldestEvents)
+{
+    tracing::set_buffer_capacity(20);
+
+    auto name_id = tracing::intern("ring");
+    std::thread([name_id] {
+        for (std::uint64_t i = 1; i <= 1000; ++i)
+        {
+            tracing::record(tracing::EventType::node, tracing::Phase::instant, name_id, i);
+        }
+    }).join();
+
+    tracing::set_buffer_capacity(1UL << 14);
+
+    // rounded up to 32 events; only the newest survive, less the slot a writer could be reusing during the dump
+    std::ostringstream os;
+    EXPECT_EQ(tracing::dump_chrome_trace(os), 31);
+    EXPECT_NE(os.str().find(R"("args":{"id":1000})"), std::string::npos);
+    EXPECT_NE(os.str().find(R"("args":{"id":970})"), std::string::npos);
+    EXPECT_EQ(os.str().find(R"("args":{"id":969})"), std::string::npos);
+}
+
+TEST_F(TestTracing, DumpWhileRecording)
+{
+    tracing::set_buffer_capacity(1024);
+
+    auto name_id = tracing::intern("concurrent");
+    std::atomic<bool> running{true};
+
+    std::vector<std::thread> writers;
+    for (int t = 0; t < 4; ++t)
+    {
+        writers.emplace_back([&running, name_id] {
+            while (running.load(std::memory_order_relaxed))
+            {
+                tracing::record(tracing::EventType::node, tracing::Phase::begin, name_id);
+                tracing::record(tracing::EventType::node, tracing::Phase::end, name_id);
+            }
+        });
+    }
+
+    for (int i = 0; i < 5; ++i)
+    {
+        std::ostringstream os;
+        tracing::dump_chrome_trace(os);
+        EXPECT_EQ(os.str().substr(os.str().size() - 4), "\n]}\n");
+    }
+
+    running = false;
+    for (auto& writer : writers)
+    {
+        writer.join();
+    }
+
+    tracing::set_buffer_capacity(1UL << 14);
+}
+
+}  // namespace mrc
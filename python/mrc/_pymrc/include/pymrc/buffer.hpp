@@ -0,0 +1,186 @@
+/**
+ * SPDX-FileCopyrightText: Copyright (c) 2022-2023, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include "pymrc/node.hpp"
+#include "pymrc/types.hpp"
+
+#include "mrc/channel/status.hpp"
+#include "mrc/edge/edge_readable.hpp"
+#include "mrc/edge/edge_writable.hpp"
+#include "mrc/memory/buffer.hpp"
+
+#include <pybind11/buffer_info.h>
+#include <pybind11/gil.h>
+#include <pybind11/pytypes.h>
+
+#include <cstddef>
+#include <memory>
+#include <string>
+#include <type_traits>
+#include <utility>
+
+namespace mrc::pymrc {
+
+// Export everything in the mrc::pymrc namespace by default since we compile with -fvisibility=hidden
+#pragma GCC visibility push(default)
+
+/**
+ * @brief Wraps the memory of a Python object in a memory::buffer without copying it.
+ *
+ * Objects exporting a writable, C-contiguous buffer (NumPy arrays, bytearray, memoryview, ...) and objects exposing
+ * `__cuda_array_interface__` (CuPy arrays, Numba device arrays, ...) are wrapped zero-copy; the returned buffer keeps
+ * `obj` alive until it is released. Read-only or strided exports are copied into host memory. A `mrc.Buffer` which is
+ * not referenced anywhere else gives up its memory::buffer by move. The GIL must be held.
+ */
+memory::buffer buffer_from_python(pybind11::object obj);
+
+/**
+ * @brief Same as buffer_from_python, except that a `mrc.Buffer` is always shared with the caller rather than moved.
+ */
+std::shared_ptr<memory::buffer> shared_buffer_from_python(pybind11::object obj);
+
+template <typename BufferT>
+BufferT buffer_cast(pybind11::object&& obj)
+{
+    if constexpr (std::is_same_v<BufferT, memory::buffer>)
+    {
+        return buffer_from_python(std::move(obj));
+    }
+    else
+    {
+        static_assert(std::is_same_v<BufferT, std::shared_ptr<memory::buffer>>);
+        return shared_buffer_from_python(std::move(obj));
+    }
+}
+
+class BufferProxy
+{
+  public:
+    static std::shared_ptr<memory::buffer> init(pybind11::object obj);
+
+    static std::size_t nbytes(const memory::buffer& self);
+    static std::string kind(const memory::buffer& self);
+    static std::string repr(const memory::buffer& self);
+
+    // only host accessible memory (host, pinned and managed) is exported via the buffer protocol
+    static pybind11::buffer_info get_buffer_info(memory::buffer& self);
+
+    // https://numpy.org/doc/stable/reference/arrays.interface.html
+    static pybind11::dict array_interface(memory::buffer& self);
+
+    // https://numba.readthedocs.io/en/stable/cuda/cuda_array_interface.html
+    static pybind11::dict cuda_array_interface(memory::buffer& self);
+};
+
+/**
+ * @brief Converts PyHolder -> memory::buffer (or std::shared_ptr<memory::buffer>) on edges between Python and C++
+ * nodes using buffer_from_python rather than a pybind11 cast, so that any buffer exporter can feed a C++ buffer sink.
+ */
+template <typename SinkT>
+class BufferConvertingEdgeWritable : public edge::ConvertingEdgeWritableBase<PyHolder, SinkT>
+{
+    using base_t = edge::ConvertingEdgeWritableBase<PyHolder, SinkT>;
+
+  public:
+    using typename base_t::input_t;
+    using typename base_t::output_t;
+
+    using base_t::base_t;
+
+    channel::Status await_write(input_t&& data) override
+    {
+        output_t buffer;
+        {
+            pybind11::gil_scoped_acquire gil;
+            buffer = buffer_cast<output_t>(pybind11::object(std::move(data)));
+        }
+
+        return this->downstream().await_write(std::move(buffer));
+    }
+};
+
+template <typename OutputT>
+class BufferConvertingEdgeReadable : public edge::ConvertingEdgeReadableBase<PyHolder, OutputT>
+{
+    using base_t = edge::ConvertingEdgeReadableBase<PyHolder, OutputT>;
+
+  public:
+    using typename base_t::input_t;
+    using typename base_t::output_t;
+
+    using base_t::base_t;
+
+    channel::Status await_read(output_t& data) override
+    {
+        input_t source_data;
+        auto ret_val = this->upstream().await_read(source_data);
+
+        if (ret_val == channel::Status::success)
+        {
+            pybind11::gil_scoped_acquire gil;
+
+            data = buffer_cast<output_t>(pybind11::object(std::move(source_data)));
+        }
+
+        return ret_val;
+    }
+};
+
+#pragma GCC visibility pop
+
+}  // namespace mrc::pymrc
+
+// Avoid forward declaring template specialization base classes
+// IWYU pragma: no_forward_declare mrc::edge::ConvertingEdgeReadable
+// IWYU pragma: no_forward_declare mrc::edge::ConvertingEdgeWritable
+
+namespace mrc::edge {
+
+// C++ -> Python moves the buffer into a new `mrc.Buffer` via the generic converters in pymrc/node.hpp; only the
+// Python -> C++ direction needs to bypass pybind11::cast
+
+template <>
+struct ConvertingEdgeWritable<pymrc::PyHolder, memory::buffer, void>
+  : public pymrc::BufferConvertingEdgeWritable<memory::buffer>
+{
+    using pymrc::BufferConvertingEdgeWritable<memory::buffer>::BufferConvertingEdgeWritable;
+};
+
+template <>
+struct ConvertingEdgeWritable<pymrc::PyHolder, std::shared_ptr<memory::buffer>, void>
+  : public pymrc::BufferConvertingEdgeWritable<std::shared_ptr<memory::buffer>>
+{
+    using pymrc::BufferConvertingEdgeWritable<std::shared_ptr<memory::buffer>>::BufferConvertingEdgeWritable;
+};
+
+template <>
+struct ConvertingEdgeReadable<pymrc::PyHolder, memory::buffer, void>
+  : public pymrc::BufferConvertingEdgeReadable<memory::buffer>
+{
+    using pymrc::BufferConvertingEdgeReadable<memory::buffer>::BufferConvertingEdgeReadable;
+};
+
+template <>
+struct ConvertingEdgeReadable<pymrc::PyHolder, std::shared_ptr<memory::buffer>, void>
+  : public pymrc::BufferConvertingEdgeReadable<std::shared_ptr<memory::buffer>>
+{
+    using pymrc::BufferConvertingEdgeReadable<std::shared_ptr<memory::buffer>>::BufferConvertingEdgeReadable;
+};
+
+}  // namespace mrc::edge
@@ -19,6 +19,8 @@
 
 #include "pymrc/types.hpp"
 
+#include <chrono>
+#include <cstddef>
 #include <optional>
 #include <string>
 
@@ -54,16 +56,33 @@ class OperatorProxy
     static std::string get_name(PythonOperator& self);
 };
 
+/**
+ * @brief Counts the GIL acquisitions made by the batched python operators (filter, filter_by_attr, filter_by_key, flatten,
+ * map, sample and window) and the number of values processed under them. Reported by mrc.benchmarking.
+ */
+class OperatorBatchStatistics
+{
+  public:
+    static void record_batch(std::size_t value_count);
+    static std::size_t batch_count();
+    static std::size_t value_count();
+    static void reset();
+};
+
 class OperatorsProxy
 {
   public:
     static PythonOperator build(PyFuncHolder<void(const PyObjectObservable& obs, PyObjectSubscriber& sub)> build_fn);
     static PythonOperator filter(PyFuncHolder<bool(pybind11::object x)> filter_fn);
+    static PythonOperator filter_by_attr(const std::string& name, pybind11::object values);
+    static PythonOperator filter_by_key(pybind11::object key, pybind11::object values);
     static PythonOperator flatten();
     static PythonOperator map(OnDataFunction map_fn);
     static PythonOperator on_completed(PyFuncHolder<std::optional<pybind11::object>()> finally_fn);
     static PythonOperator pairwise();
+    static PythonOperator sample(std::size_t every_n);
     static PythonOperator to_list();
+    static PythonOperator window(std::size_t count, std::optional<std::chrono::microseconds> timeout);
 };
 
 #pragma GCC visibility pop
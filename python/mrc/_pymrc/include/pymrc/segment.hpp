@@ -25,6 +25,7 @@
 #include <pybind11/pytypes.h>
 #include <pybind11/stl.h>  // IWYU pragma: keep
 
+#include <cstddef>
 #include <functional>
 #include <memory>
 #include <string>
@@ -234,5 +235,15 @@ class BuilderProxy
     static void init_module(mrc::segment::Builder& self, std::shared_ptr<mrc::modules::SegmentModule> module);
 };
 
+class SegmentObjectProxy
+{
+  public:
+    /**
+     * @brief Configures how many values a python sink or node reads from its input per batch, and how long it waits for
+     * a batch to fill. Batched python operators (filter, flatten and map) acquire the GIL once per batch.
+     */
+    static void set_read_batch(mrc::segment::ObjectProperties& self, std::size_t max_count, std::size_t max_wait_us);
+};
+
 #pragma GCC visibility pop
 }  // namespace mrc::pymrc
@@ -0,0 +1,282 @@
+/**
+ * SPDX-FileCopyrightText: Copyright (c) 2022-2023, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "pymrc/buffer.hpp"
+
+#include "mrc/memory/memory_kind.hpp"
+#include "mrc/memory/resources/host/malloc_memory_resource.hpp"
+#include "mrc/memory/resources/memory_resource.hpp"
+#include "mrc/utils/string_utils.hpp"
+
+#include <glog/logging.h>
+#include <pybind11/cast.h>
+#include <pybind11/gil.h>
+#include <pybind11/pybind11.h>
+#include <pybind11/pytypes.h>
+
+#include <cstdint>
+#include <sstream>
+#include <string>
+#include <utility>
+
+namespace mrc::pymrc {
+
+namespace py = pybind11;
+using namespace py::literals;
+
+namespace {
+
+/**
+ * @brief Memory resource which hands out the memory of an exported Py_buffer exactly once and releases the export,
+ * which keeps the exporting object alive, when the owning memory::buffer is destroyed.
+ */
+class PyBufferResource final : public memory::memory_resource
+{
+  public:
+    explicit PyBufferResource(const Py_buffer& view) : m_view(view) {}
+
+    ~PyBufferResource() override
+    {
+        py::gil_scoped_acquire gil;
+        PyBuffer_Release(&m_view);
+    }
+
+  private:
+    void* do_allocate(std::size_t bytes) final
+    {
+        CHECK_EQ(bytes, static_cast<std::size_t>(m_view.len));
+        return m_view.buf;
+    }
+
+    // the export is released with the resource; a zero byte buffer may never be deallocated
+    void do_deallocate(void* /*ptr*/, std::size_t /*bytes*/) final {}
+
+    memory::memory_kind do_kind() const final
+    {
+        return memory::memory_kind::host;
+    }
+
+    Py_buffer m_view;
+};
+
+/**
+ * @brief Memory resource for memory owned by a Python object exposing `__cuda_array_interface__`
+ */
+class PyObjectResource final : public memory::memory_resource
+{
+  public:
+    PyObjectResource(py::object owner, void* ptr, memory::memory_kind kind) :
+      m_owner(std::move(owner)),
+      m_ptr(ptr),
+      m_kind(kind)
+    {}
+
+    ~PyObjectResource() override
+    {
+        py::gil_scoped_acquire gil;
+        m_owner = py::object();
+    }
+
+  private:
+    void* do_allocate(std::size_t /*bytes*/) final
+    {
+        return m_ptr;
+    }
+
+    void do_deallocate(void* /*ptr*/, std::size_t /*bytes*/) final {}
+
+    memory::memory_kind do_kind() const final
+    {
+        return m_kind;
+    }
+
+    py::object m_owner;
+    void* m_ptr;
+    memory::memory_kind m_kind;
+};
+
+memory::memory_kind kind_of(const memory::buffer& buffer)
+{
+    // default constructed and moved-from buffers have no memory resource
+    return buffer.data() == nullptr ? memory::memory_kind::none : buffer.kind();
+}
+
+bool is_host_accessible(memory::memory_kind kind)
+{
+    return kind == memory::memory_kind::host || kind == memory::memory_kind::pinned ||
+           kind == memory::memory_kind::managed;
+}
+
+memory::buffer buffer_from_cuda_array_interface(py::object obj)
+{
+    auto interface = obj.attr("__cuda_array_interface__").cast<py::dict>();
+
+    if (interface.contains("strides") && !interface["strides"].is_none())
+    {
+        throw py::value_error("only C-contiguous objects exposing __cuda_array_interface__ can be wrapped");
+    }
+
+    auto data     = interface["data"].cast<py::tuple>();
+    auto* ptr     = reinterpret_cast<void*>(data[0].cast<std::uintptr_t>());
+    // typestr is <byteorder><kind><itemsize>, e.g. "<f4"
+    auto typestr = interface["typestr"].cast<std::string>();
+
+    std::size_t bytes = std::stoul(typestr.substr(2));
+    for (const auto& extent : interface["shape"].cast<py::tuple>())
+    {
+        bytes *= extent.cast<std::size_t>();
+    }
+
+    return memory::buffer(bytes,
+                          std::make_shared<PyObjectResource>(std::move(obj), ptr, memory::memory_kind::device));
+}
+
+memory::buffer copy_from_python(py::handle obj)
+{
+    Py_buffer view;
+    if (PyObject_GetBuffer(obj.ptr(), &view, PyBUF_FULL_RO) != 0)
+    {
+        throw py::error_already_set();
+    }
+
+    memory::buffer buffer(view.len, std::make_shared<memory::malloc_memory_resource>());
+
+    auto rc = PyBuffer_ToContiguous(buffer.data(), &view, view.len, 'C');
+    PyBuffer_Release(&view);
+
+    if (rc != 0)
+    {
+        throw py::error_already_set();
+    }
+
+    return buffer;
+}
+
+}  // namespace
+
+memory::buffer buffer_from_python(py::object obj)
+{
+    // a Buffer referenced only by obj and by its own holder can give up its memory, everything else is wrapped
+    if (py::isinstance<memory::buffer>(obj) && obj.ref_count() == 1)
+    {
+        auto holder = obj.cast<std::shared_ptr<memory::buffer>>();
+        if (holder.use_count() == 2)
+        {
+            return std::move(*holder);
+        }
+    }
+
+    if (PyObject_CheckBuffer(obj.ptr()) == 0)
+    {
+        if (py::hasattr(obj, "__cuda_array_interface__"))
+        {
+            return buffer_from_cuda_array_interface(std::move(obj));
+        }
+
+        throw py::type_error(MRC_CONCAT_STR("cannot convert " << py::str(obj.get_type()).cast<std::string>()
+                                                              << " to a memory::buffer, it supports neither the buffer "
+                                                                 "protocol nor __cuda_array_interface__"));
+    }
+
+    Py_buffer view;
+    if (PyObject_GetBuffer(obj.ptr(), &view, PyBUF_C_CONTIGUOUS | PyBUF_WRITABLE) != 0)
+    {
+        // read-only (e.g. bytes) or non-contiguous: the consumer owns a mutable buffer, so it gets a copy
+        PyErr_Clear();
+        return copy_from_python(obj);
+    }
+
+    return memory::buffer(view.len, std::make_shared<PyBufferResource>(view));
+}
+
+std::shared_ptr<memory::buffer> shared_buffer_from_python(py::object obj)
+{
+    if (py::isinstance<memory::buffer>(obj))
+    {
+        return obj.cast<std::shared_ptr<memory::buffer>>();
+    }
+
+    return std::make_shared<memory::buffer>(buffer_from_python(std::move(obj)));
+}
+
+std::shared_ptr<memory::buffer> BufferProxy::init(py::object obj)
+{
+    return shared_buffer_from_python(std::move(obj));
+}
+
+std::size_t BufferProxy::nbytes(const memory::buffer& self)
+{
+    return self.bytes();
+}
+
+std::string BufferProxy::kind(const memory::buffer& self)
+{
+    return memory::kind_string(kind_of(self));
+}
+
+std::string BufferProxy::repr(const memory::buffer& self)
+{
+    return MRC_CONCAT_STR("Buffer(nbytes=" << self.bytes() << ", kind='" << kind(self) << "')");
+}
+
+py::buffer_info BufferProxy::get_buffer_info(memory::buffer& self)
+{
+    auto kind = kind_of(self);
+    if (kind != memory::memory_kind::none && !is_host_accessible(kind))
+    {
+        throw py::buffer_error(MRC_CONCAT_STR("memory of kind '" << memory::kind_string(kind)
+                                                                 << "' is not accessible from the host"));
+    }
+
+    return py::buffer_info(self.data(),
+                           sizeof(std::uint8_t),
+                           py::format_descriptor<std::uint8_t>::format(),
+                           1,
+                           {static_cast<py::ssize_t>(self.bytes())},
+                           {static_cast<py::ssize_t>(sizeof(std::uint8_t))});
+}
+
+py::dict BufferProxy::array_interface(memory::buffer& self)
+{
+    auto kind = kind_of(self);
+    if (kind != memory::memory_kind::none && !is_host_accessible(kind))
+    {
+        throw py::attribute_error("__array_interface__ is only available for host accessible memory");
+    }
+
+    return py::dict("shape"_a   = py::make_tuple(self.bytes()),
+                    "typestr"_a = "|u1",
+                    "data"_a    = py::make_tuple(reinterpret_cast<std::uintptr_t>(self.data()), false),
+                    "version"_a = 3);
+}
+
+py::dict BufferProxy::cuda_array_interface(memory::buffer& self)
+{
+    auto kind = kind_of(self);
+    if (kind != memory::memory_kind::device && kind != memory::memory_kind::managed)
+    {
+        throw py::attribute_error("__cuda_array_interface__ is only available for device and managed memory");
+    }
+
+    return py::dict("shape"_a   = py::make_tuple(self.bytes()),
+                    "typestr"_a = "|u1",
+                    "data"_a    = py::make_tuple(reinterpret_cast<std::uintptr_t>(self.data()), false),
+                    "strides"_a = py::none(),
+                    "version"_a = 3);
+}
+
+}  // namespace mrc::pymrc
@@ -21,6 +21,9 @@
 #include "pymrc/utilities/acquire_gil.hpp"
 #include "pymrc/utilities/function_wrappers.hpp"
 
+#include "mrc/channel/types.hpp"
+#include "mrc/node/read_batch.hpp"
+
 #include <glog/logging.h>
 #include <pybind11/cast.h>
 #include <pybind11/functional.h>  // IWYU pragma: keep
@@ -29,7 +32,13 @@
 #include <pybind11/pytypes.h>
 #include <rxcpp/rx.hpp>
 
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
 #include <exception>
+#include <memory>
+#include <stdexcept>
 #include <tuple>
 #include <type_traits>
 #include <utility>
@@ -41,6 +50,204 @@ namespace mrc::pymrc {
 
 namespace py = pybind11;
 
+namespace {
+
+std::atomic<std::size_t> s_batch_count{0};
+std::atomic<std::size_t> s_value_count{0};
+
+/**
+ * @brief Applies process_fn to each value with the GIL held. Values delivered inside a node::ReadBatch are held back
+ * until the end of the batch and processed under a single GIL acquisition; values delivered outside of one are
+ * processed immediately. process_fn appends its results to the output vector, which is emitted after the GIL has been
+ * released.
+ */
+template <typename ProcessFnT>
+PyObjectObservable process_batched_with_gil(PyObjectObservable source, ProcessFnT process_fn)
+{
+    return rxcpp::observable<>::create<PyHolder>([source, process_fn](PyObjectSubscriber sink) {
+        auto pending = std::make_shared<std::vector<PyHolder>>();
+
+        // the flush state, which holds python references in process_fn, is created once per subscription and shared by
+        // reference so that deferring it to a node::ReadBatch copies a single pointer rather than the python references
+        auto flush_fn = [sink, pending, process_fn]() {
+            if (pending->empty())
+            {
+                return;
+            }
+
+            OperatorBatchStatistics::record_batch(pending->size());
+
+            std::vector<PyHolder> outputs;
+            std::exception_ptr error;
+
+            {
+                AcquireGIL gil;
+
+                try
+                {
+                    for (auto& data_object : *pending)
+                    {
+                        process_fn(std::move(data_object), outputs);
+                    }
+                } catch (...)
+                {
+                    error = std::current_exception();
+                }
+
+                pending->clear();
+            }
+
+            // values processed before an error are still forwarded
+            for (auto& output : outputs)
+            {
+                if (!sink.is_subscribed())
+                {
+                    break;
+                }
+                sink.on_next(std::move(output));
+            }
+
+            if (error)
+            {
+                sink.on_error(std::move(error));
+            }
+        };
+        auto flush = std::make_shared<decltype(flush_fn)>(std::move(flush_fn));
+
+        source.subscribe(
+            sink,
+            [pending, flush](PyHolder data_object) {
+                pending->push_back(std::move(data_object));
+
+                auto* read_batch = node::ReadBatch::current();
+                if (read_batch == nullptr)
+                {
+                    (*flush)();
+                }
+                else if (pending->size() == 1)
+                {
+                    read_batch->defer([flush]() {
+                        (*flush)();
+                    });
+                }
+            },
+            [sink, flush](std::exception_ptr ex) {
+                (*flush)();
+                sink.on_error(std::move(ex));
+            },
+            [sink, flush]() {
+                (*flush)();
+                sink.on_completed();
+            });
+    });
+}
+
+/**
+ * @brief Forwards data_object if selected, the attribute or item looked up from it, is contained in values. Lookups
+ * which fail because the attribute or key does not exist drop the value; any other python error is rethrown.
+ */
+void forward_if_contained(PyObject* selected,
+                          const PyHolder& values,
+                          PyHolder&& data_object,
+                          std::vector<PyHolder>& outputs,
+                          PyObject* missing_error)
+{
+    if (selected == nullptr)
+    {
+        if (PyErr_ExceptionMatches(missing_error) == 0)
+        {
+            throw py::error_already_set();
+        }
+        PyErr_Clear();
+        return;
+    }
+
+    auto selected_obj = py::reinterpret_steal<py::object>(selected);
+
+    auto contains = PySequence_Contains(values.ptr(), selected_obj.ptr());
+    if (contains < 0)
+    {
+        throw py::error_already_set();
+    }
+    if (contains == 1)
+    {
+        outputs.push_back(std::move(data_object));
+    }
+}
+
+/**
+ * @brief Collects the references dropped by operators which otherwise never need the GIL, e.g. sample, and releases
+ * them under a single GIL acquisition at the end of the current node::ReadBatch, once MaxDeferred have accumulated, or
+ * when the stream terminates. Outside of a ReadBatch references are released immediately.
+ */
+class DeferredRelease : public std::enable_shared_from_this<DeferredRelease>
+{
+  public:
+    static constexpr std::size_t MaxDeferred = 256;
+
+    ~DeferredRelease()
+    {
+        flush();
+    }
+
+    void release(PyHolder&& data_object)
+    {
+        m_pending.push_back(std::move(data_object));
+
+        auto* read_batch = node::ReadBatch::current();
+        if (read_batch == nullptr || m_pending.size() >= MaxDeferred)
+        {
+            flush();
+        }
+        else if (m_pending.size() == 1)
+        {
+            read_batch->defer([self = shared_from_this()]() {
+                self->flush();
+            });
+        }
+    }
+
+    void flush()
+    {
+        if (m_pending.empty())
+        {
+            return;
+        }
+
+        OperatorBatchStatistics::record_batch(m_pending.size());
+
+        AcquireGIL gil;
+        m_pending.clear();
+    }
+
+  private:
+    std::vector<PyHolder> m_pending;
+};
+
+}  // namespace
+
+void OperatorBatchStatistics::record_batch(std::size_t value_count)
+{
+    s_batch_count.fetch_add(1, std::memory_order_relaxed);
+    s_value_count.fetch_add(value_count, std::memory_order_relaxed);
+}
+
+std::size_t OperatorBatchStatistics::batch_count()
+{
+    return s_batch_count.load(std::memory_order_relaxed);
+}
+
+std::size_t OperatorBatchStatistics::value_count()
+{
+    return s_value_count.load(std::memory_order_relaxed);
+}
+
+void OperatorBatchStatistics::reset()
+{
+    s_batch_count.store(0, std::memory_order_relaxed);
+    s_value_count.store(0, std::memory_order_relaxed);
+}
+
 PythonOperator::PythonOperator(std::string name, PyObjectOperateFn operate_fn) :
   m_name(std::move(name)),
   m_operate_fn(std::move(operate_fn))
@@ -91,80 +298,70 @@ PythonOperator OperatorsProxy::build(PyFuncHolder<void(const PyObjectObservable&
 
 PythonOperator OperatorsProxy::filter(PyFuncHolder<bool(pybind11::object x)> filter_fn)
 {
-    //  Build and return the map operator
+    //  Build and return the filter operator
     return {"filter", [=](PyObjectObservable source) {
-                return source.filter([=](PyHolder data_object) {
-                    py::gil_scoped_acquire gil;
-
+                return process_batched_with_gil(source, [=](PyHolder&& data_object, std::vector<PyHolder>& outputs) {
                     // Must make a copy here!
-                    bool returned = filter_fn(data_object.copy_obj());
-
-                    return returned;
+                    if (filter_fn(data_object.copy_obj()))
+                    {
+                        outputs.push_back(std::move(data_object));
+                    }
                 });
             }};
 }
 
-PythonOperator OperatorsProxy::flatten()
+PythonOperator OperatorsProxy::filter_by_attr(const std::string& name, pybind11::object values)
 {
-    //  Build and return the map operator
-    return {"flatten", [=](PyObjectObservable source) {
-                return rxcpp::observable<>::create<PyHolder>([=](PyObjectSubscriber sink) {
-                    source.subscribe(
-                        sink,
-                        [sink](PyHolder data_object) {
-                            try
-                            {
-                                AcquireGIL gil;
-
-                                // Convert to a vector to allow releasing the GIL
-                                std::vector<PyHolder> obj_list;
-
-                                {
-                                    // Convert to C++ vector while we have the GIL. The list will go out of scope in
-                                    // this block
-                                    py::list l = py::object(std::move(data_object));
-
-                                    for (const auto& item : l)
-                                    {
-                                        // This increases the ref count by one but thats fine since the list will go out
-                                        // of scope and deref all its elements
-                                        obj_list.emplace_back(std::move(py::reinterpret_borrow<py::object>(item)));
-                                    }
-                                }
-
-                                if (sink.is_subscribed())
-                                {
-                                    // Release the GIL before calling on_next
-                                    gil.release();
-
-                                    // Loop over the list
-                                    for (auto& i : obj_list)
-                                    {
-                                        sink.on_next(std::move(i));
-                                    }
-                                }
-                            } catch (py::error_already_set& err)
-                            {
-                                // Need the GIL here
-                                AcquireGIL gil;
+    // python objects captured by the operator are held in a PyHolder so copying the operator never touches refcounts
+    PyHolder attr_name = py::str(name);
+    PyHolder selected_values(std::move(values));
+
+    return {"filter_by_attr", [=](PyObjectObservable source) {
+                return process_batched_with_gil(
+                    source,
+                    [attr_name, selected_values](PyHolder&& data_object, std::vector<PyHolder>& outputs) {
+                        forward_if_contained(PyObject_GetAttr(data_object.ptr(), attr_name.ptr()),
+                                             selected_values,
+                                             std::move(data_object),
+                                             outputs,
+                                             PyExc_AttributeError);
+                    });
+            }};
+}
 
-                                py::print("Python error in callback hit!");
-                                py::print(err.what());
+PythonOperator OperatorsProxy::filter_by_key(pybind11::object key, pybind11::object values)
+{
+    PyHolder item_key(std::move(key));
+    PyHolder selected_values(std::move(values));
+
+    return {"filter_by_key", [=](PyObjectObservable source) {
+                return process_batched_with_gil(
+                    source,
+                    [item_key, selected_values](PyHolder&& data_object, std::vector<PyHolder>& outputs) {
+                        // KeyError and IndexError are both LookupErrors
+                        forward_if_contained(PyObject_GetItem(data_object.ptr(), item_key.ptr()),
+                                             selected_values,
+                                             std::move(data_object),
+                                             outputs,
+                                             PyExc_LookupError);
+                    });
+            }};
+}
 
-                                // Release before calling on_error
-                                gil.release();
+PythonOperator OperatorsProxy::flatten()
+{
+    //  Build and return the flatten operator
+    return {"flatten", [=](PyObjectObservable source) {
+                return process_batched_with_gil(source, [](PyHolder&& data_object, std::vector<PyHolder>& outputs) {
+                    // Convert to C++ vector while we have the GIL. The list will go out of scope in this block
+                    py::list l = py::object(std::move(data_object));
 
-                                sink.on_error(std::current_exception());
-                            }
-                        },
-                        [sink](std::exception_ptr ex) {
-                            // Forward
-                            sink.on_error(std::move(ex));
-                        },
-                        [sink]() {
-                            // Forward
-                            sink.on_completed();
-                        });
+                    for (const auto& item : l)
+                    {
+                        // This increases the ref count by one but thats fine since the list will go out of scope and
+                        // deref all its elements
+                        outputs.emplace_back(py::reinterpret_borrow<py::object>(item));
+                    }
                 });
             }};
 }
@@ -173,11 +370,9 @@ PythonOperator OperatorsProxy::map(OnDataFunction map_fn)
 {
     // Build and return the map operator
     return {"map", [=](PyObjectObservable source) -> PyObjectObservable {
-                return source.map([=](PyHolder data_object) -> PyHolder {
-                    py::gil_scoped_acquire gil;
-
+                return process_batched_with_gil(source, [=](PyHolder&& data_object, std::vector<PyHolder>& outputs) {
                     // Call the map function
-                    return map_fn(std::move(data_object));
+                    outputs.emplace_back(map_fn(std::move(data_object)));
                 });
             }};
 }
@@ -237,6 +432,43 @@ PythonOperator OperatorsProxy::pairwise()
             }};
 }
 
+PythonOperator OperatorsProxy::sample(std::size_t every_n)
+{
+    if (every_n == 0)
+    {
+        throw std::invalid_argument("sample requires every_n > 0");
+    }
+
+    return {"sample", [every_n](PyObjectObservable source) {
+                return rxcpp::observable<>::create<PyHolder>([source, every_n](PyObjectSubscriber sink) {
+                    auto dropped = std::make_shared<DeferredRelease>();
+                    auto counter = std::make_shared<std::size_t>(0);
+
+                    source.subscribe(
+                        sink,
+                        [sink, dropped, counter, every_n](PyHolder data_object) {
+                            // the first of every every_n values is forwarded without ever acquiring the GIL
+                            if ((*counter)++ % every_n == 0)
+                            {
+                                sink.on_next(std::move(data_object));
+                            }
+                            else
+                            {
+                                dropped->release(std::move(data_object));
+                            }
+                        },
+                        [sink, dropped](std::exception_ptr ex) {
+                            dropped->flush();
+                            sink.on_error(std::move(ex));
+                        },
+                        [sink, dropped]() {
+                            dropped->flush();
+                            sink.on_completed();
+                        });
+                });
+            }};
+}
+
 template <class T>
 struct to_list  // NOLINT
 {
@@ -314,4 +546,111 @@ PythonOperator OperatorsProxy::to_list()
             }};
 }
 
+PythonOperator OperatorsProxy::window(std::size_t count, std::optional<std::chrono::microseconds> timeout)
+{
+    if (count == 0)
+    {
+        throw std::invalid_argument("window requires count > 0");
+    }
+
+    return {"window", [count, timeout](PyObjectObservable source) {
+                return rxcpp::observable<>::create<PyHolder>([source, count, timeout](PyObjectSubscriber sink) {
+                    // only touched from the progress engine of the node, which also runs the timeout callbacks
+                    struct Window
+                    {
+                        std::vector<PyHolder> values;
+                        channel::time_point_t opened;
+                        std::uint64_t generation{0};  // incremented each time a window is closed
+                        bool done{false};
+                    };
+
+                    auto window = std::make_shared<Window>();
+                    window->values.reserve(count);
+
+                    // values are collected without the GIL; it is acquired once per window to build the list
+                    auto emit = [sink, window]() {
+                        if (window->values.empty())
+                        {
+                            return;
+                        }
+
+                        OperatorBatchStatistics::record_batch(window->values.size());
+                        ++window->generation;
+
+                        PyHolder values_list;
+                        {
+                            AcquireGIL gil;
+
+                            py::list values(window->values.size());
+                            for (std::size_t i = 0; i < window->values.size(); ++i)
+                            {
+                                // PyList_SET_ITEM steals the reference released from the holder
+                                PyList_SET_ITEM(values.ptr(),
+                                                static_cast<Py_ssize_t>(i),
+                                                py::object(std::move(window->values[i])).release().ptr());
+                            }
+                            window->values.clear();
+
+                            values_list = std::move(values);
+                        }
+
+                        sink.on_next(std::move(values_list));
+                    };
+
+                    // pending timeout callbacks become no-ops however the subscription ends
+                    sink.add([window]() {
+                        window->done = true;
+                        AcquireGIL gil;
+                        window->values.clear();
+                    });
+
+                    source.subscribe(
+                        sink,
+                        [window, emit, count, timeout](PyHolder data_object) {
+                            const auto now     = channel::clock_t::now();
+                            const bool opening = window->values.empty();
+                            if (opening)
+                            {
+                                window->opened = now;
+                            }
+
+                            window->values.push_back(std::move(data_object));
+
+                            if (window->values.size() >= count || (timeout && now - window->opened >= *timeout))
+                            {
+                                emit();
+                                return;
+                            }
+
+                            // the progress engine closes the window once the timeout expires, even if no further
+                            // value arrives; outside of a progress engine the window is closed by the next value
+                            auto* deadlines = node::ReadDeadlines::current();
+                            if (opening && timeout && deadlines != nullptr)
+                            {
+                                deadlines->schedule(window->opened + *timeout,
+                                                    [window, emit, generation = window->generation]() {
+                                                        if (!window->done && window->generation == generation)
+                                                        {
+                                                            emit();
+                                                        }
+                                                    });
+                            }
+                        },
+                        [sink, window](std::exception_ptr ex) {
+                            window->done = true;
+                            {
+                                AcquireGIL gil;
+                                window->values.clear();
+                            }
+                            sink.on_error(std::move(ex));
+                        },
+                        [sink, window, emit]() {
+                            window->done = true;
+                            emit();
+                            sink.on_completed();
+                        });
+                });
+            }};
+}
+
 }  // namespace mrc::pymrc
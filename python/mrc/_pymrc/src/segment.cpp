@@ -39,6 +39,8 @@
 #include <pybind11/pytypes.h>
 #include <rxcpp/rx.hpp>
 
+#include <chrono>
+#include <cstddef>
 #include <exception>
 #include <fstream>
 #include <functional>
@@ -513,4 +515,29 @@ void BuilderProxy::make_edge(mrc::segment::Builder& self,
     }
 }
 
+void SegmentObjectProxy::set_read_batch(mrc::segment::ObjectProperties& self,
+                                        std::size_t max_count,
+                                        std::size_t max_wait_us)
+{
+    node::RxSinkBase<PyHolder>* sink = nullptr;
+
+    if (self.is_writable_provider())
+    {
+        sink = dynamic_cast<node::RxSinkBase<PyHolder>*>(&self.writable_provider_base());
+    }
+
+    if (sink == nullptr)
+    {
+        throw std::runtime_error("set_read_batch requires a python sink or node. '" + self.name() +
+                                 "' does not read python objects from a channel");
+    }
+
+    if (max_count == 0)
+    {
+        throw std::invalid_argument("set_read_batch: max_count must be at least 1");
+    }
+
+    sink->set_read_batch(max_count, std::chrono::microseconds(max_wait_us));
+}
+
 }  // namespace mrc::pymrc
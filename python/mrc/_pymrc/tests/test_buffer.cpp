@@ -0,0 +1,83 @@
+/**
+ * SPDX-FileCopyrightText: Copyright (c) 2022-2023, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "test_pymrc.hpp"
+
+#include "pymrc/buffer.hpp"
+
+#include "mrc/memory/buffer.hpp"
+#include "mrc/memory/memory_kind.hpp"
+
+#include <gtest/gtest.h>
+#include <pybind11/cast.h>
+#include <pybind11/pybind11.h>
+#include <pybind11/pytypes.h>
+
+#include <cstddef>
+#include <memory>
+#include <string>
+
+namespace py    = pybind11;
+namespace pymrc = mrc::pymrc;
+
+PYMRC_TEST_CLASS(Buffer);
+
+TEST_F(TestBuffer, WrapWritableExporter)
+{
+    py::bytearray data(std::string(64, 'a'));
+    auto* ptr      = PyByteArray_AsString(data.ptr());
+    auto ref_count = data.ref_count();
+
+    {
+        auto buffer = pymrc::buffer_from_python(data);
+
+        // zero-copy: the buffer aliases the bytearray and keeps it alive
+        EXPECT_EQ(buffer.data(), ptr);
+        EXPECT_EQ(buffer.bytes(), 64U);
+        EXPECT_EQ(buffer.kind(), memory::memory_kind::host);
+        EXPECT_GT(data.ref_count(), ref_count);
+
+        static_cast<char*>(buffer.data())[0] = 'b';
+    }
+
+    EXPECT_EQ(data.ref_count(), ref_count);
+    EXPECT_EQ(PyByteArray_AsString(data.ptr())[0], 'b');
+
+    // slices of a memoryview are contiguous and wrapped as well
+    py::memoryview view(data);
+    auto shared = pymrc::shared_buffer_from_python(view[py::slice(8, 16, 1)]);
+    EXPECT_EQ(shared->data(), ptr + 8);
+    EXPECT_EQ(shared->bytes(), 8U);
+}
+
+TEST_F(TestBuffer, CopyReadOnlyAndStrided)
+{
+    py::bytes data(std::string("0123456789"));
+
+    auto buffer = pymrc::buffer_from_python(data);
+    EXPECT_NE(buffer.data(), PyBytes_AsString(data.ptr()));
+    EXPECT_EQ(std::string(static_cast<char*>(buffer.data()), buffer.bytes()), "0123456789");
+
+    py::bytearray writable(std::string("0123456789"));
+    auto strided = pymrc::buffer_from_python(py::memoryview(writable)[py::slice(0, 10, 2)]);
+    EXPECT_EQ(std::string(static_cast<char*>(strided.data()), strided.bytes()), "02468");
+}
+
+TEST_F(TestBuffer, RejectNonBuffers)
+{
+    EXPECT_THROW(pymrc::buffer_from_python(py::int_(42)), py::type_error);
+}
@@ -15,7 +15,9 @@
 
 from .watchers import LatencyWatcher
 from .watchers import ThroughputWatcher
+from .watchers import get_operator_batch_stats
 from .watchers import get_tracing_stats
+from .watchers import reset_operator_batch_stats
 from .watchers import reset_tracing_stats
 from .watchers import sync_tracing_state
 from .watchers import trace_channels
@@ -17,6 +17,7 @@
 
 #include "mrc/benchmarking/trace_statistics.hpp"
 
+#include "pymrc/operators.hpp"
 #include "pymrc/utils.hpp"
 
 #include <nlohmann/json.hpp>
@@ -49,5 +50,13 @@ void init_tracer_stats_api(py::module_& m)
           static_cast<std::tuple<bool, bool> (*)()>(&mrc::benchmarking::TraceStatistics::trace_channels));
     m.def("reset_tracing_stats", &mrc::benchmarking::TraceStatistics::reset);
     m.def("sync_tracing_state", &mrc::benchmarking::TraceStatistics::sync_state);
+
+    m.def("get_operator_batch_stats", []() {
+        py::dict stats;
+        stats["batch_count"] = OperatorBatchStatistics::batch_count();
+        stats["value_count"] = OperatorBatchStatistics::value_count();
+        return stats;
+    });
+    m.def("reset_operator_batch_stats", &OperatorBatchStatistics::reset);
 }
 }  // namespace mrc::pymrc
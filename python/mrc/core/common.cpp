@@ -15,9 +15,12 @@
  * limitations under the License.
  */
 
+#include "pymrc/buffer.hpp"
+#include "pymrc/edge_adapter.hpp"
 #include "pymrc/port_builders.hpp"
 #include "pymrc/types.hpp"
 
+#include "mrc/memory/buffer.hpp"
 #include "mrc/node/rx_sink_base.hpp"
 #include "mrc/node/rx_source_base.hpp"
 #include "mrc/types.hpp"
@@ -52,6 +55,20 @@ PYBIND11_MODULE(common, module)
     // EdgeAdapterUtil::register_data_adapters<PyHolder>();
     PortBuilderUtil::register_port_util<PyHolder>();
 
+    py::class_<memory::buffer, std::shared_ptr<memory::buffer>>(module, "Buffer", py::buffer_protocol())
+        .def(py::init<>(&BufferProxy::init), py::arg("obj"))
+        .def_buffer(&BufferProxy::get_buffer_info)
+        .def_property_readonly("nbytes", &BufferProxy::nbytes)
+        .def_property_readonly("kind", &BufferProxy::kind)
+        .def_property_readonly("__array_interface__", &BufferProxy::array_interface)
+        .def_property_readonly("__cuda_array_interface__", &BufferProxy::cuda_array_interface)
+        .def("__len__", &BufferProxy::nbytes)
+        .def("__repr__", &BufferProxy::repr);
+
+    // Buffers cross between Python and C++ nodes by value or shared, see pymrc/buffer.hpp
+    EdgeAdapterUtil::register_data_adapters<memory::buffer>();
+    EdgeAdapterUtil::register_data_adapters<std::shared_ptr<memory::buffer>>();
+
     module.attr("__version__") = MRC_CONCAT_STR(mrc_VERSION_MAJOR << "." << mrc_VERSION_MINOR << "."
                                                                   << mrc_VERSION_PATCH);
 }
@@ -25,6 +25,7 @@
 
 #include <pybind11/functional.h>  // IWYU pragma: keep
 #include <pybind11/pybind11.h>
+#include <pybind11/chrono.h>  // IWYU pragma: keep
 #include <pybind11/pytypes.h>
 #include <pybind11/stl.h>  // IWYU pragma: keep
 
@@ -54,11 +55,15 @@ PYBIND11_MODULE(operators, module)
 
     module.def("build", &OperatorsProxy::build);
     module.def("filter", &OperatorsProxy::filter);
+    module.def("filter_by_attr", &OperatorsProxy::filter_by_attr, py::arg("name"), py::arg("values"));
+    module.def("filter_by_key", &OperatorsProxy::filter_by_key, py::arg("key"), py::arg("values"));
     module.def("flatten", &OperatorsProxy::flatten);
     module.def("map", &OperatorsProxy::map);
     module.def("on_completed", &OperatorsProxy::on_completed);
     module.def("pairwise", &OperatorsProxy::pairwise);
+    module.def("sample", &OperatorsProxy::sample, py::arg("every_n"));
     module.def("to_list", &OperatorsProxy::to_list);
+    module.def("window", &OperatorsProxy::window, py::arg("count"), py::arg("timeout") = py::none());
 
     module.attr("__version__") = MRC_CONCAT_STR(mrc_VERSION_MAJOR << "." << mrc_VERSION_MINOR << "."
                                                                   << mrc_VERSION_PATCH);
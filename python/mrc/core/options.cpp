@@ -100,6 +100,9 @@ PYBIND11_MODULE(options, module)
         .def_property("dedicated_main_thread",
                       &mrc::EngineGroups::dedicated_main_thread,
                       &mrc::EngineGroups::set_dedicated_main_thread)
+        .def_property("fuse_operator_chains",
+                      &mrc::EngineGroups::fuse_operator_chains,
+                      &mrc::EngineGroups::set_fuse_operator_chains)
         .def("set_engine_factory_options",
              py::overload_cast<std::string, EngineFactoryOptions>(&mrc::EngineGroups::set_engine_factory_options))
         .def("engine_group_options",
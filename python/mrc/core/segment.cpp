@@ -24,6 +24,7 @@
 #include "pymrc/utilities/function_wrappers.hpp"  // IWYU pragma: keep
 #include "pymrc/utils.hpp"
 
+#include "mrc/core/bitmap.hpp"
 #include "mrc/edge/edge_connector.hpp"
 #include "mrc/modules/segment_modules.hpp"
 #include "mrc/runnable/launch_options.hpp"
@@ -35,6 +36,7 @@
 #include <pybind11/cast.h>
 #include <pybind11/pybind11.h>
 #include <pybind11/pytypes.h>
+#include <pybind11/stl.h>  // IWYU pragma: keep
 
 #include <array>
 #include <cstddef>
@@ -43,6 +45,8 @@
 #include <map>
 #include <memory>
 #include <sstream>
+#include <utility>
+#include <variant>
 #include <vector>
 
 namespace mrc::pymrc {
@@ -95,14 +99,45 @@ PYBIND11_MODULE(segment, module)
     py::class_<mrc::runnable::LaunchOptions>(module, "LaunchOptions")
         .def_readwrite("pe_count", &mrc::runnable::LaunchOptions::pe_count)
         .def_readwrite("engines_per_pe", &mrc::runnable::LaunchOptions::engines_per_pe)
-        .def_readwrite("engine_factory_name", &mrc::runnable::LaunchOptions::engine_factory_name);
+        .def_readwrite("max_instances", &mrc::runnable::LaunchOptions::max_instances)
+        .def_readwrite("engine_factory_name", &mrc::runnable::LaunchOptions::engine_factory_name)
+        .def(
+            "place_on_partition",
+            [](mrc::runnable::LaunchOptions& self, std::size_t partition_id) {
+                self.placement = mrc::runnable::PartitionPlacement{partition_id};
+            },
+            py::arg("partition_id"))
+        .def(
+            "place_on_numa_node",
+            [](mrc::runnable::LaunchOptions& self, std::uint32_t numa_id) {
+                self.placement = mrc::runnable::NumaNodePlacement{numa_id};
+            },
+            py::arg("numa_id"))
+        .def(
+            "place_on_cpus",
+            [](mrc::runnable::LaunchOptions& self, const std::vector<std::uint32_t>& cpus) {
+                mrc::CpuSet cpu_set;
+                for (const auto& cpu : cpus)
+                {
+                    cpu_set.on(cpu);
+                }
+                self.placement = mrc::runnable::CpuSetPlacement{std::move(cpu_set)};
+            },
+            py::arg("cpus"))
+        .def("clear_placement", [](mrc::runnable::LaunchOptions& self) {
+            self.placement = std::monostate{};
+        });
 
     // Base SegmentObject that all object usually derive from
     py::class_<mrc::segment::ObjectProperties, std::shared_ptr<mrc::segment::ObjectProperties>>(module, "SegmentObject")
         .def_property_readonly("name", &PyNode::name)
         .def_property_readonly("launch_options",
                                py::overload_cast<>(&mrc::segment::ObjectProperties::launch_options),
-                               py::return_value_policy::reference_internal);
+                               py::return_value_policy::reference_internal)
+        .def("set_read_batch",
+             &SegmentObjectProxy::set_read_batch,
+             py::arg("max_count"),
+             py::arg("max_wait_us") = 0);
 
     auto Builder       = py::class_<mrc::segment::Builder>(module, "Builder");
     auto Definition    = py::class_<mrc::segment::Definition>(module, "Definition");
@@ -15,6 +15,7 @@
  * limitations under the License.
  */
 
+#include "pymrc/buffer.hpp"
 #include "pymrc/forward.hpp"
 #include "pymrc/node.hpp"
 #include "pymrc/port_builders.hpp"
@@ -23,6 +24,7 @@
 #include "pymrc/utils.hpp"
 
 #include "mrc/edge/edge_connector.hpp"
+#include "mrc/memory/buffer.hpp"
 #include "mrc/node/rx_sink_base.hpp"
 #include "mrc/node/rx_source_base.hpp"
 #include "mrc/segment/builder.hpp"
@@ -38,6 +40,7 @@
 
 #include <array>
 #include <cstddef>
+#include <cstdint>
 #include <exception>
 #include <map>
 #include <memory>
@@ -309,6 +312,28 @@ GENERATE_NODE_TYPES(TestNodeComponent, NodeComponent);
 GENERATE_NODE_TYPES(TestSink, Sink);
 GENERATE_NODE_TYPES(TestSinkComponent, SinkComponent);
 
+// Increments every byte in place, so Python can tell whether a buffer crossed the edges without being copied
+class BufferIncrementNode
+  : public pymrc::PythonNode<std::shared_ptr<memory::buffer>, std::shared_ptr<memory::buffer>>
+{
+  public:
+    using buffer_t = std::shared_ptr<memory::buffer>;
+
+    BufferIncrementNode()
+    {
+        this->make_stream([](rxcpp::observable<buffer_t> input) {
+            return input.map([](buffer_t buffer) {
+                auto* bytes = static_cast<std::uint8_t*>(buffer->data());
+                for (std::size_t i = 0; i < buffer->bytes(); ++i)
+                {
+                    bytes[i] += 1;
+                }
+                return buffer;
+            });
+        });
+    }
+};
+
 #define CREATE_TEST_NODE_CLASS(class_name)                                                                        \
     py::class_<segment::Object<class_name>,                                                                       \
                mrc::segment::ObjectProperties,                                                                    \
@@ -378,6 +403,15 @@ PYBIND11_MODULE(test_edges_cpp, module)
     CREATE_TEST_NODE_CLASS(SinkComponentDerivedA);
     CREATE_TEST_NODE_CLASS(SinkComponentDerivedB);
 
+    py::class_<segment::Object<BufferIncrementNode>,
+               mrc::segment::ObjectProperties,
+               std::shared_ptr<segment::Object<BufferIncrementNode>>>(module, "BufferIncrementNode")
+        .def(py::init<>([](mrc::segment::Builder& parent, const std::string& name) {
+                 return parent.construct_object<BufferIncrementNode>(name);
+             }),
+             py::arg("parent"),
+             py::arg("name"));
+
     module.attr("__version__") = MRC_CONCAT_STR(mrc_VERSION_MAJOR << "." << mrc_VERSION_MINOR << "."
                                                                   << mrc_VERSION_PATCH);
 }
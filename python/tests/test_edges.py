@@ -16,6 +16,7 @@
 import itertools
 import typing
 
+import numpy as np
 import pytest
 
 import mrc
@@ -557,3 +558,36 @@ def test_source_to_node_to_null(run_segment,
     results = run_segment(segment_init)
 
     assert results == expected_node_counts
+
+
+def test_buffer_zero_copy_round_trip(ex_runner):
+
+    arrays = [np.arange(i, i + 16, dtype=np.uint8) for i in range(5)]
+    expected = [a + 1 for a in arrays]
+    received = []
+
+    def segment_init(seg: mrc.Builder):
+
+        def source_fn():
+            yield from arrays
+
+        def on_next(x: mrc.Buffer):
+            assert isinstance(x, mrc.Buffer)
+            received.append(np.asarray(x))
+
+        source = seg.make_source("source", source_fn())
+        node = m.BufferIncrementNode(seg, "node")
+        sink = seg.make_sink("sink", on_next, None, None)
+
+        seg.make_edge(source, node)
+        seg.make_edge(node, sink)
+
+    ex_runner(segment_init)
+
+    assert len(received) == len(arrays)
+
+    for original, result, values in zip(arrays, received, expected):
+        # the C++ node wrote into the memory of the original arrays, and the sink sees that same memory
+        assert np.shares_memory(original, result)
+        np.testing.assert_array_equal(original, values)
+        np.testing.assert_array_equal(result, values)
@@ -13,9 +13,14 @@
 # See the License for the specific language governing permissions and
 # limitations under the License.
 
+import datetime
+import threading
+import time
+
 import pytest
 
 import mrc
+import mrc.benchmarking
 from mrc.core import operators as ops
 
 
@@ -254,5 +259,218 @@ def test_combination(run_segment):
     assert actual == expected
 
 
+def test_filter_by_key(run_segment):
+
+    input_data = [{"kind": "a", "v": 1}, {"kind": "b", "v": 2}, {"v": 3}, {"kind": "c", "v": 4}, {"kind": "a", "v": 5}]
+    expected = [{"kind": "a", "v": 1}, {"kind": "c", "v": 4}, {"kind": "a", "v": 5}]
+
+    def node_fn(input: mrc.Observable, output: mrc.Subscriber):
+
+        input.pipe(ops.filter_by_key("kind", {"a", "c"})).subscribe(output)
+
+    actual, raised_error = run_segment(input_data, node_fn)
+
+    # values without the key are dropped
+    assert actual == expected
+
+
+def test_filter_by_attr(run_segment):
+
+    class Message:
+
+        def __init__(self, kind):
+            self.kind = kind
+
+    input_data = [Message("a"), Message("b"), 42, Message("a")]
+
+    def node_fn(input: mrc.Observable, output: mrc.Subscriber):
+
+        input.pipe(ops.filter_by_attr("kind", ["a"])).subscribe(output)
+
+    actual, raised_error = run_segment(input_data, node_fn)
+
+    assert actual == [input_data[0], input_data[3]]
+
+
+def test_sample(run_segment):
+
+    input_data = list(range(10))
+    expected = [0, 3, 6, 9]
+
+    def node_fn(input: mrc.Observable, output: mrc.Subscriber):
+
+        input.pipe(ops.sample(3)).subscribe(output)
+
+    actual, raised_error = run_segment(input_data, node_fn)
+
+    assert actual == expected
+
+    with pytest.raises(ValueError):
+        ops.sample(0)
+
+
+def test_window(run_segment):
+
+    input_data = list(range(10))
+    expected = [[0, 1, 2, 3], [4, 5, 6, 7], [8, 9]]
+
+    def node_fn(input: mrc.Observable, output: mrc.Subscriber):
+
+        input.pipe(ops.window(4)).subscribe(output)
+
+    actual, raised_error = run_segment(input_data, node_fn)
+
+    # the last, partial window is emitted on completion
+    assert actual == expected
+
+    with pytest.raises(ValueError):
+        ops.window(0)
+
+
+def test_window_timeout(run_segment):
+
+    input_data = list(range(5))
+
+    def node_fn(input: mrc.Observable, output: mrc.Subscriber):
+
+        # a zero timeout closes every window on its first value
+        input.pipe(ops.window(100, timeout=datetime.timedelta(0))).subscribe(output)
+
+    actual, raised_error = run_segment(input_data, node_fn)
+
+    assert actual == [[x] for x in input_data]
+
+
+def test_window_timeout_while_idle():
+
+    actual = []
+    flushed = threading.Event()
+
+    def source_fn():
+        yield 0
+        yield 1
+
+        # no value arrives until the partial window has been flushed by its timeout
+        flushed.wait(timeout=5.0)
+        yield 2
+
+    def segment_fn(seg: mrc.Builder):
+        source = seg.make_source("source", source_fn())
+
+        def node_fn(input: mrc.Observable, output: mrc.Subscriber):
+            input.pipe(ops.window(100, timeout=datetime.timedelta(milliseconds=10))).subscribe(output)
+
+        node = seg.make_node("test", ops.build(node_fn))
+        seg.make_edge(source, node)
+
+        def sink_on_next(x):
+            actual.append(x)
+            flushed.set()
+
+        sink = seg.make_sink("sink", sink_on_next, None, None)
+        seg.make_edge(node, sink)
+
+    pipeline = mrc.Pipeline()
+    pipeline.make_segment("my_seg", segment_fn)
+
+    # the source blocks its thread while it waits, so every node gets a thread of its own
+    options = mrc.Options()
+    options.topology.user_cpuset = "0-0"
+    options.engine_factories.default_engine_type = mrc.core.options.EngineType.Thread
+
+    executor = mrc.Executor(options)
+    executor.register_pipeline(pipeline)
+    executor.start()
+    executor.join()
+
+    assert actual == [[0, 1], [2]]
+
+
+def test_window_timeout_error():
+
+    def source_fn():
+        yield 0
+
+        # keep the stream open so the window can only be closed by its timeout
+        time.sleep(0.5)
+
+    def raise_on_window(x):
+        raise RuntimeError("window closed by timeout")
+
+    def segment_fn(seg: mrc.Builder):
+        source = seg.make_source("source", source_fn())
+
+        def node_fn(input: mrc.Observable, output: mrc.Subscriber):
+            input.pipe(ops.window(100, timeout=datetime.timedelta(milliseconds=10)),
+                       ops.map(raise_on_window)).subscribe(output)
+
+        node = seg.make_node("test", ops.build(node_fn))
+        seg.make_edge(source, node)
+
+        sink = seg.make_sink("sink", lambda x: None, None, None)
+        seg.make_edge(node, sink)
+
+    pipeline = mrc.Pipeline()
+    pipeline.make_segment("my_seg", segment_fn)
+
+    options = mrc.Options()
+    options.topology.user_cpuset = "0-0"
+    options.engine_factories.default_engine_type = mrc.core.options.EngineType.Thread
+
+    executor = mrc.Executor(options)
+    executor.register_pipeline(pipeline)
+    executor.start()
+
+    # the error raised downstream of the timed out window fails the pipeline like any other error of the node
+    with pytest.raises(RuntimeError):
+        executor.join()
+
+
+def test_read_batch(ex_runner):
+
+    input_data = list(range(100))
+    expected = [x * 2 for x in input_data if x % 3 != 0]
+    actual = []
+
+    def segment_fn(seg: mrc.Builder):
+        source = seg.make_source("source", producer(input_data))
+
+        def node_fn(input: mrc.Observable, output: mrc.Subscriber):
+            input.pipe(ops.filter(lambda x: x % 3 != 0), ops.map(lambda x: x * 2)).subscribe(output)
+
+        node = seg.make_node("test", ops.build(node_fn))
+        node.set_read_batch(16, max_wait_us=1000)
+
+        seg.make_edge(source, node)
+
+        sink = seg.make_sink("sink", actual.append, None, None)
+        seg.make_edge(node, sink)
+
+    mrc.benchmarking.reset_operator_batch_stats()
+
+    ex_runner(segment_fn)
+
+    # batching must not reorder or drop values
+    assert actual == expected
+
+    stats = mrc.benchmarking.get_operator_batch_stats()
+    assert stats["value_count"] == len(input_data) + len(expected)
+    assert 0 < stats["batch_count"] < stats["value_count"]
+
+
+def test_read_batch_requires_sink(ex_runner):
+
+    def segment_fn(seg: mrc.Builder):
+        source = seg.make_source("source", producer([1]))
+
+        with pytest.raises(RuntimeError):
+            source.set_read_batch(16)
+
+        sink = seg.make_sink("sink", lambda x: None, None, None)
+        seg.make_edge(source, sink)
+
+    ex_runner(segment_fn)
+
+
 if (__name__ == "__main__"):
     pytest.main(['-s', 'tests/test_operators.py::test_filter_error'])
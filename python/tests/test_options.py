@@ -54,6 +54,17 @@ def test_engine_factories_dedicated_main_thread():
     assert options.engine_factories.dedicated_main_thread is False, "dedicated_main_thread set/get should match"
 
 
+def test_engine_factories_fuse_operator_chains():
+
+    options = mrc.Options()
+
+    assert options.engine_factories.fuse_operator_chains is False, "fuse_operator_chains should be opt-in"
+
+    options.engine_factories.fuse_operator_chains = True
+
+    assert options.engine_factories.fuse_operator_chains is True, "fuse_operator_chains set/get should match"
+
+
 @pytest.mark.parametrize(
     "engine_type",
     [mrc.core.options.EngineType.Fiber, mrc.core.options.EngineType.Process, mrc.core.options.EngineType.Thread])